@@ -0,0 +1,129 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+#include "pch.h"
+#include "AdaptiveConcurrency.h"
+
+namespace AppInstaller::CLI::Execution
+{
+    namespace
+    {
+        // The number of windows at the baseline limit before trying a higher limit again.
+        constexpr uint32_t s_WindowsBeforeProbe = 4;
+
+        // A higher limit must improve throughput by at least 1/s_RequiredGainDivisor to be kept.
+        constexpr uint64_t s_RequiredGainDivisor = 10;
+
+        // Throughput at the same limit dropping by more than 1/s_DegradationDivisor is treated as contention.
+        constexpr uint64_t s_DegradationDivisor = 4;
+    }
+
+    AdaptiveConcurrencyController::AdaptiveConcurrencyController(uint32_t initialLimit, uint32_t maximumLimit) :
+        m_maximumLimit(std::max<uint32_t>(maximumLimit, 1))
+    {
+        m_limit = std::clamp<uint32_t>(initialLimit, 1, m_maximumLimit);
+    }
+
+    void AdaptiveConcurrencyController::RecordStart(clock::time_point now)
+    {
+        // A partial window left when the work drained would include the idle time since, so it is discarded.
+        if (m_inFlight == 0 || !m_windowStart)
+        {
+            m_windowStart = now;
+            m_windowBytes = 0;
+            m_windowCompletions = 0;
+        }
+
+        ++m_inFlight;
+    }
+
+    std::optional<uint32_t> AdaptiveConcurrencyController::RecordCompletion(uint64_t bytes, clock::time_point now)
+    {
+        if (m_inFlight > 0)
+        {
+            --m_inFlight;
+        }
+
+        if (bytes == 0)
+        {
+            return std::nullopt;
+        }
+
+        if (!m_windowStart)
+        {
+            m_windowStart = now;
+        }
+
+        m_windowBytes += bytes;
+        ++m_windowCompletions;
+
+        if (m_windowCompletions < m_limit)
+        {
+            return std::nullopt;
+        }
+
+        auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(now - m_windowStart.value());
+        uint64_t elapsedMilliseconds = std::max<uint64_t>(static_cast<uint64_t>(elapsed.count()), 1);
+        uint64_t throughput = m_windowBytes * 1000 / elapsedMilliseconds;
+
+        // Items still running when the window closes count towards the next one.
+        m_windowStart = now;
+        m_windowBytes = 0;
+        m_windowCompletions = 0;
+        m_lastThroughput = throughput;
+
+        uint32_t limit = EvaluateWindow(throughput);
+        if (limit == m_limit)
+        {
+            return std::nullopt;
+        }
+
+        m_limit = limit;
+        return limit;
+    }
+
+    uint32_t AdaptiveConcurrencyController::EvaluateWindow(uint64_t throughput)
+    {
+        uint32_t probeLimit = std::min(m_limit + 1, m_maximumLimit);
+
+        if (!m_baseline)
+        {
+            m_baseline = Sample{ m_limit, throughput };
+            return probeLimit;
+        }
+
+        Sample& baseline = m_baseline.value();
+
+        if (m_limit > baseline.Limit)
+        {
+            m_stableWindows = 0;
+
+            if (throughput >= baseline.Throughput + baseline.Throughput / s_RequiredGainDivisor)
+            {
+                baseline = Sample{ m_limit, throughput };
+                return probeLimit;
+            }
+
+            // The additional download did not add bandwidth, so it only adds contention.
+            return baseline.Limit;
+        }
+
+        if (throughput < baseline.Throughput - baseline.Throughput / s_DegradationDivisor)
+        {
+            m_stableWindows = 0;
+            uint32_t reducedLimit = std::max<uint32_t>(m_limit - 1, 1);
+            baseline = Sample{ reducedLimit, throughput };
+            return reducedLimit;
+        }
+
+        // Follow the current conditions so that gradual changes are judged against recent values.
+        baseline.Throughput = throughput;
+
+        if (++m_stableWindows >= s_WindowsBeforeProbe)
+        {
+            m_stableWindows = 0;
+            return probeLimit;
+        }
+
+        return m_limit;
+    }
+}
@@ -0,0 +1,63 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+#pragma once
+#include <chrono>
+#include <cstdint>
+#include <optional>
+
+namespace AppInstaller::CLI::Execution
+{
+    // Tunes the number of concurrent downloads from the observed aggregate throughput.
+    // The limit is raised one step at a time while doing so increases the aggregate bandwidth,
+    // returned to the last good value when it does not, and lowered when the bandwidth at the
+    // current limit degrades (a sign of contention with other downloads or other traffic).
+    struct AdaptiveConcurrencyController
+    {
+        using clock = std::chrono::steady_clock;
+
+        AdaptiveConcurrencyController(uint32_t initialLimit, uint32_t maximumLimit);
+
+        // Gets the current concurrency limit.
+        uint32_t GetLimit() const { return m_limit; }
+
+        // Gets the aggregate throughput, in bytes per second, of the last completed measurement window.
+        uint64_t GetThroughput() const { return m_lastThroughput; }
+
+        // Records the start of an item; every started item must be matched by a call to RecordCompletion.
+        // Starting an item while none are running begins a new window, so that idle time is not measured.
+        void RecordStart(clock::time_point now);
+
+        // Records the completion of an item that transferred the given number of bytes.
+        // Items that transferred nothing are not counted towards the window.
+        // Returns the new limit if it changed as a result.
+        std::optional<uint32_t> RecordCompletion(uint64_t bytes, clock::time_point now);
+
+    private:
+        // A measurement of throughput at a given limit.
+        struct Sample
+        {
+            uint32_t Limit;
+            uint64_t Throughput;
+        };
+
+        uint32_t EvaluateWindow(uint64_t throughput);
+
+        uint32_t m_limit;
+        uint32_t m_maximumLimit;
+
+        // The current measurement window; it is closed once as many items as the limit have completed.
+        std::optional<clock::time_point> m_windowStart;
+        uint64_t m_windowBytes = 0;
+        uint32_t m_windowCompletions = 0;
+
+        // The number of items started but not yet completed.
+        uint32_t m_inFlight = 0;
+
+        // The best known limit and its throughput, against which changes are judged.
+        std::optional<Sample> m_baseline;
+        uint64_t m_lastThroughput = 0;
+
+        // Number of windows spent at the baseline since the last attempt to raise the limit.
+        uint32_t m_stableWindows = 0;
+    };
+}
@@ -107,12 +107,16 @@ namespace AppInstaller::CLI
             return { type, "arg"_liv, 'a' };
         case Execution::Args::Type::ForceSourceReset:
             return { type, "force"_liv };
+        case Execution::Args::Type::ScheduledSourceUpdate:
+            return { type, "scheduled"_liv };
 
         //Hash Command
         case Execution::Args::Type::HashFile:
             return { type, "file"_liv, 'f' };
         case Execution::Args::Type::Msix:
             return { type, "msix"_liv, 'm' };
+        case Execution::Args::Type::HashOutputFormat:
+            return { type, "format"_liv };
 
         //Validate Command
         case Execution::Args::Type::ValidateManifest:
@@ -202,6 +206,8 @@ namespace AppInstaller::CLI
             return { type, "wait"_liv };
         case Execution::Args::Type::OpenLogs:
             return { type, "open-logs"_liv, "logs"_liv };
+        case Execution::Args::Type::TraceFile:
+            return { type, "trace"_liv };
         case Execution::Args::Type::Force:
             return { type, "force"_liv, ArgTypeCategory::CopyFlagToSubContext };
 
@@ -287,9 +293,11 @@ namespace AppInstaller::CLI
         case Args::Type::NoUpgrade:
             return Argument{ type, Resource::String::NoUpgradeArgumentDescription, ArgumentType::Flag };
         case Args::Type::HashFile:
-            return Argument{ type, Resource::String::FileArgumentDescription, ArgumentType::Positional, true };
+            return Argument{ type, Resource::String::FileArgumentDescription, ArgumentType::Positional, true }.SetCountLimit(128);
         case Args::Type::Msix:
             return Argument{ type, Resource::String::MsixArgumentDescription, ArgumentType::Flag };
+        case Args::Type::HashOutputFormat:
+            return Argument{ type, Resource::String::HashOutputFormatArgumentDescription, ArgumentType::Standard };
         case Args::Type::ListVersions:
             return Argument{ type, Resource::String::VersionsArgumentDescription, ArgumentType::Flag };
         case Args::Type::Help:
@@ -332,6 +340,8 @@ namespace AppInstaller::CLI
             return Argument{ type, Resource::String::ProductCodeArgumentDescription, ArgumentType::Standard, false };
         case Args::Type::OpenLogs:
             return Argument{ type, Resource::String::OpenLogsArgumentDescription, ArgumentType::Flag, Argument::Visibility::Help };
+        case Args::Type::TraceFile:
+            return Argument{ type, Resource::String::TraceArgumentDescription, ArgumentType::Standard, Argument::Visibility::Help };
         case Args::Type::UninstallPrevious:
             return Argument{ type, Resource::String::UninstallPreviousArgumentDescription, ArgumentType::Flag, Argument::Visibility::Help };
         case Args::Type::Force:
@@ -350,6 +360,7 @@ namespace AppInstaller::CLI
         args.push_back(ForType(Args::Type::RainbowStyle));
         args.push_back(ForType(Args::Type::RetroStyle));
         args.push_back(ForType(Args::Type::VerboseLogs));
+        args.push_back(ForType(Args::Type::TraceFile));
         args.emplace_back(Args::Type::DisableInteractivity, Resource::String::DisableInteractivityArgumentDescription, ArgumentType::Flag, false);
     }
 
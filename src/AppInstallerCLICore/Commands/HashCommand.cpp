@@ -6,17 +6,307 @@
 #include "Resources.h"
 
 #include <AppInstallerMsixInfo.h>
+#include <AppInstallerRuntime.h>
+#include <winget/FileHashCache.h>
+
+#include <Shlwapi.h>
 
 namespace AppInstaller::CLI
 {
     using namespace std::string_view_literals;
     using namespace Utility::literals;
 
+    namespace
+    {
+        // The formats that the hashes can be written in.
+        enum class HashOutputFormat
+        {
+            Text,
+            Json,
+            Csv,
+        };
+
+        std::optional<HashOutputFormat> ConvertToHashOutputFormat(std::string_view value)
+        {
+            if (Utility::CaseInsensitiveEquals(value, "text"sv))
+            {
+                return HashOutputFormat::Text;
+            }
+            else if (Utility::CaseInsensitiveEquals(value, "json"sv))
+            {
+                return HashOutputFormat::Json;
+            }
+            else if (Utility::CaseInsensitiveEquals(value, "csv"sv))
+            {
+                return HashOutputFormat::Csv;
+            }
+
+            return std::nullopt;
+        }
+
+        HashOutputFormat GetHashOutputFormat(const Execution::Args& args)
+        {
+            if (args.Contains(Execution::Args::Type::HashOutputFormat))
+            {
+                return ConvertToHashOutputFormat(args.GetArg(Execution::Args::Type::HashOutputFormat)).value();
+            }
+
+            return HashOutputFormat::Text;
+        }
+
+        // The hashes computed for one file.
+        struct FileHashResult
+        {
+            std::filesystem::path Path;
+            std::string Sha256;
+            std::string SignatureSha256;
+            HRESULT Error = S_OK;
+        };
+
+        // The files to hash, expanded from the inputs.
+        struct FilesToHash
+        {
+            std::vector<std::filesystem::path> Files;
+
+            // Whether any input was a directory or contained wildcards.
+            bool Expanded = false;
+        };
+
+        // Expands the inputs into the files to hash.
+        // Directories are searched recursively, and wildcards in the last part of an input are matched against the file names in its directory.
+        FilesToHash GetFilesToHash(Execution::Context& context)
+        {
+            FilesToHash result;
+            std::vector<std::filesystem::path>& files = result.Files;
+
+            for (const auto& input : *context.Args.GetArgs(Execution::Args::Type::HashFile))
+            {
+                std::filesystem::path inputPath{ Utility::ConvertToUTF16(input) };
+                size_t matchedFiles = files.size();
+
+                if (inputPath.filename().native().find_first_of(L"*?") != std::wstring::npos)
+                {
+                    result.Expanded = true;
+                    std::filesystem::path directory = inputPath.parent_path();
+                    std::wstring pattern = inputPath.filename().native();
+
+                    std::error_code error;
+                    for (const auto& entry : std::filesystem::directory_iterator{ directory.empty() ? std::filesystem::path{ L"." } : directory, error })
+                    {
+                        if (entry.is_regular_file() && PathMatchSpecW(entry.path().filename().c_str(), pattern.c_str()))
+                        {
+                            files.emplace_back(entry.path());
+                        }
+                    }
+                }
+                else if (std::filesystem::is_directory(inputPath))
+                {
+                    result.Expanded = true;
+                    for (const auto& entry : std::filesystem::recursive_directory_iterator{ inputPath, std::filesystem::directory_options::skip_permission_denied })
+                    {
+                        if (entry.is_regular_file())
+                        {
+                            files.emplace_back(entry.path());
+                        }
+                    }
+                }
+                else if (std::filesystem::exists(inputPath))
+                {
+                    files.emplace_back(std::move(inputPath));
+                }
+
+                if (files.size() == matchedFiles)
+                {
+                    context.Reporter.Error() << Resource::String::VerifyFileFailedNotExist(Utility::LocIndView{ input }) << std::endl;
+                    AICLI_TERMINATE_CONTEXT_RETURN(HRESULT_FROM_WIN32(ERROR_FILE_NOT_FOUND), {});
+                }
+            }
+
+            // Keep the order of the inputs, but only hash each file once.
+            std::set<std::filesystem::path> seenFiles;
+            files.erase(std::remove_if(files.begin(), files.end(), [&](const std::filesystem::path& file) { return !seenFiles.insert(file.lexically_normal()).second; }), files.end());
+
+            return result;
+        }
+
+        std::string FormatHResult(HRESULT hr)
+        {
+            std::ostringstream stream;
+            stream << WINGET_OSTREAM_FORMAT_HRESULT(hr);
+            return stream.str();
+        }
+
+        std::string EscapeCsvValue(std::string_view value)
+        {
+            std::string result{ "\"" };
+            for (char c : value)
+            {
+                if (c == '"')
+                {
+                    result += '"';
+                }
+
+                result += c;
+            }
+            result += '"';
+            return result;
+        }
+
+        void ReportHashesAsText(Execution::Context& context, const std::vector<FileHashResult>& results, bool includeFileNames)
+        {
+            for (const auto& result : results)
+            {
+                if (includeFileNames)
+                {
+                    context.Reporter.Info() << Utility::LocIndString{ result.Path.u8string() } << std::endl;
+                }
+
+                if (FAILED(result.Error) && result.Sha256.empty())
+                {
+                    context.Reporter.Error() << Resource::String::HashFileFailed(Utility::LocIndView{ result.Path.u8string() }) << std::endl;
+                    continue;
+                }
+
+                context.Reporter.Info() << "InstallerSha256: "_liv << Utility::LocIndString{ result.Sha256 } << std::endl;
+
+                if (!result.SignatureSha256.empty())
+                {
+                    context.Reporter.Info() << "SignatureSha256: "_liv << Utility::LocIndString{ result.SignatureSha256 } << std::endl;
+                }
+                else if (FAILED(result.Error))
+                {
+                    context.Reporter.Warn() <<
+                        Resource::String::MsixSignatureHashFailed << std::endl <<
+                        Resource::String::VerifyFileSignedMsix << std::endl;
+                }
+            }
+        }
+
+        void ReportHashesAsJson(Execution::Context& context, const std::vector<FileHashResult>& results)
+        {
+            Json::Value root{ Json::ValueType::arrayValue };
+
+            for (const auto& result : results)
+            {
+                Json::Value& file = root.append(Json::Value{ Json::ValueType::objectValue });
+                file["File"] = result.Path.u8string();
+
+                if (!result.Sha256.empty())
+                {
+                    file["Sha256"] = result.Sha256;
+                }
+
+                if (!result.SignatureSha256.empty())
+                {
+                    file["SignatureSha256"] = result.SignatureSha256;
+                }
+
+                if (FAILED(result.Error))
+                {
+                    file["Error"] = FormatHResult(result.Error);
+                }
+            }
+
+            Json::StreamWriterBuilder writerBuilder;
+            writerBuilder.settings_["indentation"] = "  ";
+            context.Reporter.Info() << Utility::LocIndString{ Json::writeString(writerBuilder, root) } << std::endl;
+        }
+
+        void ReportHashesAsCsv(Execution::Context& context, const std::vector<FileHashResult>& results)
+        {
+            context.Reporter.Info() << "File,Sha256,SignatureSha256,Error"_liv << std::endl;
+
+            for (const auto& result : results)
+            {
+                std::ostringstream line;
+                line << EscapeCsvValue(result.Path.u8string()) << ',' << result.Sha256 << ',' << result.SignatureSha256 << ',';
+
+                if (FAILED(result.Error))
+                {
+                    line << FormatHResult(result.Error);
+                }
+
+                context.Reporter.Info() << Utility::LocIndString{ line.str() } << std::endl;
+            }
+        }
+
+        void HashFiles(Execution::Context& context)
+        {
+            FilesToHash filesToHash = GetFilesToHash(context);
+            if (context.IsTerminated())
+            {
+                return;
+            }
+
+            const auto& files = filesToHash.Files;
+            HashOutputFormat format = GetHashOutputFormat(context.Args);
+            bool computeSignatureHash = context.Args.Contains(Execution::Args::Type::Msix);
+
+            // Hashes are kept between runs, so that unchanged files are not hashed again.
+            Utility::FileHashCache cache{ Runtime::GetPathTo(Runtime::PathName::LocalState) / "HashCache.json" };
+            auto hashes = cache.GetHashes(files);
+            cache.Save();
+
+            std::vector<FileHashResult> results;
+            HRESULT firstError = S_OK;
+
+            for (size_t i = 0; i < files.size(); ++i)
+            {
+                FileHashResult& result = results.emplace_back();
+                result.Path = files[i];
+                result.Error = hashes[i].Error;
+
+                if (SUCCEEDED(result.Error))
+                {
+                    result.Sha256 = Utility::SHA256::ConvertToString(hashes[i].Hash);
+
+                    if (computeSignatureHash)
+                    {
+                        try
+                        {
+                            Msix::MsixInfo msixInfo{ files[i] };
+                            result.SignatureSha256 = Utility::SHA256::ConvertToString(msixInfo.GetSignatureHash());
+                        }
+                        catch (const wil::ResultException& re)
+                        {
+                            result.Error = re.GetErrorCode();
+                        }
+                    }
+                }
+
+                if (FAILED(result.Error) && SUCCEEDED(firstError))
+                {
+                    firstError = result.Error;
+                }
+            }
+
+            switch (format)
+            {
+            case HashOutputFormat::Text:
+                // A single file keeps the original output, without its name.
+                ReportHashesAsText(context, results, filesToHash.Expanded || files.size() > 1);
+                break;
+            case HashOutputFormat::Json:
+                ReportHashesAsJson(context, results);
+                break;
+            case HashOutputFormat::Csv:
+                ReportHashesAsCsv(context, results);
+                break;
+            }
+
+            if (FAILED(firstError))
+            {
+                AICLI_TERMINATE_CONTEXT(firstError);
+            }
+        }
+    }
+
     std::vector<Argument> HashCommand::GetArguments() const
     {
         return {
             Argument::ForType(Execution::Args::Type::HashFile),
             Argument::ForType(Execution::Args::Type::Msix),
+            Argument::ForType(Execution::Args::Type::HashOutputFormat),
         };
     }
 
@@ -35,34 +325,17 @@ namespace AppInstaller::CLI
         return "https://aka.ms/winget-command-hash"_liv;
     }
 
-    void HashCommand::ExecuteInternal(Execution::Context& context) const
+    void HashCommand::ValidateArgumentsInternal(Execution::Args& execArgs) const
     {
-        context <<
-            Workflow::VerifyFile(Execution::Args::Type::HashFile) <<
-            [](Execution::Context& context)
+        if (execArgs.Contains(Execution::Args::Type::HashOutputFormat) && !ConvertToHashOutputFormat(execArgs.GetArg(Execution::Args::Type::HashOutputFormat)))
         {
-            auto inputFile = context.Args.GetArg(Execution::Args::Type::HashFile);
-            std::ifstream inStream{ Utility::ConvertToUTF16(inputFile), std::ifstream::binary };
-
-            context.Reporter.Info() << "InstallerSha256: "_liv << Utility::LocIndString{ Utility::SHA256::ConvertToString(Utility::SHA256::ComputeHash(inStream)) } << std::endl;
-
-            if (context.Args.Contains(Execution::Args::Type::Msix))
-            {
-                try
-                {
-                    Msix::MsixInfo msixInfo{ inputFile };
-                    auto signatureHash = msixInfo.GetSignatureHash();
+            auto validOptions = Utility::Join(", "_liv, std::vector<Utility::LocIndString>{ "text"_lis, "json"_lis, "csv"_lis });
+            throw CommandException(Resource::String::InvalidArgumentValueError(ArgumentCommon::ForType(Execution::Args::Type::HashOutputFormat).Name, validOptions));
+        }
+    }
 
-                    context.Reporter.Info() << "SignatureSha256: "_liv << Utility::LocIndString{ Utility::SHA256::ConvertToString(signatureHash) } << std::endl;
-                }
-                catch (const wil::ResultException& re)
-                {
-                    context.Reporter.Warn() << 
-                        Resource::String::MsixSignatureHashFailed << std::endl <<
-                        Resource::String::VerifyFileSignedMsix << std::endl;
-                    AICLI_TERMINATE_CONTEXT(re.GetErrorCode());
-                }
-            }
-        };
+    void HashCommand::ExecuteInternal(Execution::Context& context) const
+    {
+        context << HashFiles;
     }
 }
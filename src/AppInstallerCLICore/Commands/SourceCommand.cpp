@@ -126,6 +126,7 @@ namespace AppInstaller::CLI
     {
         return {
             Argument::ForType(Args::Type::SourceName),
+            Argument{ Args::Type::ScheduledSourceUpdate, Resource::String::SourceUpdateScheduledArgumentDescription, ArgumentType::Flag, Argument::Visibility::Hidden },
         };
     }
 
@@ -155,9 +156,16 @@ namespace AppInstaller::CLI
 
     void SourceUpdateCommand::ExecuteInternal(Context& context) const
     {
-        context <<
-            Workflow::GetSourceListWithFilter <<
-            Workflow::UpdateSources;
+        context << Workflow::GetSourceListWithFilter;
+
+        if (context.Args.Contains(Args::Type::ScheduledSourceUpdate))
+        {
+            context << Workflow::RunScheduledSourceUpdates;
+        }
+        else
+        {
+            context << Workflow::UpdateSources;
+        }
     }
 
     std::vector<Argument> SourceRemoveCommand::GetArguments() const
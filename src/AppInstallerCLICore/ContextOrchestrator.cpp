@@ -15,6 +15,37 @@ namespace AppInstaller::CLI::Execution
         // Operation command queue used by install and uninstall commands.
         constexpr static std::string_view OperationCommandQueueName = "operation"sv;
 
+        // Operation command queue used by installs that are safe to run alongside other installs, when enabled.
+        constexpr static std::string_view ConcurrentOperationCommandQueueName = "concurrentOperation"sv;
+
+        // Determines whether the item installs only an MSIX package, which the deployment service can safely do
+        // alongside other installs. Items with dependencies may run other installers, so they are excluded.
+        bool IsConcurrentInstall(const OrchestratorQueueItem& item)
+        {
+            if (!item.IsApplicableForInstallingSource() || !item.GetContext().Contains(Execution::Data::Installer))
+            {
+                return false;
+            }
+
+            const auto& installer = item.GetContext().Get<Execution::Data::Installer>();
+            return installer &&
+                installer->EffectiveInstallerType() == Manifest::InstallerTypeEnum::Msix &&
+                !installer->Dependencies.HasAny();
+        }
+
+        // Gets the number of bytes downloaded for the item, if it has downloaded an installer.
+        uint64_t GetDownloadedBytes(const OrchestratorQueueItem& item)
+        {
+            if (!item.GetContext().Contains(Execution::Data::InstallerPath))
+            {
+                return 0;
+            }
+
+            std::error_code error;
+            auto size = std::filesystem::file_size(item.GetContext().Get<Execution::Data::InstallerPath>(), error);
+            return error ? 0 : static_cast<uint64_t>(size);
+        }
+
         // Callback function used by worker threads in the queue.
         // context must be a pointer to a queue item.
         void CALLBACK OrchestratorQueueWorkCallback(PTP_CALLBACK_INSTANCE, PVOID context, PTP_WORK)
@@ -52,21 +83,51 @@ namespace AppInstaller::CLI::Execution
         m_installingWriteableSource.Open(progress);
 
         // Decide how many threads to use for each command.
-        // We always allow only one install at a time.
-        // For download, if we can find the number of supported concurrent threads,
-        // use that as the maximum (up to 3); otherwise use a single thread.
+        // We allow only one install at a time, except for MSIX installs when configured to run them concurrently.
+        // For download, if we can find the number of supported concurrent threads, start with one fewer
+        // than that (up to 3); otherwise use a single thread. The number is then tuned by the observed
+        // throughput, up to the configured maximum or the number of supported concurrent threads (up to 8).
         const auto supportedConcurrentThreads = std::thread::hardware_concurrency();
-        const UINT32 maxDownloadThreads = 3;
+        const UINT32 initialDownloadThreads = 3;
+        const UINT32 defaultMaxDownloadThreads = 8;
         const UINT32 operationThreads = 1;
-        const UINT32 downloadThreads = std::min(supportedConcurrentThreads ? supportedConcurrentThreads - 1 : 1, maxDownloadThreads);
 
-        AddCommandQueue(COMDownloadCommand::CommandName, downloadThreads);
+        UINT32 maxDownloadThreads = Settings::User().Get<Settings::Setting::NetworkMaxConcurrentDownloads>();
+        if (maxDownloadThreads == 0)
+        {
+            maxDownloadThreads = std::clamp<UINT32>(supportedConcurrentThreads, 1, defaultMaxDownloadThreads);
+        }
+
+        const UINT32 downloadThreads = std::clamp<UINT32>(supportedConcurrentThreads ? supportedConcurrentThreads - 1 : 1, 1, std::min(initialDownloadThreads, maxDownloadThreads));
+
+        AddCommandQueue(COMDownloadCommand::CommandName, downloadThreads, maxDownloadThreads);
         AddCommandQueue(OperationCommandQueueName, operationThreads);
+
+        const UINT32 concurrentOperationThreads = Settings::User().Get<Settings::Setting::InstallMaxConcurrentMsixInstalls>();
+        if (concurrentOperationThreads > 0)
+        {
+            AddCommandQueue(ConcurrentOperationCommandQueueName, concurrentOperationThreads);
+        }
+    }
+
+    void ContextOrchestrator::AddCommandQueue(std::string_view commandName, UINT32 allowedThreads, UINT32 maximumThreads)
+    {
+        m_commandQueues.emplace(commandName, std::make_unique<OrchestratorQueue>(commandName, allowedThreads, maximumThreads));
     }
 
-    void ContextOrchestrator::AddCommandQueue(std::string_view commandName, UINT32 allowedThreads)
+    std::string_view ContextOrchestrator::GetCommandQueueName(const OrchestratorQueueItem& item) const
     {
-        m_commandQueues.emplace(commandName, std::make_unique<OrchestratorQueue>(commandName, allowedThreads));
+        std::string_view commandQueueName = Execution::GetCommandQueueName(item.GetNextCommand().Name());
+
+        if (commandQueueName == OperationCommandQueueName &&
+            item.GetNextCommand().Name() == COMInstallCommand::CommandName &&
+            m_commandQueues.count(std::string{ ConcurrentOperationCommandQueueName }) != 0 &&
+            IsConcurrentInstall(item))
+        {
+            return ConcurrentOperationCommandQueueName;
+        }
+
+        return commandQueueName;
     }
 
     _Requires_lock_held_(m_queueLock)
@@ -96,7 +157,7 @@ namespace AppInstaller::CLI::Execution
             item->GetContext().GetThreadGlobals().GetTelemetryLogger().LogCommand(item->GetItemCommandName());
         }
 
-        std::string commandQueueName{ GetCommandQueueName(item->GetNextCommand().Name()) };
+        std::string commandQueueName{ GetCommandQueueName(*item) };
         m_commandQueues.at(commandQueueName)->EnqueueAndRunItem(item);
     }
 
@@ -131,7 +192,7 @@ namespace AppInstaller::CLI::Execution
     {
         if (queueItem.IsApplicableForInstallingSource())
         {
-            const auto& manifest = queueItem.GetContext().Get<Execution::Data::Manifest>();
+            const Manifest::Manifest& manifest = queueItem.GetContext().Get<Execution::Data::Manifest>();
             m_installingWriteableSource.AddPackageVersion(manifest, std::filesystem::path{ manifest.Id + '.' + manifest.Version });
         }
     }
@@ -140,15 +201,15 @@ namespace AppInstaller::CLI::Execution
     {
         if (queueItem.IsApplicableForInstallingSource())
         {
-            const auto& manifest = queueItem.GetContext().Get<Execution::Data::Manifest>();
+            const Manifest::Manifest& manifest = queueItem.GetContext().Get<Execution::Data::Manifest>();
             m_installingWriteableSource.RemovePackageVersion(manifest, std::filesystem::path{ manifest.Id + '.' + manifest.Version });
         }
     }
 
     _Requires_lock_held_(m_queueLock)
-    std::deque<std::shared_ptr<OrchestratorQueueItem>>::iterator OrchestratorQueue::FindIteratorById(const OrchestratorQueueItemId& comparisonQueueItemId)
+    OrchestratorQueue::QueueItems::iterator OrchestratorQueue::FindIteratorById(const OrchestratorQueueItemId& comparisonQueueItemId)
     {
-        return std::find_if(m_queueItems.begin(), m_queueItems.end(), [&comparisonQueueItemId](const std::shared_ptr<OrchestratorQueueItem>& item) {return (item->GetId().IsSame(comparisonQueueItemId)); });
+        return m_queueItems.find(comparisonQueueItemId);
     }
 
     _Requires_lock_held_(m_queueLock)
@@ -157,7 +218,7 @@ namespace AppInstaller::CLI::Execution
         auto itr = FindIteratorById(comparisonQueueItemId);
         if (itr != m_queueItems.end())
         {
-            return *itr;
+            return itr->second;
         }
 
         return {};
@@ -167,7 +228,7 @@ namespace AppInstaller::CLI::Execution
     {
         {
             std::lock_guard<std::mutex> lockQueue{ m_queueLock };
-            m_queueItems.push_back(item);
+            THROW_HR_IF(HRESULT_FROM_WIN32(ERROR_INSTALL_ALREADY_RUNNING), !m_queueItems.emplace(item->GetId(), item).second);
         }
 
         // Add the package to the Installing source so that it can be queried using the Source interface.
@@ -196,9 +257,14 @@ namespace AppInstaller::CLI::Execution
         }
     }
 
-    OrchestratorQueue::OrchestratorQueue(std::string_view commandName, UINT32 allowedThreads) :
+    OrchestratorQueue::OrchestratorQueue(std::string_view commandName, UINT32 allowedThreads, UINT32 maximumThreads) :
         m_commandName(commandName), m_allowedThreads(allowedThreads)
     {
+        if (maximumThreads > allowedThreads)
+        {
+            m_concurrencyController.emplace(allowedThreads, maximumThreads);
+        }
+
         m_threadPool.reset(CreateThreadpool(nullptr));
         THROW_LAST_ERROR_IF_NULL(m_threadPool);
         m_threadPoolCleanupGroup.reset(CreateThreadpoolCleanupGroup());
@@ -261,6 +327,14 @@ namespace AppInstaller::CLI::Execution
                 RemoveItemInState(*item, OrchestratorQueueItemState::Cancelled, true);
             }
 
+            {
+                std::lock_guard<std::mutex> lockQueue{ m_queueLock };
+                if (m_concurrencyController)
+                {
+                    m_concurrencyController->RecordStart(std::chrono::steady_clock::now());
+                }
+            }
+
             // Get the item's command and execute it.
             HRESULT exceptionHR = S_OK;
             try
@@ -286,6 +360,8 @@ namespace AppInstaller::CLI::Execution
 
             item->GetContext().EnableCtrlHandler(false);
 
+            RecordItemCompletion(*item);
+
             if (FAILED(item->GetContext().GetTerminationHR()) || item->IsComplete())
             {
                 if (SUCCEEDED(item->GetContext().GetTerminationHR()))
@@ -307,6 +383,39 @@ namespace AppInstaller::CLI::Execution
         }
     }
 
+    void OrchestratorQueue::RecordItemCompletion(const OrchestratorQueueItem& item)
+    {
+        // The controller is only created on construction, so it can be checked without the lock.
+        if (!m_concurrencyController)
+        {
+            return;
+        }
+
+        // Every started item is recorded so that the controller knows when the work drains, but items that failed
+        // or did not download anything (such as those installed by the store) say nothing about throughput.
+        uint64_t bytes = SUCCEEDED(item.GetContext().GetTerminationHR()) ? GetDownloadedBytes(item) : 0;
+
+        std::optional<uint32_t> newLimit;
+        uint64_t throughput = 0;
+
+        {
+            std::lock_guard<std::mutex> lockQueue{ m_queueLock };
+            newLimit = m_concurrencyController->RecordCompletion(bytes, std::chrono::steady_clock::now());
+            if (!newLimit)
+            {
+                return;
+            }
+
+            m_allowedThreads = newLimit.value();
+            throughput = m_concurrencyController->GetThroughput();
+
+            // Running work is not interrupted when the limit is lowered; the pool simply stops starting more threads.
+            SetThreadpoolThreadMaximum(m_threadPool.get(), m_allowedThreads);
+        }
+
+        item.GetContext().GetThreadGlobals().GetTelemetryLogger().LogOrchestratorQueueConcurrency(m_commandName, newLimit.value(), throughput);
+    }
+
     bool OrchestratorQueue::RemoveItemInState(const OrchestratorQueueItem& item, OrchestratorQueueItemState state, bool isGlobalRemove)
     {
         // OrchestratorQueueItemState::Running items should only be removed by the thread that ran the item.
@@ -319,7 +428,7 @@ namespace AppInstaller::CLI::Execution
 
             // Look for the item. It's ok if the item is not found since multiple listeners may try to remove the same item.
             auto itr = FindIteratorById(item.GetId());
-            if (itr != m_queueItems.end() && (*itr)->GetState() == state)
+            if (itr != m_queueItems.end() && itr->second->GetState() == state)
             {
                 foundItem = true;
 
@@ -328,12 +437,12 @@ namespace AppInstaller::CLI::Execution
                 // it, we simply mark it as cancelled.
                 if (state == OrchestratorQueueItemState::Running || state == OrchestratorQueueItemState::Cancelled)
                 {
-                    (*itr)->SetCurrentQueue(nullptr);
+                    itr->second->SetCurrentQueue(nullptr);
                     m_queueItems.erase(itr);
                 }
                 else if (state == OrchestratorQueueItemState::Queued)
                 {
-                    (*itr)->SetState(OrchestratorQueueItemState::Cancelled);
+                    itr->second->SetState(OrchestratorQueueItemState::Cancelled);
                 }
             }
         }
@@ -347,9 +456,18 @@ namespace AppInstaller::CLI::Execution
         return foundItem;
     }
 
+    OrchestratorQueueItemId::OrchestratorQueueItemId(std::wstring packageId, std::wstring sourceId) :
+        m_packageId(std::move(packageId)), m_sourceId(std::move(sourceId))
+    {
+        size_t packageIdHash = std::hash<std::wstring_view>{}(m_packageId);
+        size_t sourceIdHash = std::hash<std::wstring_view>{}(m_sourceId);
+        m_hash = packageIdHash ^ (sourceIdHash + 0x9e3779b9 + (packageIdHash << 6) + (packageIdHash >> 2));
+    }
+
     bool OrchestratorQueueItemId::IsSame(const OrchestratorQueueItemId& comparedId) const
     {
-        return ((GetPackageId() == comparedId.GetPackageId()) && 
+        return ((m_hash == comparedId.m_hash) &&
+                (GetPackageId() == comparedId.GetPackageId()) && 
                 (GetSourceId() == comparedId.GetSourceId()));
     }
 
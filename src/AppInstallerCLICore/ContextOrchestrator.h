@@ -9,8 +9,10 @@
 #include "CompletionData.h"
 #include "Command.h"
 #include "COMContext.h"
+#include "AdaptiveConcurrency.h"
 
 #include <string_view>
+#include <unordered_map>
 
 namespace AppInstaller::CLI::Execution
 {
@@ -28,14 +30,23 @@ namespace AppInstaller::CLI::Execution
 
     struct OrchestratorQueueItemId
     {
-        OrchestratorQueueItemId(std::wstring packageId, std::wstring sourceId) : m_packageId(std::move(packageId)), m_sourceId(std::move(sourceId)) {}
+        OrchestratorQueueItemId(std::wstring packageId, std::wstring sourceId);
         std::wstring_view GetPackageId() const { return m_packageId; }
         std::wstring_view GetSourceId() const { return m_sourceId; }
 
         bool IsSame(const OrchestratorQueueItemId& comparisonQueueItemId) const;
+        bool operator==(const OrchestratorQueueItemId& other) const { return IsSame(other); }
+
+        // Hashes the id for use as a key in unordered containers; the value is computed once on construction.
+        struct Hash
+        {
+            size_t operator()(const OrchestratorQueueItemId& id) const { return id.m_hash; }
+        };
+
     private:
         std::wstring m_packageId;
         std::wstring m_sourceId;
+        size_t m_hash;
     };
 
     struct OrchestratorQueue;
@@ -115,7 +126,8 @@ namespace AppInstaller::CLI::Execution
 
     private:
         std::mutex m_queueLock;
-        void AddCommandQueue(std::string_view commandName, UINT32 allowedThreads);
+        void AddCommandQueue(std::string_view commandName, UINT32 allowedThreads, UINT32 maximumThreads = 0);
+        std::string_view GetCommandQueueName(const OrchestratorQueueItem& item) const;
         void RemoveItemInState(const OrchestratorQueueItem& item, OrchestratorQueueItemState state);
 
         _Requires_lock_held_(m_queueLock)
@@ -128,9 +140,10 @@ namespace AppInstaller::CLI::Execution
     // One of the queues used by the orchestrator.
     // All items in the queue execute the same command.
     // The queue allows multiple items to run at the same time, up to a limit.
+    // If the maximum is higher than the initial limit, the limit is tuned within it based on the throughput of the items.
     struct OrchestratorQueue
     {
-        OrchestratorQueue(std::string_view commandName, UINT32 allowedThreads);
+        OrchestratorQueue(std::string_view commandName, UINT32 allowedThreads, UINT32 maximumThreads = 0);
         ~OrchestratorQueue();
 
         // Name of the command this queue can execute
@@ -144,7 +157,7 @@ namespace AppInstaller::CLI::Execution
         // The item can be removed globally from the orchestrator, or from just this queue.
         bool RemoveItemInState(const OrchestratorQueueItem& item, OrchestratorQueueItemState state, bool isGlobalRemove);
 
-        // Finds an item by id, if it is in the queue.
+        // Finds an item by id, if it is in the queue. Lookups do not depend on the number of items queued.
         _Requires_lock_held_(m_queueLock)
         std::shared_ptr<OrchestratorQueueItem> FindById(const OrchestratorQueueItemId& queueItemId);
 
@@ -155,13 +168,21 @@ namespace AppInstaller::CLI::Execution
         // Enqueues an item.
         void EnqueueItem(std::shared_ptr<OrchestratorQueueItem> item);
 
+        // Feeds the result of an item into the concurrency controller, applying any change to the limit.
+        void RecordItemCompletion(const OrchestratorQueueItem& item);
+
+        using QueueItems = std::unordered_map<OrchestratorQueueItemId, std::shared_ptr<OrchestratorQueueItem>, OrchestratorQueueItemId::Hash>;
+
         _Requires_lock_held_(m_queueLock)
-        std::deque<std::shared_ptr<OrchestratorQueueItem>>::iterator FindIteratorById(const OrchestratorQueueItemId& comparisonQueueItemId);
+        QueueItems::iterator FindIteratorById(const OrchestratorQueueItemId& comparisonQueueItemId);
 
         std::string_view m_commandName;
 
         // Number of threads allowed to run items in this queue.
-        const UINT32 m_allowedThreads;
+        UINT32 m_allowedThreads;
+
+        // Tunes the number of threads allowed, if the queue is adaptive. Protected by m_queueLock.
+        std::optional<AdaptiveConcurrencyController> m_concurrencyController;
 
         // Thread pool for this queue, and associated objects.
         // All work items will be added to the callback environment, and the cleanup group
@@ -172,6 +193,9 @@ namespace AppInstaller::CLI::Execution
         wil::unique_any<PTP_CLEANUP_GROUP, decltype(CloseThreadpoolCleanupGroup), CloseThreadpoolCleanupGroup> m_threadPoolCleanupGroup;
 
         std::mutex m_queueLock;
-        std::deque<std::shared_ptr<OrchestratorQueueItem>> m_queueItems;
+
+        // Items are indexed by id, as every run, cancel and progress lookup is done by id.
+        // Items are run in the order their work is submitted to the thread pool, so the container need not keep that order.
+        QueueItems m_queueItems;
     };
 }
@@ -9,6 +9,10 @@
 #include "Commands/InstallCommand.h"
 #include "COMContext.h"
 #include <AppInstallerFileLogger.h>
+#include <winget/SourceUpdateScheduler.h>
+#include <winget/Tracing.h>
+#include <wil/win32_helpers.h>
+#include <iomanip>
 
 #ifndef AICLI_DISABLE_TEST_HOOKS
 #include <winget/Debugging.h>
@@ -46,6 +50,44 @@ namespace AppInstaller::CLI
         private:
             UINT m_previousCP = 0;
         };
+
+        // Hands the scheduled source updates to detached processes, so that this one does not wait on them to exit.
+        // Those processes coalesce with any other update of the same source and skip it if it is no longer out of date.
+        void LaunchScheduledSourceUpdates() try
+        {
+            std::vector<Repository::SourceDetails> pending = Repository::SourceUpdateScheduler::Instance().TakePending();
+            if (pending.empty())
+            {
+                return;
+            }
+
+            std::wstring executablePath;
+            THROW_IF_FAILED(wil::GetModuleFileNameW(nullptr, executablePath));
+
+            for (const auto& details : pending)
+            {
+                std::wostringstream argumentsStream;
+                argumentsStream << std::quoted(executablePath) << L" source update --scheduled --name " << std::quoted(Utility::ConvertToUTF16(details.Name));
+                std::wstring arguments = argumentsStream.str();
+
+                STARTUPINFOW startupInfo{};
+                startupInfo.cb = sizeof(startupInfo);
+                wil::unique_process_information processInformation;
+
+                // A new process group keeps the update running if the console that started this process is closed with Ctrl+C.
+                if (CreateProcessW(executablePath.c_str(), &arguments[0], nullptr, nullptr, FALSE, DETACHED_PROCESS | CREATE_NEW_PROCESS_GROUP, nullptr, nullptr, &startupInfo, &processInformation))
+                {
+                    AICLI_LOG(CLI, Info, << "Started process " << processInformation.dwProcessId << " to update source: " << details.Name);
+                }
+                else
+                {
+                    // The source will be found to be out of date again the next time it is opened.
+                    LOG_LAST_ERROR();
+                    AICLI_LOG(CLI, Warning, << "Failed to start the update of source: " << details.Name);
+                }
+            }
+        }
+        CATCH_LOG();
     }
 
     int CoreMain(int argc, wchar_t const** argv) try
@@ -69,8 +111,12 @@ namespace AppInstaller::CLI
         Logging::Log().EnableChannel(Logging::Channel::All);
         Logging::Log().SetLevel(Settings::User().Get<Settings::Setting::LoggingLevelPreference>());
         Logging::FileLogger::Add();
+        Logging::FileLogger::EnableFlushOnFailure();
         Logging::EnableWilFailureTelemetry();
 
+        // Stop the log writer here rather than leaving it to static destructors.
+        auto shutdownLogging = wil::scope_exit([]() { Logging::Log().Shutdown(); });
+
         // Set output to UTF8
         ConsoleOutputCPRestore utf8CP(CP_UTF8);
 
@@ -80,6 +126,9 @@ namespace AppInstaller::CLI
         // Initiate the background cleanup of the log file location.
         Logging::FileLogger::BeginCleanup();
 
+        // Update out of date sources once the command is complete rather than before using them.
+        Repository::SourceUpdateScheduler::Instance().EnableDeferredUpdates();
+
         context << Workflow::ReportExecutionStage(Workflow::ExecutionStage::ParseArgs);
 
         // Convert incoming wide char args to UTF8
@@ -121,6 +170,11 @@ namespace AppInstaller::CLI
                 Logging::Log().SetLevel(Logging::Level::Verbose);
             }
 
+            if (context.Args.Contains(Execution::Args::Type::TraceFile))
+            {
+                Logging::EnableTracing();
+            }
+
             context.UpdateForArgs();
             context.SetExecutingCommand(command.get());
             command->ValidateArguments(context.Args);
@@ -141,7 +195,32 @@ namespace AppInstaller::CLI
             return APPINSTALLER_CLI_ERROR_BLOCKED_BY_POLICY;
         }
 
-        return Execute(context, command);
+        int result = 0;
+
+        {
+            AICLI_TRACE_SPAN(CLI, command->FullName());
+            result = Execute(context, command);
+        }
+
+        // The command's output is complete, so the user is not waiting on these updates.
+        LaunchScheduledSourceUpdates();
+
+        if (context.Args.Contains(Execution::Args::Type::TraceFile))
+        {
+            Logging::DisableTracing();
+
+            try
+            {
+                Logging::WriteChromeTrace(Utility::ConvertToUTF16(context.Args.GetArg(Execution::Args::Type::TraceFile)));
+            }
+            catch (...)
+            {
+                LOG_CAUGHT_EXCEPTION_MSG("Failed to write the trace file");
+                context.Reporter.Warn() << Resource::String::TraceFileWriteFailed(Utility::LocIndView{ context.Args.GetArg(Execution::Args::Type::TraceFile) }) << std::endl;
+            }
+        }
+
+        return result;
     }
     // End of the line exceptions that are not ever expected.
     // Telemetry cannot be reliable beyond this point, so don't let these happen.
@@ -153,5 +232,15 @@ namespace AppInstaller::CLI
     void ServerInitialize()
     {
         AppInstaller::CLI::Execution::COMContext::SetLoggers();
+        AppInstaller::Logging::FileLogger::EnableFlushOnFailure();
+
+        // The server is long lived, so sources are kept up to date in the background rather than updated when callers connect.
+        AppInstaller::Repository::SourceUpdateScheduler::Instance().EnablePeriodicUpdates();
+    }
+
+    void ServerShutdown()
+    {
+        AppInstaller::Repository::SourceUpdateScheduler::Instance().Shutdown();
+        AppInstaller::Logging::Log().Shutdown();
     }
 }
@@ -58,10 +58,12 @@ namespace AppInstaller::CLI::Execution
             SourceType,
             SourceArg,
             ForceSourceReset,
+            ScheduledSourceUpdate, // Updates only sources that are still out of date and not being updated by another process
 
             //Hash Command
             HashFile,
             Msix, // Flag to indicate the input file is msix
+            HashOutputFormat, // The format in which the hashes are written
 
             //Validate Command
             ValidateManifest,
@@ -117,6 +119,7 @@ namespace AppInstaller::CLI::Execution
             DisableInteractivity, // Disable interactive prompts
             Wait, // Prompts the user to press any key before exiting
             OpenLogs, // Opens the default logs directory after executing the command
+            TraceFile, // Records spans of the command's work and writes them to the given file as a Chrome trace
             Force, // Forces the execution of the workflow with non security related issues
 
             DependencySource, // Index source to be queried against for finding dependencies
@@ -112,7 +112,7 @@ namespace AppInstaller::CLI::Execution
         template <>
         struct DataMapping<Data::Manifest>
         {
-            using value_t = Manifest::Manifest;
+            using value_t = Manifest::SharedManifest;
         };
 
         template <>
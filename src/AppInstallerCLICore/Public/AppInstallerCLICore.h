@@ -9,4 +9,7 @@ namespace AppInstaller::CLI
 
     // Initializes the Windows Package Manager COM server.
     void ServerInitialize();
+
+    // Shuts down the Windows Package Manager COM server, waiting for its background work to stop.
+    void ServerShutdown();
 }
@@ -175,6 +175,8 @@ namespace AppInstaller::CLI::Resource
         WINGET_DEFINE_RESOURCE_STRINGID(GetManifestResultVersionNotFound);
         WINGET_DEFINE_RESOURCE_STRINGID(HashCommandLongDescription);
         WINGET_DEFINE_RESOURCE_STRINGID(HashCommandShortDescription);
+        WINGET_DEFINE_RESOURCE_STRINGID(HashFileFailed);
+        WINGET_DEFINE_RESOURCE_STRINGID(HashOutputFormatArgumentDescription);
         WINGET_DEFINE_RESOURCE_STRINGID(HashOverrideArgumentDescription);
         WINGET_DEFINE_RESOURCE_STRINGID(HeaderArgumentDescription);
         WINGET_DEFINE_RESOURCE_STRINGID(HeaderArgumentNotApplicableForNonRestSourceWarning);
@@ -493,6 +495,7 @@ namespace AppInstaller::CLI::Resource
         WINGET_DEFINE_RESOURCE_STRINGID(SourceUpdateCommandLongDescription);
         WINGET_DEFINE_RESOURCE_STRINGID(SourceUpdateCommandShortDescription);
         WINGET_DEFINE_RESOURCE_STRINGID(SourceUpdateOne);
+        WINGET_DEFINE_RESOURCE_STRINGID(SourceUpdateScheduledArgumentDescription);
         WINGET_DEFINE_RESOURCE_STRINGID(StateDisabled);
         WINGET_DEFINE_RESOURCE_STRINGID(StateEnabled);
         WINGET_DEFINE_RESOURCE_STRINGID(StateHeader);
@@ -505,6 +508,8 @@ namespace AppInstaller::CLI::Resource
         WINGET_DEFINE_RESOURCE_STRINGID(ToolVersionArgumentDescription);
         WINGET_DEFINE_RESOURCE_STRINGID(TooManyArgError);
         WINGET_DEFINE_RESOURCE_STRINGID(TooManyBehaviorsError);
+        WINGET_DEFINE_RESOURCE_STRINGID(TraceArgumentDescription);
+        WINGET_DEFINE_RESOURCE_STRINGID(TraceFileWriteFailed);
         WINGET_DEFINE_RESOURCE_STRINGID(UnableToPurgeInstallDirectory);
         WINGET_DEFINE_RESOURCE_STRINGID(UnexpectedErrorExecutingCommand);
         WINGET_DEFINE_RESOURCE_STRINGID(UninstallAbandoned);
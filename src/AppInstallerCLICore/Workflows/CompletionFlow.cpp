@@ -2,6 +2,8 @@
 // Licensed under the MIT License.
 #include "pch.h"
 #include "CompletionFlow.h"
+#include "Microsoft/CompletionIndex.h"
+#include "Microsoft/PreIndexedPackageSourceFactory.h"
 
 namespace AppInstaller::CLI::Workflow
 {
@@ -10,6 +12,9 @@ namespace AppInstaller::CLI::Workflow
 
     namespace
     {
+        // The most values that will be output when completing from the completion indices.
+        constexpr size_t s_MaximumCompletionIndexResults = 50;
+
         // Outputs the completion string, wrapping it in quotes if needed.
         void OutputCompletionString(Execution::OutputStream& stream, std::string_view value)
         {
@@ -22,6 +27,108 @@ namespace AppInstaller::CLI::Workflow
                 stream << value << std::endl;
             }
         }
+
+        // Completes the value from the completion index of each targeted source that has one, without opening them.
+        // Returns the names of the targeted sources that could not be answered this way and must be searched instead,
+        // or nothing if no completion index could be used, in which case nothing is output.
+        // At most s_MaximumCompletionIndexResults distinct values are output, and none for an empty word.
+        std::optional<std::vector<std::string>> CompleteFromCompletionIndex(Execution::Context& context, Execution::Args::Type type)
+        {
+            Repository::PackageMatchField field = Repository::PackageMatchField::Unknown;
+
+            switch (type)
+            {
+            case Execution::Args::Type::Id:
+                field = Repository::PackageMatchField::Id;
+                break;
+            case Execution::Args::Type::Name:
+                field = Repository::PackageMatchField::Name;
+                break;
+            case Execution::Args::Type::Moniker:
+                field = Repository::PackageMatchField::Moniker;
+                break;
+            default:
+                return {};
+            }
+
+            // Other filters would be applied by the search; the completion index only knows about single fields.
+            for (auto filterArg : { Execution::Args::Type::Id, Execution::Args::Type::Name, Execution::Args::Type::Moniker,
+                Execution::Args::Type::ProductCode, Execution::Args::Type::Tag, Execution::Args::Type::Command, Execution::Args::Type::Count })
+            {
+                if (context.Args.Contains(filterArg))
+                {
+                    return {};
+                }
+            }
+
+            std::string_view sourceName;
+            if (context.Args.Contains(Execution::Args::Type::Source))
+            {
+                sourceName = context.Args.GetArg(Execution::Args::Type::Source);
+            }
+
+            std::vector<Repository::Microsoft::CompletionIndex> indices;
+            std::vector<std::string> remainingSources;
+
+            for (const auto& details : Repository::Source::GetCurrentSources())
+            {
+                if (!sourceName.empty() && !Utility::ICUCaseInsensitiveEquals(details.Name, sourceName))
+                {
+                    continue;
+                }
+
+                std::optional<Repository::Microsoft::CompletionIndex> index;
+                if (details.Type == Repository::Microsoft::PreIndexedPackageSourceFactory::Type())
+                {
+                    index = Repository::Microsoft::CompletionIndex::Open(Repository::Microsoft::PreIndexedPackageSourceFactory::GetCompletionIndexPath(details));
+                }
+
+                if (index)
+                {
+                    indices.emplace_back(std::move(index).value());
+                }
+                else
+                {
+                    remainingSources.emplace_back(details.Name);
+                }
+            }
+
+            if (indices.empty())
+            {
+                return {};
+            }
+
+            const std::string& word = context.Get<Data::CompletionData>().Word();
+            if (word.empty())
+            {
+                // Every value would match; rather than list entire indices or search every source, complete nothing.
+                AICLI_LOG(CLI, Verbose, << "Completion word empty, not completing from completion index");
+                return std::vector<std::string>{};
+            }
+
+            // The same value may be present in more than one index, so only output the first of each (case-insensitively).
+            std::set<std::string> foldedValues;
+            auto stream = context.Reporter.Completion();
+
+            for (const auto& index : indices)
+            {
+                for (const auto& value : index.FindByPrefix(field, word, s_MaximumCompletionIndexResults))
+                {
+                    if (foldedValues.size() >= s_MaximumCompletionIndexResults)
+                    {
+                        break;
+                    }
+
+                    if (foldedValues.emplace(Utility::FoldCase(value)).second)
+                    {
+                        OutputCompletionString(stream, value);
+                    }
+                }
+            }
+
+            AICLI_LOG(CLI, Verbose, << "Completed from " << indices.size() << " completion index(es); sources left to search: " << remainingSources.size());
+            return remainingSources;
+        }
     }
 
     void CompleteSourceName(Execution::Context& context)
@@ -103,6 +210,28 @@ namespace AppInstaller::CLI::Workflow
 
     void CompleteWithSingleSemanticsForValue::operator()(Execution::Context& context) const
     {
+        std::optional<std::vector<std::string>> remainingSources;
+
+        try
+        {
+            remainingSources = CompleteFromCompletionIndex(context, m_type);
+        }
+        CATCH_LOG_MSG("Failed to complete from completion index; falling back to search");
+
+        if (remainingSources)
+        {
+            if (remainingSources->empty())
+            {
+                return;
+            }
+
+            // Search only the sources that the completion indices could not answer.
+            context <<
+                Workflow::OpenSource(std::move(*remainingSources)) <<
+                CompleteWithSingleSemanticsForValueUsingExistingSource(m_type);
+            return;
+        }
+
         switch (m_type)
         {
         case Execution::Args::Type::Query:
@@ -23,13 +23,13 @@ namespace AppInstaller::CLI::Workflow
             DependencyPackageCandidate(
                 std::shared_ptr<Repository::IPackageVersion>&& packageVersion,
                 std::shared_ptr<Repository::IPackageVersion>&& installedPackageVersion,
-                Manifest::Manifest&& manifest,
+                Manifest::SharedManifest&& manifest,
                 Manifest::ManifestInstaller&& installer)
                 : PackageVersion(std::move(packageVersion)), InstalledPackageVersion(std::move(installedPackageVersion)), Manifest(std::move(manifest)), Installer(std::move(installer)) { }
 
             std::shared_ptr<Repository::IPackageVersion> PackageVersion;
             std::shared_ptr<Repository::IPackageVersion> InstalledPackageVersion;
-            Manifest::Manifest Manifest;
+            Manifest::SharedManifest Manifest;
             Manifest::ManifestInstaller Installer;
         };
     }
@@ -84,7 +84,7 @@ namespace AppInstaller::CLI::Workflow
     void GetInstallersDependenciesFromManifest(Execution::Context& context) {
         if (Settings::ExperimentalFeature::IsEnabled(Settings::ExperimentalFeature::Feature::Dependencies))
         {
-            const auto& manifest = context.Get<Execution::Data::Manifest>();
+            const Manifest::Manifest& manifest = context.Get<Execution::Data::Manifest>();
             DependencyList allDependencies;
 
             for (const auto& installer : manifest.Installers)
@@ -242,7 +242,7 @@ namespace AppInstaller::CLI::Workflow
 
         auto info = context.Reporter.Info();
         auto error = context.Reporter.Error();
-        const auto& rootManifest = context.Get<Execution::Data::Manifest>();
+        const Manifest::Manifest& rootManifest = context.Get<Execution::Data::Manifest>();
 
         Dependency rootAsDependency = Dependency(DependencyType::Package, rootManifest.Id, rootManifest.Version);
 
@@ -297,6 +297,13 @@ namespace AppInstaller::CLI::Workflow
         if (dependencyGraph.HasLoop())
         {
             context.Reporter.Warn() << Resource::String::DependenciesFlowContainsLoop;
+
+            std::string loop;
+            for (const auto& node : dependencyGraph.GetLoop())
+            {
+                loop.append(node.Id()).append(" -> ");
+            }
+            AICLI_LOG(CLI, Warning, << "Dependency loop: " << loop << "...");
         }
 
         const auto& installationOrder = dependencyGraph.GetInstallationOrder();
@@ -322,9 +329,9 @@ namespace AppInstaller::CLI::Workflow
                     itr->second.Installer.Locale);
 
                 Logging::Telemetry().LogManifestFields(
-                    itr->second.Manifest.Id,
-                    itr->second.Manifest.DefaultLocalization.Get<Manifest::Localization::PackageName>(),
-                    itr->second.Manifest.Version);
+                    itr->second.Manifest->Id,
+                    itr->second.Manifest->DefaultLocalization.Get<Manifest::Localization::PackageName>(),
+                    itr->second.Manifest->Version);
 
                 // Extract the data needed for installing
                 dependencyContext.Add<Execution::Data::PackageVersion>(itr->second.PackageVersion);
@@ -79,10 +79,10 @@ namespace AppInstaller::CLI::Workflow
         m_nodeManifest = m_nodePackageLatestVersion->GetManifest();
         m_nodeManifest.ApplyLocale();
 
-        if (m_nodeManifest.Installers.empty())
+        if (m_nodeManifest->Installers.empty())
         {
-            error << Resource::String::DependenciesFlowNoInstallerFound(Utility::LocIndView{ Utility::Normalize(m_nodeManifest.Id) });
-            AICLI_LOG(CLI, Error, << "Installer not found for manifest " << m_nodeManifest.Id << " with version" << m_nodeManifest.Version);
+            error << Resource::String::DependenciesFlowNoInstallerFound(Utility::LocIndView{ Utility::Normalize(m_nodeManifest->Id) });
+            AICLI_LOG(CLI, Error, << "Installer not found for manifest " << m_nodeManifest->Id << " with version" << m_nodeManifest->Version);
             return DependencyNodeProcessorResult::Error;
         }
 
@@ -97,10 +97,10 @@ namespace AppInstaller::CLI::Workflow
 
         if (!installer.has_value())
         {
-            auto manifestId = Utility::LocIndString{ Utility::Normalize(m_nodeManifest.Id) };
-            auto manifestVersion = Utility::LocIndString{ m_nodeManifest.Version };
+            auto manifestId = Utility::LocIndString{ Utility::Normalize(m_nodeManifest->Id) };
+            auto manifestVersion = Utility::LocIndString{ m_nodeManifest->Version };
             error << Resource::String::DependenciesFlowNoSuitableInstallerFound(manifestId, manifestVersion);
-            AICLI_LOG(CLI, Error, << "No suitable installer found for manifest " << m_nodeManifest.Id << " with version " << m_nodeManifest.Version);
+            AICLI_LOG(CLI, Error, << "No suitable installer found for manifest " << m_nodeManifest->Id << " with version " << m_nodeManifest->Version);
             return DependencyNodeProcessorResult::Error;
         }
 
@@ -30,7 +30,7 @@ namespace AppInstaller::CLI::Workflow
 
         std::shared_ptr<IPackageVersion> GetPackageInstalledVersion() { return m_nodePackageInstalledVersion; }
 
-        Manifest::Manifest GetManifest() { return m_nodeManifest;  }
+        Manifest::SharedManifest GetManifest() { return m_nodeManifest;  }
 
         Manifest::ManifestInstaller GetPreferredInstaller() { return m_installer; }
 
@@ -40,6 +40,6 @@ namespace AppInstaller::CLI::Workflow
         std::shared_ptr<IPackageVersion> m_nodePackageLatestVersion;
         std::shared_ptr<IPackageVersion> m_nodePackageInstalledVersion;
         Manifest::ManifestInstaller m_installer;
-        Manifest::Manifest m_nodeManifest;
+        Manifest::SharedManifest m_nodeManifest;
     };
 }
\ No newline at end of file
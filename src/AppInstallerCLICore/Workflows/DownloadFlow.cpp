@@ -7,6 +7,7 @@
 #include <AppInstallerMsixInfo.h>
 #include <winget/AdminSettings.h>
 #include <AppInstallerDownloader.h>
+#include <winget/Tracing.h>
 
 namespace AppInstaller::CLI::Workflow
 {
@@ -21,7 +22,7 @@ namespace AppInstaller::CLI::Workflow
         // Also creates the directory as necessary.
         std::filesystem::path GetInstallerBaseDownloadPath(Execution::Context& context)
         {
-            const auto& manifest = context.Get<Execution::Data::Manifest>();
+            const Manifest::Manifest& manifest = context.Get<Execution::Data::Manifest>();
 
             std::filesystem::path tempInstallerPath = Runtime::GetPathTo(Runtime::PathName::Temp);
             tempInstallerPath /= Utility::ConvertToUTF16(manifest.Id + '.' + manifest.Version);
@@ -77,7 +78,7 @@ namespace AppInstaller::CLI::Workflow
             }
             else
             {
-                const auto& manifest = context.Get<Execution::Data::Manifest>();
+                const Manifest::Manifest& manifest = context.Get<Execution::Data::Manifest>();
                 filename = Utility::ConvertToUTF16(manifest.Id + '.' + manifest.Version);
             }
 
@@ -115,8 +116,7 @@ namespace AppInstaller::CLI::Workflow
             if (std::filesystem::exists(filePath))
             {
                 AICLI_LOG(CLI, Info, << "Found existing installer file at '" << filePath << "'. Verifying file hash.");
-                std::ifstream inStream{ filePath, std::ifstream::binary };
-                fileHash = SHA256::ComputeHash(inStream);
+                fileHash = SHA256::ComputeHashFromFile(filePath);
 
                 if (SHA256::AreEqual(expectedHash, fileHash))
                 {
@@ -133,6 +133,8 @@ namespace AppInstaller::CLI::Workflow
 
     void DownloadInstaller(Execution::Context& context)
     {
+        AICLI_TRACE_SPAN(CLI, "Workflow::DownloadInstaller");
+
         // Check if file was already downloaded.
         // This may happen after a failed installation or if the download was done
         // separately before, e.g. on COM scenarios.
@@ -235,6 +237,9 @@ namespace AppInstaller::CLI::Workflow
         const auto& installer = context.Get<Execution::Data::Installer>().value();
         const auto& installerPath = context.Get<Execution::Data::InstallerPath>();
 
+        Logging::TraceSpan span{ Logging::Channel::CLI, "Workflow::DownloadInstallerFile" };
+        span.AddArgument("url", installer.Url);
+
         Utility::DownloadInfo downloadInfo{};
         downloadInfo.DisplayName = Resource::GetFixedString(Resource::FixedString::ProductName);
         // Use the SHA256 hash of the installer as the identifier for the download
@@ -325,7 +330,7 @@ namespace AppInstaller::CLI::Workflow
         {
             bool overrideHashMismatch = context.Args.Contains(Execution::Args::Type::HashOverride);
 
-            const auto& manifest = context.Get<Execution::Data::Manifest>();
+            const Manifest::Manifest& manifest = context.Get<Execution::Data::Manifest>();
             Logging::Telemetry().LogInstallerHashMismatch(manifest.Id, manifest.Version, manifest.Channel, hashPair.first, hashPair.second, overrideHashMismatch);
 
             // If running as admin, do not allow the user to override the hash failure.
@@ -408,8 +413,7 @@ namespace AppInstaller::CLI::Workflow
         {
             // Get the hash from the installer file
             const auto& installerPath = context.Get<Execution::Data::InstallerPath>();
-            std::ifstream inStream{ installerPath, std::ifstream::binary };
-            auto existingFileHash = SHA256::ComputeHash(inStream);
+            auto existingFileHash = SHA256::ComputeHashFromFile(installerPath);
             context.Add<Execution::Data::HashPair>(std::make_pair(installer.Sha256, existingFileHash));
         }
         else if (installer.EffectiveInstallerType() == InstallerTypeEnum::MSStore)
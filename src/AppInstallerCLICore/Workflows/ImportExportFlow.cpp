@@ -8,6 +8,8 @@
 #include "WorkflowBase.h"
 #include <winget/RepositorySearch.h>
 #include <winget/Runtime.h>
+#include <AppInstallerStrings.h>
+#include <unordered_map>
 
 namespace AppInstaller::CLI::Workflow
 {
@@ -117,7 +119,7 @@ namespace AppInstaller::CLI::Workflow
             AICLI_LOG(CLI, Info,
                 << "Installed package is available. Package Id [" << availablePackageVersion->GetProperty(PackageVersionProperty::Id) << "], Source [" << sourceDetails.Identifier << "]");
 
-            if (!availablePackageVersion->GetManifest().DefaultLocalization.Get<Manifest::Localization::Agreements>().empty())
+            if (!availablePackageVersion->GetManifest()->DefaultLocalization.Get<Manifest::Localization::Agreements>().empty())
             {
                 // Report that the package requires accepting license terms
                 AICLI_LOG(CLI, Warning, << "Package [" << installedPackageVersion->GetProperty(PackageVersionProperty::Name) << "] requires license agreement to install");
@@ -259,10 +261,46 @@ namespace AppInstaller::CLI::Workflow
                 AICLI_TERMINATE_CONTEXT(APPINSTALLER_CLI_ERROR_INTERNAL_ERROR);
             }
 
-            // Search for all the packages in the source.
-            // Each search is done in a sub context to search everything regardless of previous failures.
+            // Search for all the packages in the source at once, then give each package its own results.
+            // Each package is handled in a sub context to process everything regardless of previous failures.
             Repository::Source source{ context.Get<Execution::Data::Source>(), *sourceItr, CompositeSearchBehavior::AllPackages };
             AICLI_LOG(CLI, Info, << "Identifying packages requested from source [" << requiredSource.Details.Identifier << "]");
+
+            std::optional<SearchResult> sourceResult;
+            std::unordered_map<std::string, std::vector<size_t>> matchesById;
+
+            if (!requiredSource.Packages.empty())
+            {
+                SearchRequest sourceRequest;
+                for (const auto& packageRequest : requiredSource.Packages)
+                {
+                    sourceRequest.Inclusions.emplace_back(PackageMatchFilter(PackageMatchField::Id, MatchType::CaseInsensitive, packageRequest.Id.get()));
+                }
+
+                try
+                {
+                    sourceResult = source.Search(sourceRequest);
+                }
+                catch (...)
+                {
+                    // Packages fall back to being searched individually, which reports any errors against them.
+                    LOG_CAUGHT_EXCEPTION();
+                    AICLI_LOG(CLI, Warning, << "Failed to search for all packages from source [" << requiredSource.Details.Identifier << "]");
+                }
+
+                if (sourceResult)
+                {
+                    for (size_t i = 0; i < sourceResult->Matches.size(); ++i)
+                    {
+                        const auto& package = sourceResult->Matches[i].Package;
+                        if (package)
+                        {
+                            matchesById[Utility::FoldCase(package->GetProperty(PackageProperty::Id).get())].emplace_back(i);
+                        }
+                    }
+                }
+            }
+
             for (const auto& packageRequest : requiredSource.Packages)
             {
                 AICLI_LOG(CLI, Info, << "Searching for package [" << packageRequest.Id << "]");
@@ -278,6 +316,20 @@ namespace AppInstaller::CLI::Workflow
                 searchContext.Add<Execution::Data::Source>(source);
                 searchContext.Add<Execution::Data::SearchRequest>(std::move(searchRequest));
 
+                // Packages not found by the combined search are left to be searched on their own.
+                auto matchesItr = matchesById.find(Utility::FoldCase(packageRequest.Id.get()));
+                if (matchesItr != matchesById.end())
+                {
+                    SearchResult packageResult;
+                    for (size_t i : matchesItr->second)
+                    {
+                        packageResult.Matches.emplace_back(sourceResult->Matches[i]);
+                    }
+                    packageResult.Failures = sourceResult->Failures;
+
+                    searchContext.Add<Execution::Data::SearchResult>(std::move(packageResult));
+                }
+
                 if (packageRequest.Scope != Manifest::ScopeEnum::Unknown)
                 {
                     // TODO: In the future, it would be better to not have to convert back and forth from a string
@@ -35,7 +35,7 @@ namespace AppInstaller::CLI::Workflow
     // Inputs: PackageCollection, Sources, Source
     // Outputs: PackageSubContexts
     //   SubContext Inputs: None
-    //   SubContext Outputs: Source, SearchRequest
+    //   SubContext Outputs: Source, SearchRequest, SearchResult (if found by the combined search of its source)
     void GetSearchRequestsForImport(Execution::Context& context);
 
     // Installs all the packages found in the import file.
@@ -24,6 +24,7 @@
 #include <winget/Archive.h>
 #include <winget/PathVariable.h>
 #include <winget/Runtime.h>
+#include <winget/Tracing.h>
 
 using namespace winrt::Windows::Foundation;
 using namespace winrt::Windows::Foundation::Collections;
@@ -365,7 +366,7 @@ namespace AppInstaller::CLI::Workflow
     {
         if (!Settings::User().Get<Settings::Setting::DisableInstallNotes>())
         {
-            const auto& manifest = context.Get<Execution::Data::Manifest>();
+            const Manifest::Manifest& manifest = context.Get<Execution::Data::Manifest>();
             auto installationNotes = manifest.CurrentLocalization.Get<AppInstaller::Manifest::Localization::InstallationNotes>();
 
             if (!installationNotes.empty())
@@ -377,6 +378,9 @@ namespace AppInstaller::CLI::Workflow
 
     void ExecuteInstallerForType::operator()(Execution::Context& context) const
     {
+        Logging::TraceSpan span{ Logging::Channel::CLI, "Workflow::ExecuteInstaller" };
+        span.AddArgument("installerType", InstallerTypeToString(m_installerType));
+
         bool isUpdate = WI_IsFlagSet(context.GetFlags(), Execution::ContextFlag::InstallerExecutionUseUpdate);
         UpdateBehaviorEnum updateBehavior = context.Get<Execution::Data::Installer>().value().UpdateBehavior;
         bool doUninstallPrevious = isUpdate && (updateBehavior == UpdateBehaviorEnum::UninstallPrevious || context.Args.Contains(Execution::Args::Type::UninstallPrevious));
@@ -472,7 +476,7 @@ namespace AppInstaller::CLI::Workflow
         const auto& additionalSuccessCodes = context.Get<Execution::Data::Installer>()->InstallerSuccessCodes;
         if (installResult != 0 && (std::find(additionalSuccessCodes.begin(), additionalSuccessCodes.end(), installResult) == additionalSuccessCodes.end()))
         {
-            const auto& manifest = context.Get<Execution::Data::Manifest>();
+            const Manifest::Manifest& manifest = context.Get<Execution::Data::Manifest>();
             Logging::Telemetry().LogInstallerFailure(manifest.Id, manifest.Version, manifest.Channel, m_installerType, installResult);
 
             if (m_isHResult)
@@ -691,7 +695,7 @@ namespace AppInstaller::CLI::Workflow
             return;
         }
 
-        const auto& manifest = context.Get<Execution::Data::Manifest>();
+        const Manifest::Manifest& manifest = context.Get<Execution::Data::Manifest>();
         auto& arpCorrelationData = context.Get<Execution::Data::ARPCorrelationData>();
 
         arpCorrelationData.CapturePostInstallSnapshot();
@@ -780,8 +784,9 @@ namespace AppInstaller::CLI::Workflow
         if (context.Contains(Data::CorrelatedAppsAndFeaturesEntries))
         {
             // Use a new Installer entry
-            manifest.Installers.emplace_back();
-            manifest.Installers.back().AppsAndFeaturesEntries = context.Get<Data::CorrelatedAppsAndFeaturesEntries>();
+            auto& installers = manifest.Edit().Installers;
+            installers.emplace_back();
+            installers.back().AppsAndFeaturesEntries = context.Get<Data::CorrelatedAppsAndFeaturesEntries>();
         }
 
         auto trackingCatalog = context.Get<Data::PackageVersion>()->GetSource().GetTrackingCatalog();
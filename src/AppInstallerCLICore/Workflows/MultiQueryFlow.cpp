@@ -66,8 +66,11 @@ namespace AppInstaller::CLI::Workflow
         for (auto& searchContextPtr : context.Get<Execution::Data::PackageSubContexts>())
         {
             auto& searchContext = *searchContextPtr;
-            SearchRequest searchRequest = searchContext.Get<Execution::Data::SearchRequest>();
-            searchContext.Add<Execution::Data::SearchResult>(searchContext.Get<Execution::Data::Source>().Search(searchRequest));
+            if (!searchContext.Contains(Execution::Data::SearchResult))
+            {
+                SearchRequest searchRequest = searchContext.Get<Execution::Data::SearchRequest>();
+                searchContext.Add<Execution::Data::SearchResult>(searchContext.Get<Execution::Data::Source>().Search(searchRequest));
+            }
 
             switch (m_operationType)
             {
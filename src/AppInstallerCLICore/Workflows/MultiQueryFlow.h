@@ -19,7 +19,7 @@ namespace AppInstaller::CLI::Workflow
     // Required Args: a value indicating the purpose of the search
     // Inputs: PackageSubContexts
     // Outputs: None
-    //   SubContext Inputs: Source, SearchRequest
+    //   SubContext Inputs: Source, SearchRequest, SearchResult (optional; the search is skipped if present)
     //   SubContext Outputs: SearchResult
     struct SearchSubContextsForSingle : public WorkflowTask
     {
@@ -23,7 +23,7 @@ namespace AppInstaller::CLI::Workflow
 
         std::string GetPortableProductCode(Execution::Context& context)
         {
-            const std::string& packageId = context.Get<Execution::Data::Manifest>().Id;
+            const std::string& packageId = context.Get<Execution::Data::Manifest>()->Id;
 
             std::string source;
             if (context.Contains(Execution::Data::PackageVersion))
@@ -72,7 +72,7 @@ namespace AppInstaller::CLI::Workflow
 
     void VerifyPackageAndSourceMatch(Execution::Context& context)
     {
-        const std::string& packageIdentifier = context.Get<Execution::Data::Manifest>().Id;
+        const std::string& packageIdentifier = context.Get<Execution::Data::Manifest>()->Id;
 
         std::string sourceIdentifier;
         if (context.Contains(Execution::Data::PackageVersion))
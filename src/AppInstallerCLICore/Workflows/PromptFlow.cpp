@@ -138,7 +138,7 @@ namespace AppInstaller::CLI::Workflow
 
             bool PackageNeedsPrompt(Execution::Context& context) override
             {
-                const auto& agreements = context.Get<Execution::Data::Manifest>().CurrentLocalization.Get<AppInstaller::Manifest::Localization::Agreements>();
+                const auto& agreements = context.Get<Execution::Data::Manifest>()->CurrentLocalization.Get<AppInstaller::Manifest::Localization::Agreements>();
                 return !agreements.empty();
             }
 
@@ -169,7 +169,7 @@ namespace AppInstaller::CLI::Workflow
         private:
             void ShowPackageAgreements(Execution::Context& context)
             {
-                const auto& manifest = context.Get<Execution::Data::Manifest>();
+                const Manifest::Manifest& manifest = context.Get<Execution::Data::Manifest>();
                 auto agreements = manifest.CurrentLocalization.Get<AppInstaller::Manifest::Localization::Agreements>();
 
                 if (agreements.empty())
@@ -232,7 +232,7 @@ namespace AppInstaller::CLI::Workflow
                 if (context.Get<Execution::Data::Installer>()->InstallLocationRequired &&
                     !context.Args.Contains(Execution::Args::Type::InstallLocation))
                 {
-                    AICLI_LOG(CLI, Info, << "Package [" << context.Get<Execution::Data::Manifest>().Id << "] requires an install location.");
+                    AICLI_LOG(CLI, Info, << "Package [" << context.Get<Execution::Data::Manifest>()->Id << "] requires an install location.");
 
                     // An install location is required but one wasn't provided.
                     // Check if there is a default one from settings.
@@ -304,7 +304,7 @@ namespace AppInstaller::CLI::Workflow
             // and that the context does not already have an install location.
             void SetInstallLocation(Execution::Context& context)
             {
-                auto packageId = context.Get<Execution::Data::Manifest>().Id;
+                auto packageId = context.Get<Execution::Data::Manifest>()->Id;
                 auto installLocation = m_installLocation;
                 installLocation += "\\" + packageId;
                 AICLI_LOG(CLI, Info, << "Setting install location for package [" << packageId << "] to: " << installLocation);
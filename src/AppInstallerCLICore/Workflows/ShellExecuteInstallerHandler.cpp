@@ -157,7 +157,7 @@ namespace AppInstaller::CLI::Workflow
             }
             else
             {
-                const auto& manifest = context.Get<Execution::Data::Manifest>();
+                const Manifest::Manifest& manifest = context.Get<Execution::Data::Manifest>();
 
                 auto path = Runtime::GetPathTo(Runtime::PathName::DefaultLogLocation);
                 path /= Logging::FileLogger::DefaultPrefix();
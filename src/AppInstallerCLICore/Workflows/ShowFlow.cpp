@@ -76,7 +76,7 @@ namespace AppInstaller::CLI::Workflow
 
     void ShowPackageInfo(Execution::Context& context)
     {
-        const auto& manifest = context.Get<Execution::Data::Manifest>();
+        const Manifest::Manifest& manifest = context.Get<Execution::Data::Manifest>();
         auto info = context.Reporter.Info();
         // Get description from manifest so we can see if it is empty later
         auto description = manifest.CurrentLocalization.Get<Manifest::Localization::Description>();
@@ -219,7 +219,7 @@ namespace AppInstaller::CLI::Workflow
 
     void ShowManifestVersion(Execution::Context& context)
     {
-        const auto& manifest = context.Get<Execution::Data::Manifest>();
+        const Manifest::Manifest& manifest = context.Get<Execution::Data::Manifest>();
         Execution::TableOutput<2> table(context.Reporter, { Resource::String::ShowVersion, Resource::String::ShowChannel });
         table.OutputLine({ manifest.Version, manifest.Channel });
         table.Complete();
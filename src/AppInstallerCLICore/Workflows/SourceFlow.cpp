@@ -6,6 +6,7 @@
 #include "PromptFlow.h"
 #include "TableOutput.h"
 #include "WorkflowBase.h"
+#include <winget/SourceUpdateScheduler.h>
 
 namespace AppInstaller::CLI::Workflow
 {
@@ -209,6 +210,18 @@ namespace AppInstaller::CLI::Workflow
         }
     }
 
+    void RunScheduledSourceUpdates(Execution::Context& context)
+    {
+        auto& scheduler = Repository::SourceUpdateScheduler::Instance();
+
+        for (const auto& sd : context.Get<Data::SourceList>())
+        {
+            scheduler.Schedule(sd);
+        }
+
+        scheduler.RunPending();
+    }
+
     void RemoveSources(Execution::Context& context)
     {
         // TODO: We currently only allow removing a single source. If that changes,
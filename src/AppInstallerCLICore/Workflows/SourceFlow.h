@@ -48,6 +48,13 @@ namespace AppInstaller::CLI::Workflow
     // Outputs: None
     void UpdateSources(Execution::Context& context);
 
+    // Updates the sources in SourceList that are still out of date, as the source update scheduler would;
+    // a source that is being updated by another process is left to it.
+    // Required Args: None
+    // Inputs: SourceList
+    // Outputs: None
+    void RunScheduledSourceUpdates(Execution::Context& context);
+
     // Removes the sources in SourceList.
     // Required Args: None
     // Inputs: SourceList
@@ -26,8 +26,8 @@ namespace AppInstaller::CLI::Workflow
         {
             for (auto const& existing : packageSubContexts)
             {
-                if (existing->Get<Execution::Data::Manifest>().Id == packageContext->Get<Execution::Data::Manifest>().Id &&
-                    existing->Get<Execution::Data::Manifest>().Version == packageContext->Get<Execution::Data::Manifest>().Version &&
+                if (existing->Get<Execution::Data::Manifest>()->Id == packageContext->Get<Execution::Data::Manifest>()->Id &&
+                    existing->Get<Execution::Data::Manifest>()->Version == packageContext->Get<Execution::Data::Manifest>()->Version &&
                     existing->Get<Execution::Data::PackageVersion>()->GetProperty(PackageVersionProperty::SourceIdentifier) == packageContext->Get<Execution::Data::PackageVersion>()->GetProperty(PackageVersionProperty::SourceIdentifier))
                 {
                     return;
@@ -127,9 +127,9 @@ namespace AppInstaller::CLI::Workflow
                     installer->Locale);
 
                 Logging::Telemetry().LogManifestFields(
-                    manifest.Id,
-                    manifest.DefaultLocalization.Get<Manifest::Localization::PackageName>(),
-                    manifest.Version);
+                    manifest->Id,
+                    manifest->DefaultLocalization.Get<Manifest::Localization::PackageName>(),
+                    manifest->Version);
 
                 // Since we already did installer selection, just populate the context Data
                 manifest.ApplyLocale(installer->Locale);
@@ -189,7 +189,7 @@ namespace AppInstaller::CLI::Workflow
     {
         auto installedPackage = context.Get<Execution::Data::InstalledPackageVersion>();
         Utility::Version installedVersion = Utility::Version(installedPackage->GetProperty(PackageVersionProperty::Version));
-        Utility::Version updateVersion(context.Get<Execution::Data::Manifest>().Version);
+        Utility::Version updateVersion(context.Get<Execution::Data::Manifest>()->Version);
 
         if (!IsUpdateVersionAvailable(installedVersion, updateVersion))
         {
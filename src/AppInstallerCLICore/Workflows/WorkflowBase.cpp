@@ -61,13 +61,14 @@ namespace AppInstaller::CLI::Workflow
             out << std::endl;
         }
 
-        Repository::Source OpenNamedSource(Execution::Context& context, Utility::LocIndView sourceName)
+        // Opens the named source, or if sourceNames is not empty, those sources instead.
+        Repository::Source OpenNamedSource(Execution::Context& context, Utility::LocIndView sourceName, const std::vector<std::string>& sourceNames = {})
         {
             Repository::Source source;
 
             try
             {
-                source = Source{ sourceName };
+                source = sourceNames.empty() ? Source{ sourceName } : Source{ sourceNames };
 
                 if (!source)
                 {
@@ -325,7 +326,7 @@ namespace AppInstaller::CLI::Workflow
             }
         }
 
-        auto source = OpenNamedSource(context, Utility::LocIndView{ sourceName });
+        auto source = OpenNamedSource(context, Utility::LocIndView{ sourceName }, m_sourceNames);
         if (context.IsTerminated())
         {
             return;
@@ -1021,7 +1022,7 @@ namespace AppInstaller::CLI::Workflow
             requestedVersion = package->GetAvailableVersion(key);
         }
 
-        std::optional<Manifest::Manifest> manifest;
+        std::optional<Manifest::SharedManifest> manifest;
         if (requestedVersion)
         {
             manifest = requestedVersion->GetManifest();
@@ -1043,7 +1044,7 @@ namespace AppInstaller::CLI::Workflow
             AICLI_TERMINATE_CONTEXT(APPINSTALLER_CLI_ERROR_NO_MANIFEST_FOUND);
         }
 
-        Logging::Telemetry().LogManifestFields(manifest->Id, manifest->DefaultLocalization.Get<Manifest::Localization::PackageName>(), manifest->Version);
+        Logging::Telemetry().LogManifestFields(manifest->Get().Id, manifest->Get().DefaultLocalization.Get<Manifest::Localization::PackageName>(), manifest->Get().Version);
 
         std::string targetLocale;
         if (context.Args.Contains(Execution::Args::Type::Locale))
@@ -1122,13 +1123,13 @@ namespace AppInstaller::CLI::Workflow
 
     void ReportManifestIdentity(Execution::Context& context)
     {
-        const auto& manifest = context.Get<Execution::Data::Manifest>();
+        const Manifest::Manifest& manifest = context.Get<Execution::Data::Manifest>();
         ReportIdentity(context, {}, Resource::String::ReportIdentityFound, manifest.CurrentLocalization.Get<Manifest::Localization::PackageName>(), manifest.Id);
     }
 
     void ReportManifestIdentityWithVersion::operator()(Execution::Context& context) const
     {
-        const auto& manifest = context.Get<Execution::Data::Manifest>();
+        const Manifest::Manifest& manifest = context.Get<Execution::Data::Manifest>();
         ReportIdentity(context, m_prefix, m_label, manifest.CurrentLocalization.Get<Manifest::Localization::PackageName>(), manifest.Id, manifest.Version, m_level);
     }
 
@@ -1193,7 +1194,7 @@ namespace AppInstaller::CLI::Workflow
 
     void SearchSourceUsingManifest(Execution::Context& context)
     {
-        const auto& manifest = context.Get<Execution::Data::Manifest>();
+        const Manifest::Manifest& manifest = context.Get<Execution::Data::Manifest>();
         auto source = context.Get<Execution::Data::Source>();
 
         // First try search using ProductId or PackageFamilyName
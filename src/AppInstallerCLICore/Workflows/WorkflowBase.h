@@ -85,10 +85,14 @@ namespace AppInstaller::CLI::Workflow
     {
         OpenSource(bool forDependencies = false) : WorkflowTask("OpenSource"), m_forDependencies(forDependencies) {}
 
+        // Opens only the given sources rather than the one selected by the arguments.
+        OpenSource(std::vector<std::string> sourceNames) : WorkflowTask("OpenSource"), m_forDependencies(false), m_sourceNames(std::move(sourceNames)) {}
+
         void operator()(Execution::Context& context) const override;
     
     private:
         bool m_forDependencies;
+        std::vector<std::string> m_sourceNames;
     };
 
     // Creates a source object for a source specified by name, and adds it to the list of open sources.
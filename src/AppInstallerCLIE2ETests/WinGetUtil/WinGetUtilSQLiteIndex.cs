@@ -152,6 +152,29 @@ namespace AppInstallerCLIE2ETests.WinGetUtil
             });
         }
 
+        /// <summary>
+        /// Test prepare for packaging with a completion index.
+        /// </summary>
+        [Test]
+        public void WinGetUtil_SQLiteIndex_PrepareForPackagingWithCompletionIndex()
+        {
+            string completionIndexPath = TestCommon.GetRandomTestFile(".idx");
+
+            this.SQLiteIndex((indexHandle) =>
+            {
+                // Add manifest
+                WinGetUtilWrapper.WinGetSQLiteIndexAddManifest(indexHandle, this.addManifestsFile, this.relativePath);
+
+                // Prepare for packaging
+                WinGetUtilWrapper.WinGetSQLiteIndexPrepareForPackagingV2(indexHandle, completionIndexPath);
+                Assert.True(File.Exists(completionIndexPath));
+
+                // Check consistency
+                WinGetUtilWrapper.WinGetSQLiteIndexCheckConsistency(indexHandle, out bool succeeded);
+                Assert.True(succeeded);
+            });
+        }
+
         /// <summary>
         /// Create and close an sqlite index file.
         /// </summary>
@@ -337,6 +337,14 @@ namespace AppInstallerCLIE2ETests.WinGetUtil
         [DllImport(DllName, CallingConvention = CallingConvention.StdCall, CharSet = CharSet.Unicode, PreserveSig = false)]
         public static extern void WinGetSQLiteIndexPrepareForPackaging(IntPtr index);
 
+        /// <summary>
+        /// WinGetSQLiteIndexPrepareForPackagingV2 from wingetutil.dll .
+        /// </summary>
+        /// <param name="index">Index.</param>
+        /// <param name="completionIndexPath">Completion index path.</param>
+        [DllImport(DllName, CallingConvention = CallingConvention.StdCall, CharSet = CharSet.Unicode, PreserveSig = false)]
+        public static extern void WinGetSQLiteIndexPrepareForPackagingV2(IntPtr index, string completionIndexPath);
+
         /// <summary>
         /// WinGetSQLiteIndexCheckConsistency from wingetutil.dll .
         /// </summary>
@@ -137,7 +137,7 @@ struct ARPTestContext : public Context
     {
         REQUIRE(Logger->WasLogSuccessfulInstallARPChangeCalled);
 
-        const auto& manifest = Get<Data::Manifest>();
+        const Manifest::Manifest& manifest = Get<Data::Manifest>();
 
         REQUIRE(Source->GetIdentifier() == SourceIdentifier);
         REQUIRE(manifest.Id == PackageIdentifier);
@@ -0,0 +1,110 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+#include "pch.h"
+#include "TestCommon.h"
+
+#include <AdaptiveConcurrency.h>
+
+using namespace AppInstaller::CLI::Execution;
+using namespace std::chrono_literals;
+
+namespace
+{
+    constexpr uint64_t s_TenMegabytes = 10 * 1024 * 1024;
+
+    // Starts and then completes the given number of items, each with the given size, after the given time has passed.
+    // Returns the limit change reported by the last completion.
+    std::optional<uint32_t> CompleteItems(
+        AdaptiveConcurrencyController& controller,
+        AdaptiveConcurrencyController::clock::time_point& now,
+        uint32_t count,
+        std::chrono::milliseconds elapsed)
+    {
+        for (uint32_t i = 0; i < count; ++i)
+        {
+            controller.RecordStart(now);
+        }
+
+        now += elapsed;
+
+        std::optional<uint32_t> result;
+        for (uint32_t i = 0; i < count; ++i)
+        {
+            result = controller.RecordCompletion(s_TenMegabytes, now);
+        }
+
+        return result;
+    }
+}
+
+TEST_CASE("AdaptiveConcurrency_RaisesWhileThroughputGrows", "[concurrency]")
+{
+    AdaptiveConcurrencyController controller{ 2, 4 };
+    auto now = AdaptiveConcurrencyController::clock::now();
+
+    REQUIRE(controller.GetLimit() == 2);
+
+    // The first window sets the baseline and tries one more.
+    REQUIRE(CompleteItems(controller, now, 2, 1000ms) == 3u);
+    REQUIRE(controller.GetThroughput() == 2 * s_TenMegabytes);
+
+    // One more download added bandwidth, so try another.
+    REQUIRE(CompleteItems(controller, now, 3, 1000ms) == 4u);
+
+    // The fourth download only shared the existing bandwidth, so go back.
+    REQUIRE(CompleteItems(controller, now, 4, 2000ms) == 3u);
+    REQUIRE(controller.GetLimit() == 3);
+}
+
+TEST_CASE("AdaptiveConcurrency_BacksOffOnContention", "[concurrency]")
+{
+    AdaptiveConcurrencyController controller{ 3, 3 };
+    auto now = AdaptiveConcurrencyController::clock::now();
+
+    // Already at the maximum, so the limit stays put.
+    REQUIRE_FALSE(CompleteItems(controller, now, 3, 1000ms).has_value());
+    REQUIRE_FALSE(CompleteItems(controller, now, 3, 1000ms).has_value());
+
+    // Throughput dropped by more than a quarter at the same limit.
+    REQUIRE(CompleteItems(controller, now, 3, 3000ms) == 2u);
+    REQUIRE(controller.GetLimit() == 2);
+}
+
+TEST_CASE("AdaptiveConcurrency_RespectsBounds", "[concurrency]")
+{
+    AdaptiveConcurrencyController controller{ 5, 2 };
+    REQUIRE(controller.GetLimit() == 2);
+
+    AdaptiveConcurrencyController minimum{ 0, 0 };
+    REQUIRE(minimum.GetLimit() == 1);
+
+    auto now = AdaptiveConcurrencyController::clock::now();
+    REQUIRE_FALSE(CompleteItems(minimum, now, 1, 1000ms).has_value());
+    REQUIRE_FALSE(CompleteItems(minimum, now, 1, 5000ms).has_value());
+    REQUIRE(minimum.GetLimit() == 1);
+}
+
+TEST_CASE("AdaptiveConcurrency_ExcludesIdleTime", "[concurrency]")
+{
+    AdaptiveConcurrencyController controller{ 2, 2 };
+    auto now = AdaptiveConcurrencyController::clock::now();
+
+    REQUIRE_FALSE(CompleteItems(controller, now, 2, 1000ms).has_value());
+    REQUIRE(controller.GetThroughput() == 2 * s_TenMegabytes);
+
+    // The queue drained; the time until more work arrives is not transfer time.
+    now += 10s;
+    REQUIRE_FALSE(CompleteItems(controller, now, 2, 1000ms).has_value());
+    REQUIRE(controller.GetThroughput() == 2 * s_TenMegabytes);
+
+    // A partial window is dropped when the work drains, including through items that downloaded nothing.
+    controller.RecordStart(now);
+    controller.RecordStart(now);
+    now += 1000ms;
+    REQUIRE_FALSE(controller.RecordCompletion(s_TenMegabytes, now).has_value());
+    REQUIRE_FALSE(controller.RecordCompletion(0, now).has_value());
+
+    now += 10s;
+    REQUIRE_FALSE(CompleteItems(controller, now, 2, 1000ms).has_value());
+    REQUIRE(controller.GetThroughput() == 2 * s_TenMegabytes);
+}
@@ -0,0 +1,459 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+#include "pch.h"
+#include "Benchmarks.h"
+#include "TestCommon.h"
+#include "TestSource.h"
+#include "TestHooks.h"
+#include <AppInstallerSHA256.h>
+#include <CompositeSource.h>
+#include <Microsoft/SQLiteIndex.h>
+#include <Microsoft/SQLiteIndexSource.h>
+#include <PackageTrackingCatalogSourceFactory.h>
+
+#include <iomanip>
+#include <random>
+
+using namespace std::string_literals;
+using namespace std::string_view_literals;
+using namespace TestCommon;
+using namespace AppInstaller;
+using namespace AppInstaller::Manifest;
+using namespace AppInstaller::Repository;
+using namespace AppInstaller::Repository::Microsoft;
+using namespace AppInstaller::Utility;
+
+namespace
+{
+    // The default sizes of the generated indexes.
+    std::vector<size_t> s_PackageCounts = { 1'000, 10'000, 100'000 };
+
+    std::filesystem::path s_ResultsPath;
+
+    // The number of packages in the index that the running benchmarks use, recorded with their results.
+    size_t s_CurrentPackageCount = 0;
+
+    Json::Value s_Results{ Json::arrayValue };
+
+    // The additional measurements of the benchmarks, by benchmark name.
+    std::map<std::string, Json::Value> s_Metrics;
+
+    constexpr std::string_view s_ItemsPerRunMetric = "itemsPerRun"sv;
+
+    void RecordResult(const std::string& name, double meanNanoseconds, double lowerMeanNanoseconds, double upperMeanNanoseconds, double standardDeviationNanoseconds, size_t samples)
+    {
+        Json::Value result{ Json::objectValue };
+        result["name"] = name;
+        if (s_CurrentPackageCount)
+        {
+            result["packageCount"] = static_cast<Json::UInt64>(s_CurrentPackageCount);
+        }
+        result["meanNanoseconds"] = meanNanoseconds;
+        result["lowerMeanNanoseconds"] = lowerMeanNanoseconds;
+        result["upperMeanNanoseconds"] = upperMeanNanoseconds;
+        result["standardDeviationNanoseconds"] = standardDeviationNanoseconds;
+        result["samples"] = static_cast<Json::UInt64>(samples);
+        s_Results.append(std::move(result));
+    }
+
+    // Records an operation that is too expensive (or destructive) to be run repeatedly by BENCHMARK.
+    template <typename Operation>
+    void MeasureOnce(const std::string& name, Operation&& operation)
+    {
+        auto start = std::chrono::steady_clock::now();
+        operation();
+        std::chrono::duration<double, std::nano> duration = std::chrono::steady_clock::now() - start;
+
+        WARN(name << " [" << s_CurrentPackageCount << " packages]: " << std::chrono::duration_cast<std::chrono::milliseconds>(duration).count() << "ms");
+        RecordResult(name, duration.count(), duration.count(), duration.count(), 0, 1);
+    }
+
+    // Collects the results of the benchmarks and writes them out at the end of the run.
+    struct BenchmarkResultsListener : public Catch::TestEventListenerBase
+    {
+        using TestEventListenerBase::TestEventListenerBase;
+
+        void benchmarkEnded(Catch::BenchmarkStats<> const& stats) override
+        {
+            RecordResult(stats.info.name, stats.mean.point.count(), stats.mean.lower_bound.count(), stats.mean.upper_bound.count(),
+                stats.standardDeviation.point.count(), stats.samples.size());
+            Catch::TestEventListenerBase::benchmarkEnded(stats);
+        }
+
+        void testCaseEnded(Catch::TestCaseStats const& testCaseStats) override
+        {
+            s_CurrentPackageCount = 0;
+            Catch::TestEventListenerBase::testCaseEnded(testCaseStats);
+        }
+
+        void testRunEnded(Catch::TestRunStats const& testRunStats) override
+        {
+            if (!s_ResultsPath.empty() && !s_Results.empty())
+            {
+                for (auto& result : s_Results)
+                {
+                    auto metrics = s_Metrics.find(result["name"].asString());
+                    if (metrics == s_Metrics.end())
+                    {
+                        continue;
+                    }
+
+                    for (const auto& metric : metrics->second.getMemberNames())
+                    {
+                        result[metric] = metrics->second[metric];
+                    }
+
+                    double meanNanoseconds = result["meanNanoseconds"].asDouble();
+                    if (result.isMember(s_ItemsPerRunMetric.data()) && meanNanoseconds > 0)
+                    {
+                        result["itemsPerSecond"] = result[s_ItemsPerRunMetric.data()].asDouble() * 1'000'000'000 / meanNanoseconds;
+                    }
+                }
+
+                Json::Value root{ Json::objectValue };
+                root["results"] = s_Results;
+
+                Json::StreamWriterBuilder writerBuilder;
+                std::ofstream stream{ s_ResultsPath, std::ios::out | std::ios::trunc };
+                stream << Json::writeString(writerBuilder, root) << std::endl;
+            }
+
+            Catch::TestEventListenerBase::testRunEnded(testRunStats);
+        }
+    };
+    CATCH_REGISTER_LISTENER(BenchmarkResultsListener);
+
+    // The shape of the generated packages, chosen to loosely resemble a community repository:
+    // most packages have one or two versions and a few tags from a common vocabulary, while some have many.
+    constexpr size_t s_PackagesPerPublisher = 8;
+    constexpr double s_NoMoreVersionsProbability = 0.35;
+    constexpr size_t s_MaximumVersions = 50;
+    constexpr size_t s_MaximumTags = 6;
+    constexpr size_t s_TagVocabularySize = 2000;
+    constexpr double s_MeanTagIndex = 100;
+    constexpr double s_CommandProbability = 0.2;
+
+    // The number of packages used for the lookup benchmarks.
+    constexpr size_t s_LookupSampleSize = 1000;
+
+    struct SyntheticPackage
+    {
+        std::string Id;
+        std::string Publisher;
+        std::string Name;
+        std::string ProductCode;
+        std::string LatestVersion;
+    };
+
+    // A deterministic index of generated packages.
+    struct SyntheticIndex
+    {
+        SyntheticIndex(size_t packageCount) :
+            Index(SQLiteIndex::CreateNew(SQLITE_MEMORY_DB_CONNECTION_TARGET, Schema::Version::Latest()))
+        {
+            std::mt19937 random{ 42 };
+            std::geometric_distribution<size_t> additionalVersions{ s_NoMoreVersionsProbability };
+            std::uniform_int_distribution<size_t> tagCount{ 0, s_MaximumTags };
+            std::exponential_distribution<double> tagIndex{ 1 / s_MeanTagIndex };
+            std::bernoulli_distribution hasCommand{ s_CommandProbability };
+
+            Packages.reserve(packageCount);
+
+            for (size_t i = 0; i < packageCount; ++i)
+            {
+                SyntheticPackage& package = Packages.emplace_back();
+                package.Publisher = "Publisher" + std::to_string(i / s_PackagesPerPublisher);
+                package.Id = package.Publisher + ".Application" + std::to_string(i);
+                package.Name = "Application " + std::to_string(i);
+
+                std::ostringstream productCode;
+                productCode << '{' << std::hex << std::setw(8) << std::setfill('0') << i << "-0000-0000-0000-000000000000}";
+                package.ProductCode = productCode.str();
+
+                std::vector<NormalizedString> tags;
+                for (size_t j = tagCount(random); j > 0; --j)
+                {
+                    tags.emplace_back("tag" + std::to_string(std::min(static_cast<size_t>(tagIndex(random)), s_TagVocabularySize - 1)));
+                }
+
+                bool withCommand = hasCommand(random);
+                size_t versionCount = std::min(1 + additionalVersions(random), s_MaximumVersions);
+
+                for (size_t v = 0; v < versionCount; ++v)
+                {
+                    package.LatestVersion = std::to_string(1 + v / 10) + "." + std::to_string(v % 10) + ".0";
+
+                    Manifest::Manifest manifest;
+                    manifest.Id = package.Id;
+                    manifest.Version = package.LatestVersion;
+                    manifest.Moniker = "app" + std::to_string(i);
+                    manifest.DefaultLocalization.Add<Localization::PackageName>(package.Name);
+                    manifest.DefaultLocalization.Add<Localization::Publisher>(package.Publisher);
+                    manifest.DefaultLocalization.Add<Localization::Tags>(tags);
+                    manifest.Installers.push_back({});
+                    manifest.Installers[0].ProductCode = package.ProductCode;
+
+                    if (withCommand)
+                    {
+                        manifest.Installers[0].Commands = { "app" + std::to_string(i) };
+                    }
+
+                    Index.AddManifest(manifest, "manifests/" + package.Publisher + "/" + package.Id + "/" + package.LatestVersion + ".yaml");
+                }
+            }
+        }
+
+        // Gets the id rowids of a sample of the packages, spread across the index.
+        std::vector<std::pair<SQLite::rowid_t, const SyntheticPackage*>> GetLookupSample() const
+        {
+            std::vector<std::pair<SQLite::rowid_t, const SyntheticPackage*>> result;
+            size_t step = std::max<size_t>(1, Packages.size() / s_LookupSampleSize);
+
+            for (size_t i = 0; i < Packages.size(); i += step)
+            {
+                SearchRequest request;
+                request.Filters.emplace_back(PackageMatchField::Id, MatchType::Exact, Packages[i].Id);
+
+                auto searchResult = Index.Search(request);
+                REQUIRE(searchResult.Matches.size() == 1);
+                result.emplace_back(searchResult.Matches[0].first, &Packages[i]);
+            }
+
+            return result;
+        }
+
+        SQLiteIndex Index;
+        std::vector<SyntheticPackage> Packages;
+    };
+
+    // Gets a query value for the match type that finds the given package.
+    std::string GetQueryValue(MatchType type, const SyntheticPackage& package)
+    {
+        switch (type)
+        {
+        case MatchType::CaseInsensitive:
+            return Utility::ToLower(package.Id);
+        case MatchType::StartsWith:
+            return package.Publisher + ".";
+        case MatchType::Substring:
+            return package.Name.substr(package.Name.find(' ') + 1);
+        case MatchType::Fuzzy:
+        case MatchType::FuzzySubstring:
+            // Drop a character to make it inexact
+            return package.Name.substr(1);
+        default:
+            return package.Id;
+        }
+    }
+
+    void RunReadBenchmarks(const SyntheticIndex& synthetic, std::string_view suffix)
+    {
+        const SQLiteIndex& index = synthetic.Index;
+        const SyntheticPackage& target = synthetic.Packages[synthetic.Packages.size() / 2];
+
+        for (MatchType type : { MatchType::Exact, MatchType::CaseInsensitive, MatchType::StartsWith, MatchType::Fuzzy,
+            MatchType::Substring, MatchType::FuzzySubstring, MatchType::Wildcard })
+        {
+            SearchRequest request;
+            request.Query = RequestMatch(type, GetQueryValue(type, target));
+
+            BENCHMARK("SQLiteIndex.Search."s + std::string{ ToString(type) } + std::string{ suffix })
+            {
+                return index.Search(request);
+            };
+        }
+
+        auto sample = synthetic.GetLookupSample();
+        size_t next = 0;
+
+        BENCHMARK("SQLiteIndex.GetVersionKeysById"s + std::string{ suffix })
+        {
+            return index.GetVersionKeysById(sample[next++ % sample.size()].first);
+        };
+
+        BENCHMARK("SQLiteIndex.GetManifestIdByKey.Latest"s + std::string{ suffix })
+        {
+            return index.GetManifestIdByKey(sample[next++ % sample.size()].first, {}, {});
+        };
+
+        BENCHMARK("SQLiteIndex.GetManifestIdByKey.Version"s + std::string{ suffix })
+        {
+            const auto& entry = sample[next++ % sample.size()];
+            return index.GetManifestIdByKey(entry.first, entry.second->LatestVersion, {});
+        };
+    }
+}
+
+namespace TestCommon
+{
+    void BenchmarkSettings::SetPackageCount(size_t count)
+    {
+        s_PackageCounts = { count };
+    }
+
+    std::vector<size_t> BenchmarkSettings::GetPackageCounts()
+    {
+        return s_PackageCounts;
+    }
+
+    void BenchmarkSettings::SetResultsPath(const std::filesystem::path& path)
+    {
+        s_ResultsPath = path;
+    }
+
+    void BenchmarkMetrics::Add(const std::string& benchmark, const std::string& metric, double value)
+    {
+        s_Metrics[benchmark][metric] = value;
+    }
+
+    void BenchmarkMetrics::SetItemsPerRun(const std::string& benchmark, size_t items)
+    {
+        s_Metrics[benchmark][s_ItemsPerRunMetric.data()] = static_cast<Json::UInt64>(items);
+    }
+}
+
+TEST_CASE("Benchmark_SQLiteIndex", "[benchmark][.]")
+{
+    s_CurrentPackageCount = GENERATE(from_range(BenchmarkSettings::GetPackageCounts()));
+
+    std::unique_ptr<SyntheticIndex> synthetic;
+    MeasureOnce("SQLiteIndex.Generate", [&]() { synthetic = std::make_unique<SyntheticIndex>(s_CurrentPackageCount); });
+
+    RunReadBenchmarks(*synthetic, "");
+
+    BENCHMARK_ADVANCED("SQLiteIndex.AddManifest")(Catch::Benchmark::Chronometer meter)
+    {
+        static size_t s_added = 0;
+
+        std::vector<Manifest::Manifest> manifests(meter.runs());
+        for (auto& manifest : manifests)
+        {
+            manifest.Id = "Benchmark.Added" + std::to_string(s_added++);
+            manifest.Version = "1.0.0";
+            manifest.DefaultLocalization.Add<Localization::PackageName>("Added application");
+            manifest.DefaultLocalization.Add<Localization::Publisher>("Benchmark");
+            manifest.Installers.push_back({});
+        }
+
+        meter.measure([&](int i)
+            {
+                const auto& manifest = manifests[i];
+                return synthetic->Index.AddManifest(manifest, "manifests/added/" + manifest.Id + ".yaml");
+            });
+    };
+
+    MeasureOnce("SQLiteIndex.PrepareForPackaging", [&]() { synthetic->Index.PrepareForPackaging(); });
+
+    RunReadBenchmarks(*synthetic, ".Packaged");
+}
+
+TEST_CASE("Benchmark_CompositeSource_Correlation", "[benchmark][.]")
+{
+    // About the number of entries in Apps & Features on a well used machine.
+    constexpr size_t s_MaximumInstalledCount = 500;
+
+    s_CurrentPackageCount = GENERATE(from_range(BenchmarkSettings::GetPackageCounts()));
+
+    auto tracking = std::make_shared<SQLiteIndexSource>(SourceDetails{}, SQLiteIndex::CreateNew(SQLITE_MEMORY_DB_CONNECTION_TARGET));
+    TestSourceFactory trackingFactory{ [&](const SourceDetails&) { return tracking; } };
+    TestHook_SetSourceFactoryOverride(std::string{ PackageTrackingCatalogSourceFactory::Type() }, trackingFactory);
+    auto clearOverrides = wil::scope_exit([]() { TestHook_ClearSourceFactoryOverrides(); });
+
+    SyntheticIndex available{ s_CurrentPackageCount };
+
+    // Install packages spread across the available ones, which are found by their product codes.
+    SQLiteIndex installedIndex = SQLiteIndex::CreateNew(SQLITE_MEMORY_DB_CONNECTION_TARGET, Schema::Version::Latest(), SQLiteIndex::CreateOptions::SupportPathless);
+    size_t installedCount = std::min(available.Packages.size(), s_MaximumInstalledCount);
+    size_t step = available.Packages.size() / installedCount;
+
+    for (size_t i = 0; i < installedCount; ++i)
+    {
+        const SyntheticPackage& package = available.Packages[i * step];
+
+        Manifest::Manifest manifest;
+        manifest.Id = "ARP\\Machine\\X64\\" + package.ProductCode;
+        manifest.Version = package.LatestVersion;
+        manifest.DefaultLocalization.Add<Localization::PackageName>(package.Name);
+        manifest.DefaultLocalization.Add<Localization::Publisher>(package.Publisher);
+        manifest.Installers.push_back({});
+        manifest.Installers[0].ProductCode = package.ProductCode;
+
+        installedIndex.AddManifest(manifest);
+    }
+
+    SourceDetails installedDetails;
+    installedDetails.Identifier = "BenchmarkInstalled";
+    SourceDetails availableDetails;
+    availableDetails.Identifier = "BenchmarkAvailable";
+
+    CompositeSource composite{ "*Benchmark" };
+    composite.SetInstalledSource(Source{ std::make_shared<SQLiteIndexSource>(installedDetails, std::move(installedIndex), Synchronization::CrossProcessReaderWriteLock{}, true) });
+    composite.AddAvailableSource(Source{ std::make_shared<SQLiteIndexSource>(availableDetails, std::move(available.Index)) });
+
+    BENCHMARK("CompositeSource.Search.Installed")
+    {
+        return composite.Search(SearchRequest{});
+    };
+}
+
+TEST_CASE("Benchmark_SHA256", "[benchmark][.]")
+{
+    // The files hashed together by ComputeHashesFromFiles, as when verifying a set of downloads.
+    constexpr size_t s_FileCount = 8;
+
+    // From about the size of a manifest to that of a large installer.
+    size_t fileSize = GENERATE(as<size_t>{}, 4 * 1024, 1024 * 1024, 16 * 1024 * 1024, 64 * 1024 * 1024);
+    std::string suffix = "." + std::to_string(fileSize / 1024) + "KB";
+
+    TempDirectory directory{ "SHA256Benchmark" };
+    std::vector<std::filesystem::path> paths;
+
+    std::mt19937 random{ 42 };
+    std::string content(fileSize, '\0');
+    for (auto& c : content)
+    {
+        c = static_cast<char>(random());
+    }
+
+    for (size_t i = 0; i < s_FileCount; ++i)
+    {
+        std::filesystem::path& path = paths.emplace_back(directory.GetPath() / ("file" + std::to_string(i) + ".bin"));
+        std::ofstream stream{ path, std::ios::out | std::ios::trunc | std::ios::binary };
+        stream.write(content.data(), content.size());
+    }
+
+    // Throughput is reported in bytes per second.
+    std::string streamName = "SHA256.ComputeHash.ifstream" + suffix;
+    BenchmarkMetrics::SetItemsPerRun(streamName, fileSize);
+    BENCHMARK(streamName)
+    {
+        std::ifstream stream{ paths[0], std::ios::in | std::ios::binary };
+        return SHA256::ComputeHash(stream);
+    };
+
+    std::string fileName = "SHA256.ComputeHashFromFile" + suffix;
+    BenchmarkMetrics::SetItemsPerRun(fileName, fileSize);
+    BENCHMARK(fileName)
+    {
+        return SHA256::ComputeHashFromFile(paths[0]);
+    };
+
+    std::string sequentialName = "SHA256.ComputeHashFromFile.Sequential" + std::to_string(s_FileCount) + suffix;
+    BenchmarkMetrics::SetItemsPerRun(sequentialName, fileSize * s_FileCount);
+    BENCHMARK(sequentialName)
+    {
+        std::vector<SHA256::HashBuffer> result;
+        for (const auto& path : paths)
+        {
+            result.emplace_back(SHA256::ComputeHashFromFile(path));
+        }
+        return result;
+    };
+
+    std::string filesName = "SHA256.ComputeHashesFromFiles" + std::to_string(s_FileCount) + suffix;
+    BenchmarkMetrics::SetItemsPerRun(filesName, fileSize * s_FileCount);
+    BENCHMARK(filesName)
+    {
+        return SHA256::ComputeHashesFromFiles(paths);
+    };
+}
@@ -0,0 +1,33 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+#pragma once
+#include <filesystem>
+#include <string>
+#include <vector>
+
+namespace TestCommon
+{
+    // Settings for the benchmarks, which are hidden tests tagged [benchmark] that must be requested explicitly.
+    // For example: AppInstallerCLITests.exe [benchmark] -benchsize 10000 -benchout results.json
+    struct BenchmarkSettings
+    {
+        // Sets the number of packages in the generated indexes, replacing the default set of sizes.
+        static void SetPackageCount(size_t count);
+
+        // Gets the numbers of packages to generate indexes with.
+        static std::vector<size_t> GetPackageCounts();
+
+        // Sets the file that the results of the run are written to, as JSON.
+        static void SetResultsPath(const std::filesystem::path& path);
+    };
+
+    // Additional measurements written out with the results of the benchmarks.
+    struct BenchmarkMetrics
+    {
+        // Adds a measurement to the results of the named benchmark; it can be added before or after the benchmark runs.
+        static void Add(const std::string& benchmark, const std::string& metric, double value);
+
+        // Sets the number of items processed by each run of the named benchmark, from which its throughput is reported.
+        static void SetItemsPerRun(const std::string& benchmark, size_t items);
+    };
+}
@@ -1072,7 +1072,7 @@ void RequireExpectedResultsWithPin(std::shared_ptr<IPackage> package, const Expe
         if (result.LatestAvailableVersion.has_value())
         {
             REQUIRE(latestAvailable);
-            REQUIRE(latestAvailable->GetManifest().Version == result.LatestAvailableVersion.value());
+            REQUIRE(latestAvailable->GetManifest()->Version == result.LatestAvailableVersion.value());
         }
         else
         {
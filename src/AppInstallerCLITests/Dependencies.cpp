@@ -126,11 +126,114 @@ TEST_CASE("DependencyGraph_EasyToSeeLoop", "[dependencyGraph][dependencies]")
 
     REQUIRE(hasLoop);
 
+    auto loop = graph.GetLoop();
+    REQUIRE(loop.size() == 1);
+    REQUIRE(loop.at(0).Id() == "D");
+
     REQUIRE(installationOrder.size() == 2);
     REQUIRE(installationOrder.at(0).Id() == "D");
     REQUIRE(installationOrder.at(1).Id() == "EasyToSeeLoop");
 }
 
+namespace
+{
+    // Creates a graph of the given size where each node depends on the next two, so there are many paths to every node.
+    // If requested, the last node depends on the first one, closing a loop through all of them.
+    DependencyGraph CreateSyntheticGraph(size_t nodeCount, bool withLoop)
+    {
+        auto nodeName = [](size_t i) { return "Node" + std::to_string(i); };
+
+        DependencyList rootDependencies;
+        rootDependencies.Add(Dependency(DependencyType::Package, nodeName(1)));
+
+        return DependencyGraph(Dependency(DependencyType::Package, nodeName(0)), rootDependencies, [=](const Dependency& node)
+            {
+                DependencyList dependencyList;
+                size_t i = std::stoul(node.Id().substr(4));
+
+                for (size_t next = i + 1; next <= i + 2 && next < nodeCount; ++next)
+                {
+                    dependencyList.Add(Dependency(DependencyType::Package, nodeName(next)));
+                }
+
+                if (withLoop && i == nodeCount - 1)
+                {
+                    dependencyList.Add(Dependency(DependencyType::Package, nodeName(1)));
+                }
+
+                return dependencyList;
+            });
+    }
+}
+
+TEST_CASE("DependencyGraph_LargeGraph", "[dependencyGraph][dependencies]")
+{
+    constexpr size_t nodeCount = 10000;
+
+    SECTION("No loop")
+    {
+        DependencyGraph graph = CreateSyntheticGraph(nodeCount, false);
+        graph.BuildGraph();
+
+        REQUIRE_FALSE(graph.HasLoop());
+        REQUIRE(graph.GetLoop().empty());
+
+        // Each node comes after everything it depends on.
+        auto installationOrder = graph.GetInstallationOrder();
+        REQUIRE(installationOrder.size() == nodeCount);
+        for (size_t i = 0; i < nodeCount; ++i)
+        {
+            REQUIRE(installationOrder[i].Id() == "Node" + std::to_string(nodeCount - 1 - i));
+        }
+    }
+    SECTION("Loop")
+    {
+        DependencyGraph graph = CreateSyntheticGraph(nodeCount, true);
+        graph.BuildGraph();
+
+        REQUIRE(graph.HasLoop());
+        // The loop is found through whichever path reached the last node first.
+        auto loop = graph.GetLoop();
+        REQUIRE(loop.size() > 2);
+        REQUIRE(loop.front().Id() == "Node1");
+        REQUIRE(loop.back().Id() == "Node" + std::to_string(nodeCount - 1));
+        REQUIRE(graph.GetInstallationOrder().size() == nodeCount);
+    }
+}
+
+// Hide this test as it is only useful for measuring changes to the graph.
+TEST_CASE("DependencyGraph_MeasurePerformance", "[dependencyGraph][.]")
+{
+    constexpr size_t nodeCount = 10000;
+    constexpr size_t iterations = 10;
+
+    bool withLoop = GENERATE(false, true);
+
+    std::chrono::steady_clock::duration buildTime{};
+    std::chrono::steady_clock::duration checkTime{};
+
+    for (size_t i = 0; i < iterations; ++i)
+    {
+        DependencyGraph graph = CreateSyntheticGraph(nodeCount, withLoop);
+
+        auto start = std::chrono::steady_clock::now();
+        graph.BuildGraph();
+        auto built = std::chrono::steady_clock::now();
+        graph.CheckForLoopsAndGetOrder();
+        auto checked = std::chrono::steady_clock::now();
+
+        buildTime += built - start;
+        checkTime += checked - built;
+
+        REQUIRE(graph.HasLoop() == withLoop);
+    }
+
+    // This uses WARN to report as that is always shown regardless of the test result.
+    WARN("Nodes:                  " << nodeCount << (withLoop ? " (with loop)" : "") << '\n' <<
+         "Average build time:     " << std::chrono::duration_cast<std::chrono::microseconds>(buildTime).count() / iterations << "us\n" <<
+         "Average check time:     " << std::chrono::duration_cast<std::chrono::microseconds>(checkTime).count() / iterations << "us");
+}
+
 TEST_CASE("DependencyNodeProcessor_SkipInstalled", "[dependencies]")
 {
     TestCommon::TempFile installResultPath("TestExeInstalled.txt");
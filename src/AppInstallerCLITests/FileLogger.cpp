@@ -0,0 +1,228 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+#include "pch.h"
+#include "TestCommon.h"
+#include <AppInstallerFileLogger.h>
+#include <winget/MPSCRingBuffer.h>
+
+using namespace AppInstaller::Logging;
+using namespace AppInstaller::Utility;
+using namespace std::string_literals;
+using namespace TestCommon;
+
+namespace
+{
+    std::vector<std::string> ReadLines(const std::filesystem::path& path)
+    {
+        std::ifstream stream{ path };
+        std::vector<std::string> result;
+
+        for (std::string line; std::getline(stream, line);)
+        {
+            result.emplace_back(std::move(line));
+        }
+
+        return result;
+    }
+}
+
+TEST_CASE("MPSCRingBuffer_PushPop", "[logging]")
+{
+    MPSCRingBuffer<std::string> buffer{ 4 };
+
+    for (size_t i = 0; i < 4; ++i)
+    {
+        std::string value = std::to_string(i);
+        REQUIRE(buffer.TryPush(value));
+    }
+
+    std::string extra = "extra";
+    REQUIRE_FALSE(buffer.TryPush(extra));
+    REQUIRE(extra == "extra");
+
+    for (size_t i = 0; i < 4; ++i)
+    {
+        auto value = buffer.TryPop();
+        REQUIRE(value);
+        REQUIRE(value.value() == std::to_string(i));
+    }
+
+    REQUIRE_FALSE(buffer.TryPop());
+
+    // Wrap around the end of the buffer.
+    REQUIRE(buffer.TryPush(extra));
+    REQUIRE(buffer.TryPop().value() == "extra");
+}
+
+TEST_CASE("MPSCRingBuffer_InvalidCapacity", "[logging]")
+{
+    REQUIRE_THROWS(MPSCRingBuffer<int>{ 3 });
+}
+
+TEST_CASE("MPSCRingBuffer_MultipleProducers", "[logging]")
+{
+    constexpr size_t producerCount = 4;
+    constexpr size_t valuesPerProducer = 10000;
+
+    MPSCRingBuffer<size_t> buffer{ 64 };
+    std::vector<std::thread> producers;
+
+    for (size_t p = 0; p < producerCount; ++p)
+    {
+        producers.emplace_back([&buffer, p]()
+            {
+                for (size_t i = 0; i < valuesPerProducer; ++i)
+                {
+                    size_t value = p * valuesPerProducer + i;
+                    while (!buffer.TryPush(value))
+                    {
+                        std::this_thread::yield();
+                    }
+                }
+            });
+    }
+
+    std::vector<size_t> lastSeen(producerCount, 0);
+    std::vector<size_t> counts(producerCount, 0);
+    size_t received = 0;
+
+    while (received < producerCount * valuesPerProducer)
+    {
+        auto value = buffer.TryPop();
+        if (!value)
+        {
+            std::this_thread::yield();
+            continue;
+        }
+
+        size_t producer = value.value() / valuesPerProducer;
+        size_t index = value.value() % valuesPerProducer;
+
+        // Values from a single producer must arrive in order.
+        REQUIRE((counts[producer] == 0 || index > lastSeen[producer]));
+        lastSeen[producer] = index;
+        ++counts[producer];
+        ++received;
+    }
+
+    for (auto& producer : producers)
+    {
+        producer.join();
+    }
+
+    for (size_t count : counts)
+    {
+        REQUIRE(count == valuesPerProducer);
+    }
+}
+
+TEST_CASE("FileLogger_WritesAllLinesInOrder", "[logging]")
+{
+    TempFile logFile{ "FileLoggerTest"s, ".log"s };
+
+    {
+        FileLogger logger{ logFile.GetPath() };
+
+        // Write more than the queue holds to exercise draining on the calling thread.
+        for (size_t i = 0; i < 10000; ++i)
+        {
+            logger.Write(Channel::Test, Level::Verbose, std::to_string(i));
+        }
+
+        logger.WriteDirect(Channel::Test, Level::Verbose, "direct");
+    }
+
+    auto lines = ReadLines(logFile.GetPath());
+    REQUIRE(lines.size() == 10001);
+
+    for (size_t i = 0; i < 10000; ++i)
+    {
+        std::string expectedEnd = "[TEST] " + std::to_string(i);
+        REQUIRE(lines[i].size() > expectedEnd.size());
+        REQUIRE(lines[i].substr(lines[i].size() - expectedEnd.size()) == expectedEnd);
+    }
+
+    REQUIRE(lines.back() == "direct");
+}
+
+TEST_CASE("FileLogger_ErrorsAreFlushedImmediately", "[logging]")
+{
+    TempFile logFile{ "FileLoggerTest"s, ".log"s };
+    FileLogger logger{ logFile.GetPath() };
+
+    logger.Write(Channel::Test, Level::Info, "info");
+    logger.Write(Channel::Test, Level::Error, "error");
+
+    // Both lines are on disk without waiting for the background writer.
+    auto lines = ReadLines(logFile.GetPath());
+    REQUIRE(lines.size() == 2);
+}
+
+TEST_CASE("FileLogger_Shutdown", "[logging]")
+{
+    TempFile logFile{ "FileLoggerTest"s, ".log"s };
+    FileLogger logger{ logFile.GetPath() };
+
+    logger.Write(Channel::Test, Level::Info, "before");
+    logger.Shutdown();
+    REQUIRE(ReadLines(logFile.GetPath()).size() == 1);
+
+    // Once the writer has stopped, logs are written on the logging thread.
+    logger.Write(Channel::Test, Level::Info, "after");
+    REQUIRE(ReadLines(logFile.GetPath()).size() == 2);
+}
+
+TEST_CASE("FileLogger_WriteFormatted", "[logging]")
+{
+    TempFile logFile{ "FileLoggerTest"s, ".log"s };
+
+    {
+        FileLogger logger{ logFile.GetPath() };
+
+        LogFormatRecord record{ "Binding statement #{}-{}: {} => {}" };
+        record.AddArguments(size_t{ 1 }, size_t{ 2 }, 3, std::string{ "value" });
+        logger.WriteFormatted(Channel::Test, Level::Verbose, record);
+    }
+
+    auto lines = ReadLines(logFile.GetPath());
+    REQUIRE(lines.size() == 1);
+
+    std::string expectedEnd = "[TEST] Binding statement #1-2: 3 => value";
+    REQUIRE(lines[0].size() > expectedEnd.size());
+    REQUIRE(lines[0].substr(lines[0].size() - expectedEnd.size()) == expectedEnd);
+}
+
+TEST_CASE("LogFormatRecord_ToString", "[logging]")
+{
+    LogFormatRecord record{ "{} {} {} {} {} {{escaped}} {}" };
+    record.AddArguments(-5, 7u, true, "text", std::string_view{ "view" });
+    REQUIRE(record.ToString() == "-5 7 1 text view {escaped} {}");
+}
+
+TEST_CASE("LogFormatRecord_LargeStrings", "[logging]")
+{
+    std::string large(LogFormatRecord::StringBufferSize * 2, 'a');
+
+    LogFormatRecord record{ "{}|{}|{}" };
+    record.AddArguments("small", large, "after");
+    REQUIRE(record.ToString() == "small|" + large + "|after");
+}
+
+TEST_CASE("LogFormatRecord_TooManyArguments", "[logging]")
+{
+    LogFormatRecord record{ "{}{}{}{}{}{}{}{}{}" };
+    record.AddArguments(1, 2, 3, 4, 5, 6, 7, 8, 9);
+    REQUIRE(record.ArgumentCount() == LogFormatRecord::MaxArguments);
+    REQUIRE(record.ToString() == "12345678{}");
+}
+
+TEST_CASE("LoggingStream_MatchesStringStream", "[logging]")
+{
+    LoggingStream logging;
+    logging << "text " << std::string{ "string " } << std::string_view{ "view " } << 'c' << ' ' << -42 << ' ' << size_t{ 42 } << ' ' << true << ' ' << std::hex << 255 << ' ' << 1.5;
+
+    std::stringstream expected;
+    expected << "text " << std::string{ "string " } << std::string_view{ "view " } << 'c' << ' ' << -42 << ' ' << size_t{ 42 } << ' ' << true << ' ' << std::hex << 255 << ' ' << 1.5;
+
+    REQUIRE(logging.str() == expected.str());
+}
@@ -3,10 +3,12 @@
 #include "pch.h"
 #include "TestCommon.h"
 #include "Commands/HashCommand.h"
+#include <AppInstallerSHA256.h>
 
 using namespace std::string_literals;
 using namespace TestCommon;
 using namespace AppInstaller::CLI;
+using namespace AppInstaller::Utility;
 
 TEST_CASE("HashCommandWithTestMsix", "[Sha256Hash]")
 {
@@ -20,4 +22,73 @@ TEST_CASE("HashCommandWithTestMsix", "[Sha256Hash]")
 
     REQUIRE(hashOutput.str().find("Sha256: 6a2d3683fa19bf00e58e07d1313d20a5f5735ebbd6a999d33381d28740ee07ea") != std::string::npos);
     REQUIRE(hashOutput.str().find("SignatureSha256: 138781c3e6f635240353f3d14d1d57bdcb89413e49be63b375e6a5d7b93b0d07") != std::string::npos);
-}
\ No newline at end of file
+}
+
+namespace
+{
+    void WriteHashTestFile(const std::filesystem::path& path, const std::string& content)
+    {
+        std::ofstream out{ path, std::ofstream::binary };
+        out << content;
+    }
+}
+
+TEST_CASE("HashCommandWithDirectory_Json", "[Sha256Hash]")
+{
+    TempDirectory tempDirectory{ "hashdirectory"s };
+    std::filesystem::create_directories(tempDirectory.GetPath() / "sub");
+    WriteHashTestFile(tempDirectory.GetPath() / "first.txt", "first");
+    WriteHashTestFile(tempDirectory.GetPath() / "sub" / "second.bin", "second");
+
+    std::ostringstream hashOutput;
+    Execution::Context context{ hashOutput, std::cin };
+    context.Args.AddArg(Execution::Args::Type::HashFile, tempDirectory.GetPath().u8string());
+    context.Args.AddArg(Execution::Args::Type::HashOutputFormat, "json"s);
+    HashCommand hashCommand({});
+
+    hashCommand.Execute(context);
+    INFO(hashOutput.str());
+
+    REQUIRE_FALSE(context.IsTerminated());
+    REQUIRE(hashOutput.str().find("\"Sha256\" : \"" + SHA256::ConvertToString(SHA256::ComputeHash("first"s)) + "\"") != std::string::npos);
+    REQUIRE(hashOutput.str().find("\"Sha256\" : \"" + SHA256::ConvertToString(SHA256::ComputeHash("second"s)) + "\"") != std::string::npos);
+    REQUIRE(hashOutput.str().find("second.bin") != std::string::npos);
+}
+
+TEST_CASE("HashCommandWithWildcard_Csv", "[Sha256Hash]")
+{
+    TempDirectory tempDirectory{ "hashwildcard"s };
+    WriteHashTestFile(tempDirectory.GetPath() / "first.txt", "first");
+    WriteHashTestFile(tempDirectory.GetPath() / "second.txt", "second");
+    WriteHashTestFile(tempDirectory.GetPath() / "third.bin", "third");
+
+    std::ostringstream hashOutput;
+    Execution::Context context{ hashOutput, std::cin };
+    context.Args.AddArg(Execution::Args::Type::HashFile, (tempDirectory.GetPath() / "*.txt").u8string());
+    context.Args.AddArg(Execution::Args::Type::HashOutputFormat, "csv"s);
+    HashCommand hashCommand({});
+
+    hashCommand.Execute(context);
+    INFO(hashOutput.str());
+
+    REQUIRE_FALSE(context.IsTerminated());
+    REQUIRE(hashOutput.str().find("File,Sha256,SignatureSha256,Error") != std::string::npos);
+    REQUIRE(hashOutput.str().find("first.txt\"," + SHA256::ConvertToString(SHA256::ComputeHash("first"s)) + ",,") != std::string::npos);
+    REQUIRE(hashOutput.str().find("second.txt\"," + SHA256::ConvertToString(SHA256::ComputeHash("second"s)) + ",,") != std::string::npos);
+    REQUIRE(hashOutput.str().find("third.bin") == std::string::npos);
+}
+
+TEST_CASE("HashCommandWithWildcard_NoMatches", "[Sha256Hash]")
+{
+    TempDirectory tempDirectory{ "hashwildcard"s };
+
+    std::ostringstream hashOutput;
+    Execution::Context context{ hashOutput, std::cin };
+    context.Args.AddArg(Execution::Args::Type::HashFile, (tempDirectory.GetPath() / "*.txt").u8string());
+    HashCommand hashCommand({});
+
+    hashCommand.Execute(context);
+    INFO(hashOutput.str());
+
+    REQUIRE(context.GetTerminationHR() == HRESULT_FROM_WIN32(ERROR_FILE_NOT_FOUND));
+}
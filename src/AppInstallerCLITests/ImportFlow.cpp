@@ -5,6 +5,7 @@
 #include <Commands/ImportCommand.h>
 #include <Workflows/ImportExportFlow.h>
 
+using namespace std::string_view_literals;
 using namespace TestCommon;
 using namespace AppInstaller::CLI;
 using namespace AppInstaller::Repository;
@@ -298,3 +299,66 @@ TEST_CASE("ImportFlow_LicenseAgreement_NotAccepted", "[ImportFlow][workflow]")
     // Command should have failed
     REQUIRE_TERMINATED_WITH(context, APPINSTALLER_CLI_ERROR_PACKAGE_AGREEMENTS_NOT_ACCEPTED);
 }
+
+TEST_CASE("ImportFlow_SearchesEachSourceOnce", "[ImportFlow][workflow]")
+{
+    std::ostringstream importOutput;
+    TestContext context{ importOutput, std::cin };
+    auto previousThreadGlobals = context.SetForCurrentThread();
+
+    auto availableSource = std::make_shared<TestSource>();
+    size_t searchCount = 0;
+    availableSource->SearchFunction = [&](const SearchRequest& request)
+    {
+        ++searchCount;
+
+        SearchResult result;
+        for (const auto& inclusion : request.Inclusions)
+        {
+            for (std::string_view id : { "Test.First"sv, "Test.Second"sv })
+            {
+                if (AppInstaller::Utility::CaseInsensitiveEquals(inclusion.Value, id))
+                {
+                    AppInstaller::Manifest::Manifest manifest;
+                    manifest.Id = id;
+                    manifest.Version = "1.0";
+                    result.Matches.emplace_back(TestPackage::Make(std::vector<AppInstaller::Manifest::Manifest>{ manifest }, availableSource), inclusion);
+                }
+            }
+        }
+
+        return result;
+    };
+
+    PackageCollection::Source requiredSource{ availableSource->Details };
+    requiredSource.Packages.emplace_back(AppInstaller::Utility::LocIndString{ "Test.First"sv });
+    requiredSource.Packages.emplace_back(AppInstaller::Utility::LocIndString{ "test.second"sv });
+    requiredSource.Packages.emplace_back(AppInstaller::Utility::LocIndString{ "Test.Missing"sv });
+
+    PackageCollection packages;
+    packages.Sources.emplace_back(std::move(requiredSource));
+
+    context.Add<Execution::Data::Source>(Source{ std::make_shared<TestSource>() });
+    context.Add<Execution::Data::Sources>(std::vector<Source>{ Source{ availableSource } });
+    context.Add<Execution::Data::PackageCollection>(std::move(packages));
+
+    context << Workflow::GetSearchRequestsForImport;
+    INFO(importOutput.str());
+
+    REQUIRE_FALSE(context.IsTerminated());
+    REQUIRE(searchCount == 1);
+
+    auto& subContexts = context.Get<Execution::Data::PackageSubContexts>();
+    REQUIRE(subContexts.size() == 3);
+
+    REQUIRE(subContexts[0]->Contains(Execution::Data::SearchResult));
+    REQUIRE(subContexts[0]->Get<Execution::Data::SearchResult>().Matches.size() == 1);
+    REQUIRE(subContexts[0]->Get<Execution::Data::SearchResult>().Matches[0].Package->GetProperty(PackageProperty::Id) == "Test.First");
+
+    REQUIRE(subContexts[1]->Contains(Execution::Data::SearchResult));
+    REQUIRE(subContexts[1]->Get<Execution::Data::SearchResult>().Matches.size() == 1);
+    REQUIRE(subContexts[1]->Get<Execution::Data::SearchResult>().Matches[0].Package->GetProperty(PackageProperty::Id) == "Test.Second");
+
+    // Packages not found by the combined search are searched for individually later.
+    REQUIRE_FALSE(subContexts[2]->Contains(Execution::Data::SearchResult));
+}
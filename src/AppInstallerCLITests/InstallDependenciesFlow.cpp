@@ -104,9 +104,9 @@ TEST_CASE("DependencyGraph_validMinVersions", "[InstallFlow][workflow][dependenc
 
     REQUIRE(installOutput.str().find(Resource::LocString(Resource::String::DependenciesFlowContainsLoop)) == std::string::npos);
     REQUIRE(dependencyPackages.size() == 1);
-    REQUIRE(dependencyPackages.at(0)->Get<Execution::Data::Manifest>().Id == "minVersion");
+    REQUIRE(dependencyPackages.at(0)->Get<Execution::Data::Manifest>()->Id == "minVersion");
     // minVersion 1.5 is available but this requires 1.0 so that version is installed
-    REQUIRE(dependencyPackages.at(0)->Get<Execution::Data::Manifest>().Version == "1.0");
+    REQUIRE(dependencyPackages.at(0)->Get<Execution::Data::Manifest>()->Version == "1.0");
 }
 
 TEST_CASE("DependencyGraph_PathNoLoop", "[InstallFlow][workflow][dependencyGraph][dependencies]", )
@@ -133,10 +133,10 @@ TEST_CASE("DependencyGraph_PathNoLoop", "[InstallFlow][workflow][dependencyGraph
 
     // Verify installers are called in order
     REQUIRE(dependencyPackages.size() == 4);
-    REQUIRE(dependencyPackages.at(0)->Get<Execution::Data::Manifest>().Id == "B");
-    REQUIRE(dependencyPackages.at(1)->Get<Execution::Data::Manifest>().Id == "C");
-    REQUIRE(dependencyPackages.at(2)->Get<Execution::Data::Manifest>().Id == "G");
-    REQUIRE(dependencyPackages.at(3)->Get<Execution::Data::Manifest>().Id == "H");
+    REQUIRE(dependencyPackages.at(0)->Get<Execution::Data::Manifest>()->Id == "B");
+    REQUIRE(dependencyPackages.at(1)->Get<Execution::Data::Manifest>()->Id == "C");
+    REQUIRE(dependencyPackages.at(2)->Get<Execution::Data::Manifest>()->Id == "G");
+    REQUIRE(dependencyPackages.at(3)->Get<Execution::Data::Manifest>()->Id == "H");
 }
 
 TEST_CASE("DependencyGraph_StackOrderIsOk", "[InstallFlow][workflow][dependencyGraph][dependencies]")
@@ -0,0 +1,156 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+#include "pch.h"
+#include "TestCommon.h"
+#include <winget/JsonStreamingReader.h>
+
+using namespace AppInstaller::JSON;
+
+TEST_CASE("StreamingReader_ReadsValues", "[JsonStreamingReader]")
+{
+    std::string input = R"({ "String": "Value", "Int": 42, "Negative": -7, "Float": 1.5, "Bool": true, "Null": null, "Array": [ "a", 1, "b" ] })";
+    StreamingReader reader{ input };
+
+    REQUIRE(reader.BeginObject());
+
+    auto name = reader.NextMember();
+    REQUIRE(name);
+    REQUIRE(*name == "String");
+    REQUIRE(reader.ReadString() == "Value");
+
+    REQUIRE(reader.NextMember() == "Int");
+    REQUIRE(reader.ReadInt() == 42);
+
+    REQUIRE(reader.NextMember() == "Negative");
+    REQUIRE(reader.ReadInt() == -7);
+
+    REQUIRE(reader.NextMember() == "Float");
+    REQUIRE(!reader.ReadInt());
+
+    REQUIRE(reader.NextMember() == "Bool");
+    REQUIRE(reader.ReadBool() == true);
+
+    REQUIRE(reader.NextMember() == "Null");
+    REQUIRE(!reader.ReadString());
+
+    REQUIRE(reader.NextMember() == "Array");
+    REQUIRE(reader.ReadStringArray() == std::vector<std::string>{ "a", "b" });
+
+    REQUIRE(!reader.NextMember());
+    reader.EndDocument();
+}
+
+TEST_CASE("StreamingReader_Escapes", "[JsonStreamingReader]")
+{
+    std::string input = R"([ "Quote\" Slash\/ Backslash\\ Tab\t", "\u00e9\u4e2d", "\ud83d\ude00" ])";
+    StreamingReader reader{ input };
+
+    REQUIRE(reader.BeginArray());
+    REQUIRE(reader.NextElement());
+    REQUIRE(reader.ReadString() == "Quote\" Slash/ Backslash\\ Tab\t");
+    REQUIRE(reader.NextElement());
+    REQUIRE(reader.ReadString() == "\xC3\xA9\xE4\xB8\xAD");
+    REQUIRE(reader.NextElement());
+    REQUIRE(reader.ReadString() == "\xF0\x9F\x98\x80");
+    REQUIRE(!reader.NextElement());
+    reader.EndDocument();
+}
+
+TEST_CASE("StreamingReader_SkipValue", "[JsonStreamingReader]")
+{
+    std::string input = R"({ "Skipped": { "Nested": [ 1, "}]", { "Deep": null } ] }, "Next": "Value" })";
+    StreamingReader reader{ input };
+
+    REQUIRE(reader.BeginObject());
+    REQUIRE(reader.NextMember() == "Skipped");
+    REQUIRE(reader.SkipValue() == R"({ "Nested": [ 1, "}]", { "Deep": null } ] })");
+    REQUIRE(reader.NextMember() == "Next");
+    REQUIRE(reader.ReadString() == "Value");
+    REQUIRE(!reader.NextMember());
+    reader.EndDocument();
+}
+
+TEST_CASE("StreamingReader_TypeMismatchSkips", "[JsonStreamingReader]")
+{
+    std::string input = R"({ "Object": [ 1, 2 ], "Array": { "a": 1 }, "String": 3 })";
+    StreamingReader reader{ input };
+
+    REQUIRE(reader.BeginObject());
+    REQUIRE(reader.NextMember() == "Object");
+    REQUIRE(!reader.BeginObject());
+    REQUIRE(reader.NextMember() == "Array");
+    REQUIRE(!reader.BeginArray());
+    REQUIRE(reader.NextMember() == "String");
+    REQUIRE(!reader.ReadString());
+    REQUIRE(!reader.NextMember());
+    reader.EndDocument();
+}
+
+TEST_CASE("StreamingReader_InvalidInput", "[JsonStreamingReader]")
+{
+    auto readAll = [](std::string_view input)
+    {
+        StreamingReader reader{ input };
+        reader.SkipValue();
+        reader.EndDocument();
+    };
+
+    REQUIRE_THROWS_HR(readAll(""), APPINSTALLER_CLI_ERROR_JSON_INVALID_FILE);
+    REQUIRE_THROWS_HR(readAll(R"({ "a": 1 )"), APPINSTALLER_CLI_ERROR_JSON_INVALID_FILE);
+    REQUIRE_THROWS_HR(readAll(R"("unterminated)"), APPINSTALLER_CLI_ERROR_JSON_INVALID_FILE);
+    REQUIRE_THROWS_HR(readAll(R"(tru)"), APPINSTALLER_CLI_ERROR_JSON_INVALID_FILE);
+    REQUIRE_THROWS_HR(readAll(R"(1 2)"), APPINSTALLER_CLI_ERROR_JSON_INVALID_FILE);
+
+    // Skipped values are checked as strictly as those that are read.
+    REQUIRE_THROWS_HR(readAll(R"([ 1 })"), APPINSTALLER_CLI_ERROR_JSON_INVALID_FILE);
+    REQUIRE_THROWS_HR(readAll(R"([ 1 2 ])"), APPINSTALLER_CLI_ERROR_JSON_INVALID_FILE);
+    REQUIRE_THROWS_HR(readAll(R"({ "a" 1 })"), APPINSTALLER_CLI_ERROR_JSON_INVALID_FILE);
+    REQUIRE_THROWS_HR(readAll(R"({ 1: 2 })"), APPINSTALLER_CLI_ERROR_JSON_INVALID_FILE);
+    REQUIRE_THROWS_HR(readAll(R"([ nul ])"), APPINSTALLER_CLI_ERROR_JSON_INVALID_FILE);
+    REQUIRE_THROWS_HR(readAll(R"([ 1-2 ])"), APPINSTALLER_CLI_ERROR_JSON_INVALID_FILE);
+    REQUIRE_THROWS_HR(readAll(R"([ 1. ])"), APPINSTALLER_CLI_ERROR_JSON_INVALID_FILE);
+    REQUIRE_THROWS_HR(readAll(R"([ 1e ])"), APPINSTALLER_CLI_ERROR_JSON_INVALID_FILE);
+    REQUIRE_THROWS_HR(readAll(R"([ "\x" ])"), APPINSTALLER_CLI_ERROR_JSON_INVALID_FILE);
+    REQUIRE_THROWS_HR(readAll(R"([ "\u12G4" ])"), APPINSTALLER_CLI_ERROR_JSON_INVALID_FILE);
+    REQUIRE_NOTHROW(readAll(R"({ "a": [ -0.5e+3, 10, "\u00e9\n", true, null, {} ], "b": [] })"));
+
+    std::string unpairedSurrogate = R"("\ud83d")";
+    StreamingReader reader{ unpairedSurrogate };
+    REQUIRE_THROWS_HR(reader.ReadString(), APPINSTALLER_CLI_ERROR_JSON_INVALID_FILE);
+
+    std::string missingComma = R"({ "a": 1 "b": 2 })";
+    StreamingReader commaReader{ missingComma };
+    REQUIRE(commaReader.BeginObject());
+    REQUIRE(commaReader.NextMember() == "a");
+    REQUIRE(commaReader.ReadInt() == 1);
+    REQUIRE_THROWS_HR(commaReader.NextMember(), APPINSTALLER_CLI_ERROR_JSON_INVALID_FILE);
+}
+
+TEST_CASE("StreamingReader_ReadIntRange", "[JsonStreamingReader]")
+{
+    std::string input = R"([ 2147483647, -2147483648, 2147483648 ])";
+    StreamingReader reader{ input };
+
+    REQUIRE(reader.BeginArray());
+
+    REQUIRE(reader.NextElement());
+    REQUIRE(reader.ReadInt() == std::numeric_limits<int>::max());
+
+    REQUIRE(reader.NextElement());
+    REQUIRE(reader.ReadInt() == std::numeric_limits<int>::min());
+
+    REQUIRE(reader.NextElement());
+    REQUIRE_THROWS_HR(reader.ReadInt(), APPINSTALLER_CLI_ERROR_JSON_INVALID_FILE);
+
+    std::string tooSmall = "-2147483649";
+    StreamingReader tooSmallReader{ tooSmall };
+    REQUIRE_THROWS_HR(tooSmallReader.ReadInt(), APPINSTALLER_CLI_ERROR_JSON_INVALID_FILE);
+
+    std::string wayTooLarge = "99999999999999999999";
+    StreamingReader wayTooLargeReader{ wayTooLarge };
+    REQUIRE_THROWS_HR(wayTooLargeReader.ReadInt64(), APPINSTALLER_CLI_ERROR_JSON_INVALID_FILE);
+
+    std::string large = "4294967295";
+    StreamingReader largeReader{ large };
+    REQUIRE(largeReader.ReadInt64() == 4294967295);
+}
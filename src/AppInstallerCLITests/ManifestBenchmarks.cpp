@@ -0,0 +1,420 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+#include "pch.h"
+#include "Benchmarks.h"
+#include "TestCommon.h"
+#include <winget/ManifestSchemaValidation.h>
+#include <winget/ManifestValidation.h>
+#include <winget/ManifestYamlParser.h>
+#include <winget/Yaml.h>
+
+#include <iomanip>
+#include <malloc.h>
+#include <Psapi.h>
+
+using namespace std::string_literals;
+using namespace std::string_view_literals;
+using namespace TestCommon;
+using namespace AppInstaller;
+using namespace AppInstaller::Manifest;
+using namespace AppInstaller::Manifest::YamlParser;
+
+namespace
+{
+    // The heap use of the test binary, measured by its replacement of the global operator new and delete.
+    // Only the allocations made while a stage is measured are counted.
+    std::atomic<bool> s_MeasureAllocations = false;
+    std::atomic<size_t> s_AllocationCount = 0;
+    std::atomic<size_t> s_AllocatedBytes = 0;
+    std::atomic<size_t> s_PeakAllocatedBytes = 0;
+
+    void* AllocateMeasured(size_t size)
+    {
+        void* result = std::malloc(size == 0 ? 1 : size);
+        if (!result)
+        {
+            throw std::bad_alloc{};
+        }
+
+        if (s_MeasureAllocations)
+        {
+            ++s_AllocationCount;
+            size_t allocated = (s_AllocatedBytes += _msize(result));
+
+            size_t peak = s_PeakAllocatedBytes;
+            while (allocated > peak && !s_PeakAllocatedBytes.compare_exchange_weak(peak, allocated)) {}
+        }
+
+        return result;
+    }
+
+    void FreeMeasured(void* block) noexcept
+    {
+        if (!block)
+        {
+            return;
+        }
+
+        if (s_MeasureAllocations)
+        {
+            // Blocks allocated before the measurement started may be freed during it, so do not let the total wrap.
+            size_t size = _msize(block);
+            size_t allocated = s_AllocatedBytes;
+            while (!s_AllocatedBytes.compare_exchange_weak(allocated, allocated > size ? allocated - size : 0)) {}
+        }
+
+        std::free(block);
+    }
+}
+
+// The array and nothrow forms of these call the replaced ones.
+void* operator new(size_t size)
+{
+    return AllocateMeasured(size);
+}
+
+void operator delete(void* block) noexcept
+{
+    FreeMeasured(block);
+}
+
+void operator delete(void* block, size_t) noexcept
+{
+    FreeMeasured(block);
+}
+
+namespace
+{
+    // The number of manifests of each shape generated for each manifest version.
+    constexpr size_t s_CorpusSize = 100;
+    constexpr size_t s_LargeCorpusSize = 20;
+
+    // The large manifests have a locale manifest for each of these, and an installer for each
+    // combination of these locales, the architectures and the scopes.
+    constexpr std::string_view s_Locales[] = { "en-GB"sv, "fr-FR"sv, "de-DE"sv, "es-ES"sv, "it-IT"sv, "ja-JP"sv, "ko-KR"sv,
+        "zh-CN"sv, "zh-TW"sv, "pt-BR"sv, "ru-RU"sv, "nl-NL"sv, "pl-PL"sv, "sv-SE"sv, "tr-TR"sv, "cs-CZ"sv };
+    constexpr std::string_view s_Architectures[] = { "x64"sv, "x86"sv, "arm64"sv };
+    constexpr std::string_view s_Scopes[] = { "user"sv, "machine"sv };
+
+    enum class CorpusShape
+    {
+        // A single file manifest.
+        Singleton,
+        // A version, installer and default locale manifest.
+        MultiFile,
+        // A multi file manifest with many locale manifests and installers.
+        Large,
+    };
+
+    std::string_view ToString(CorpusShape shape)
+    {
+        switch (shape)
+        {
+        case CorpusShape::Singleton: return "Singleton"sv;
+        case CorpusShape::MultiFile: return "MultiFile"sv;
+        case CorpusShape::Large: return "Large"sv;
+        }
+
+        return "Unknown"sv;
+    }
+
+    struct CorpusDocument
+    {
+        std::string FileName;
+        std::string Content;
+        ManifestTypeEnum ManifestType;
+    };
+
+    // Writes the fields shared by the singleton and locale manifests.
+    void WriteLocaleFields(std::ostream& out, size_t index, std::string_view locale)
+    {
+        out << "PackageLocale: " << locale << "\n"
+            << "Publisher: Publisher " << index << " " << locale << "\n"
+            << "PublisherUrl: https://example.com/publisher" << index << "\n"
+            << "PackageName: Application " << index << " " << locale << "\n"
+            << "License: MIT License\n"
+            << "ShortDescription: Application " << index << " for benchmarking manifest parsing\n"
+            << "Description: A generated application, with a longer description of it in " << locale << "\n"
+            << "Tags:\n"
+            << "  - benchmark\n"
+            << "  - tag" << index % 10 << "\n"
+            << "  - " << locale << "\n";
+    }
+
+    // Writes the installers of the manifest, indented to the level of the Installers field.
+    void WriteInstallers(std::ostream& out, size_t index, CorpusShape shape)
+    {
+        size_t localeCount = (shape == CorpusShape::Large ? std::size(s_Locales) : 1);
+
+        out << "Installers:\n";
+
+        for (size_t l = 0; l < localeCount; ++l)
+        {
+            for (std::string_view architecture : s_Architectures)
+            {
+                for (std::string_view scope : s_Scopes)
+                {
+                    out << "  - Architecture: " << architecture << "\n"
+                        << "    InstallerLocale: " << s_Locales[l] << "\n"
+                        << "    InstallerType: msi\n"
+                        << "    Scope: " << scope << "\n"
+                        << "    InstallerUrl: https://example.com/app" << index << "/" << s_Locales[l] << "/" << architecture << "/" << scope << ".msi\n"
+                        << "    InstallerSha256: " << std::string(56, 'A') << std::hex << std::setw(8) << std::setfill('0') << index << std::dec << "\n"
+                        << "    ProductCode: \"{" << std::hex << std::setw(8) << std::setfill('0') << index << std::dec << "-0000-0000-0000-" << architecture << scope << s_Locales[l] << "}\"\n";
+                }
+            }
+        }
+    }
+
+    void WriteFooter(std::ostream& out, std::string_view manifestType, const ManifestVer& version)
+    {
+        out << "ManifestType: " << manifestType << "\n"
+            << "ManifestVersion: " << version.ToString() << "\n";
+    }
+
+    // Generates the documents of a manifest; the fields are those common to every supported manifest version.
+    std::vector<CorpusDocument> GenerateManifest(size_t index, CorpusShape shape, const ManifestVer& version)
+    {
+        std::vector<CorpusDocument> result;
+
+        std::ostringstream header;
+        header << "PackageIdentifier: Benchmark.Application" << index << "\n"
+            << "PackageVersion: " << 1 + index / 10 << "." << index % 10 << ".0\n";
+
+        auto addDocument = [&](std::string fileName, ManifestTypeEnum type, const std::function<void(std::ostream&)>& writeBody)
+        {
+            std::ostringstream out;
+            out << header.str();
+            writeBody(out);
+            result.emplace_back(CorpusDocument{ std::move(fileName), out.str(), type });
+        };
+
+        if (shape == CorpusShape::Singleton)
+        {
+            addDocument("Benchmark.yaml", ManifestTypeEnum::Singleton, [&](std::ostream& out)
+                {
+                    WriteLocaleFields(out, index, "en-US"sv);
+                    out << "Moniker: app" << index << "\n";
+                    WriteInstallers(out, index, shape);
+                    WriteFooter(out, "singleton"sv, version);
+                });
+
+            return result;
+        }
+
+        addDocument("Benchmark.yaml", ManifestTypeEnum::Version, [&](std::ostream& out)
+            {
+                out << "DefaultLocale: en-US\n";
+                WriteFooter(out, "version"sv, version);
+            });
+
+        addDocument("Benchmark.installer.yaml", ManifestTypeEnum::Installer, [&](std::ostream& out)
+            {
+                WriteInstallers(out, index, shape);
+                WriteFooter(out, "installer"sv, version);
+            });
+
+        addDocument("Benchmark.locale.en-US.yaml", ManifestTypeEnum::DefaultLocale, [&](std::ostream& out)
+            {
+                WriteLocaleFields(out, index, "en-US"sv);
+                out << "Moniker: app" << index << "\n";
+                WriteFooter(out, "defaultLocale"sv, version);
+            });
+
+        if (shape == CorpusShape::Large)
+        {
+            for (std::string_view locale : s_Locales)
+            {
+                addDocument("Benchmark.locale."s + std::string{ locale } + ".yaml", ManifestTypeEnum::Locale, [&](std::ostream& out)
+                    {
+                        WriteLocaleFields(out, index, locale);
+                        WriteFooter(out, "locale"sv, version);
+                    });
+            }
+        }
+
+        return result;
+    }
+
+    // The generated manifests of one shape and manifest version, both in memory and on disk.
+    struct Corpus
+    {
+        Corpus(CorpusShape shape, const ManifestVer& version) :
+            Directory("ManifestBenchmark")
+        {
+            size_t count = (shape == CorpusShape::Large ? s_LargeCorpusSize : s_CorpusSize);
+
+            for (size_t i = 0; i < count; ++i)
+            {
+                auto documents = GenerateManifest(i, shape, version);
+
+                // A singleton manifest is read from its file, and a multi file manifest from its directory.
+                std::filesystem::path manifestDirectory = Directory.GetPath() / std::to_string(i);
+                std::filesystem::create_directories(manifestDirectory);
+                Paths.emplace_back(documents.size() == 1 ? manifestDirectory / documents[0].FileName : manifestDirectory);
+
+                for (const auto& document : documents)
+                {
+                    std::ofstream stream{ manifestDirectory / document.FileName, std::ios::out | std::ios::trunc | std::ios::binary };
+                    stream << document.Content;
+                }
+
+                Documents.emplace_back(std::move(documents));
+            }
+        }
+
+        size_t size() const { return Documents.size(); }
+
+        TempDirectory Directory;
+        std::vector<std::vector<CorpusDocument>> Documents;
+        std::vector<std::filesystem::path> Paths;
+    };
+
+    std::vector<YamlManifestInfo> Load(const std::vector<CorpusDocument>& documents)
+    {
+        std::vector<YamlManifestInfo> result;
+
+        for (const auto& document : documents)
+        {
+            YamlManifestInfo& info = result.emplace_back();
+            info.Root = YAML::Load(document.Content);
+            info.FileName = document.FileName;
+            info.ManifestType = document.ManifestType;
+        }
+
+        return result;
+    }
+
+    size_t GetPrivateBytes()
+    {
+        PROCESS_MEMORY_COUNTERS_EX counters{};
+        THROW_IF_WIN32_BOOL_FALSE(GetProcessMemoryInfo(GetCurrentProcess(), reinterpret_cast<PROCESS_MEMORY_COUNTERS*>(&counters), sizeof(counters)));
+        return counters.PrivateUsage;
+    }
+
+    // Runs the stage once over the corpus to measure its memory use, then benchmarks it.
+    // The heap growth is the most that the stage allocated beyond what was allocated when it started,
+    // and the private bytes growth is what the process kept committed once it finished.
+    template <typename Stage>
+    void BenchmarkStage(const std::string& name, size_t manifestCount, Stage&& stage)
+    {
+        BenchmarkMetrics::SetItemsPerRun(name, manifestCount);
+
+        size_t privateBytesBefore = GetPrivateBytes();
+
+        s_AllocationCount = 0;
+        s_AllocatedBytes = 0;
+        s_PeakAllocatedBytes = 0;
+        s_MeasureAllocations = true;
+        stage();
+        s_MeasureAllocations = false;
+
+        size_t privateBytesAfter = GetPrivateBytes();
+
+        BenchmarkMetrics::Add(name, "allocationsPerItem", static_cast<double>(s_AllocationCount) / manifestCount);
+        BenchmarkMetrics::Add(name, "peakHeapGrowthBytes", static_cast<double>(s_PeakAllocatedBytes));
+        BenchmarkMetrics::Add(name, "privateBytesGrowthBytes", static_cast<double>(privateBytesAfter) - static_cast<double>(privateBytesBefore));
+
+        BENCHMARK(name)
+        {
+            return stage();
+        };
+    }
+}
+
+TEST_CASE("Benchmark_ManifestParsing", "[benchmark][.]")
+{
+    ManifestVer version{ GENERATE(s_ManifestVersionV1, s_ManifestVersionV1_1, s_ManifestVersionV1_2, s_ManifestVersionV1_4, s_ManifestVersionV1_5) };
+    CorpusShape shape = GENERATE(CorpusShape::Singleton, CorpusShape::MultiFile, CorpusShape::Large);
+
+    Corpus corpus{ shape, version };
+    std::string suffix = "." + version.ToString() + "." + std::string{ ToString(shape) };
+
+    ManifestValidateOption fullValidation;
+    fullValidation.FullValidation = true;
+
+    // Make sure that the corpus is valid, so that every stage does all of its work.
+    for (const auto& path : corpus.Paths)
+    {
+        REQUIRE_NOTHROW(YamlParser::CreateFromPath(path, fullValidation));
+    }
+
+    BenchmarkStage("Manifest.CreateFromPath" + suffix, corpus.size(), [&]()
+        {
+            size_t installers = 0;
+            for (const auto& path : corpus.Paths)
+            {
+                installers += YamlParser::CreateFromPath(path, fullValidation).Installers.size();
+            }
+            return installers;
+        });
+
+    BenchmarkStage("Manifest.Load" + suffix, corpus.size(), [&]()
+        {
+            size_t documents = 0;
+            for (const auto& manifest : corpus.Documents)
+            {
+                documents += Load(manifest).size();
+            }
+            return documents;
+        });
+
+    std::vector<std::vector<YamlManifestInfo>> loaded;
+    for (const auto& manifest : corpus.Documents)
+    {
+        loaded.emplace_back(Load(manifest));
+    }
+
+    BenchmarkStage("Manifest.ValidateAgainstSchema" + suffix, corpus.size(), [&]()
+        {
+            size_t errors = 0;
+            for (const auto& manifest : loaded)
+            {
+                errors += ValidateAgainstSchema(manifest, version).size();
+            }
+            return errors;
+        });
+
+    // Population only, without schema or semantic validation.
+    BenchmarkStage("Manifest.Populate" + suffix, corpus.size(), [&]()
+        {
+            size_t installers = 0;
+            for (auto& manifest : loaded)
+            {
+                installers += ParseManifest(manifest).Installers.size();
+            }
+            return installers;
+        });
+
+    std::vector<Manifest::Manifest> populated;
+    for (auto& manifest : loaded)
+    {
+        populated.emplace_back(ParseManifest(manifest));
+    }
+
+    BenchmarkStage("Manifest.ValidateManifest" + suffix, corpus.size(), [&]()
+        {
+            size_t errors = 0;
+            for (const auto& manifest : populated)
+            {
+                errors += ValidateManifest(manifest).size();
+            }
+            return errors;
+        });
+
+    // Merging includes population; the difference from the population stage is the cost of writing the merged manifest.
+    if (shape != CorpusShape::Singleton)
+    {
+        TempFile mergedFile{ "ManifestBenchmarkMerged", ".yaml" };
+
+        BenchmarkStage("Manifest.Merge" + suffix, corpus.size(), [&]()
+            {
+                size_t installers = 0;
+                for (auto& manifest : loaded)
+                {
+                    installers += ParseManifest(manifest, {}, mergedFile).Installers.size();
+                }
+                return installers;
+            });
+    }
+}
@@ -163,4 +163,34 @@ TEST_CASE("PinningIndex_AddDuplicatePin", "[pinningIndex]")
     index.AddPin(pin);
 
     REQUIRE_THROWS(index.AddPin(pin), ERROR_ALREADY_EXISTS);
-}
\ No newline at end of file
+}
+
+TEST_CASE("PinningIndex_PinLookup", "[pinningIndex]")
+{
+    TempFile tempFile{ "repolibtest_tempdb"s, ".db"s };
+    INFO("Using temporary file named: " << tempFile.GetPath());
+
+    Pin pin1 = Pin::CreateBlockingPin({ "pkg1", "src1" });
+    Pin pin2 = Pin::CreateGatingPin({ "pkg2", "src2" }, { "1.*"sv });
+
+    PinningIndex index = PinningIndex::CreateNew(tempFile, { 1, 0 });
+    index.AddPin(pin1);
+    index.AddPin(pin2);
+
+    // The lookup gives the same answers as querying the index
+    PinLookup pins{ index.GetAllPins() };
+    REQUIRE_FALSE(pins.Empty());
+
+    auto lookupPin1 = pins.GetPin(pin1.GetKey());
+    REQUIRE(lookupPin1.has_value());
+    REQUIRE(lookupPin1.value() == pin1);
+
+    auto lookupPin2 = pins.GetPin(pin2.GetKey());
+    REQUIRE(lookupPin2.has_value());
+    REQUIRE(lookupPin2.value() == pin2);
+    REQUIRE(lookupPin2->GetGatedVersion().IsValidVersion({ "1.2.3" }));
+    REQUIRE_FALSE(lookupPin2->GetGatedVersion().IsValidVersion({ "2.0" }));
+
+    REQUIRE_FALSE(pins.GetPin({ "pkg1", "src2" }).has_value());
+    REQUIRE_FALSE(pins.GetPin({ "PKG1", "src1" }).has_value());
+}
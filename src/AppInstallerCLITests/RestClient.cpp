@@ -5,6 +5,7 @@
 #include "TestRestRequestHandler.h"
 #include <Rest/RestClient.h>
 #include <Rest/Schema/IRestClient.h>
+#include <Rest/Schema/InformationResponseDeserializer.h>
 #include <AppInstallerVersions.h>
 #include <set>
 #include <AppInstallerErrors.h>
@@ -211,3 +212,41 @@ TEST_CASE("RestClientCreate_1.1_Success", "[RestSource]")
     REQUIRE(information.UnsupportedPackageMatchFields.size() == 1);
     REQUIRE(information.UnsupportedPackageMatchFields.at(0) == "Moniker");
 }
+
+TEST_CASE("RestClientCreateFromInformation_CachedResponse", "[RestSource]")
+{
+    utility::string_t sample = _XPLATSTR(
+        R"delimiter({
+            "Data" : {
+              "SourceIdentifier": "Source123",
+              "ServerSupportedVersions": [
+                "1.0.0",
+                "1.1.0"],
+              "SourceAgreements": {
+                "AgreementsIdentifier": "agreementV1",
+                "Agreements": [{
+                    "AgreementLabel": "EULA",
+                    "Agreement": "this is store agreement",
+                    "AgreementUrl": "https://store.agreement"
+                  }
+                ]
+              }
+        }})delimiter");
+
+    HttpClientHelper helper{ GetTestRestRequestHandler(web::http::status_codes::OK, sample) };
+    web::json::value response = RestClient::GetInformationResponse(utility::conversions::to_utf8string(TestRestUri), {}, {}, std::move(helper));
+
+    // Round trip the response as it is when cached with the source metadata
+    std::string cached = utility::conversions::to_utf8string(response.serialize());
+    IRestClient::Information information = InformationResponseDeserializer{}.Deserialize(web::json::value::parse(utility::conversions::to_string_t(cached)));
+
+    RestClient client = RestClient::CreateFromInformation(utility::conversions::to_utf8string(TestRestUri), information, {}, {});
+    REQUIRE(client.GetSourceIdentifier() == "Source123");
+    REQUIRE(client.GetSourceInformation().SourceAgreementsIdentifier == "agreementV1");
+}
+
+TEST_CASE("RestClientCreateFromInformation_UnsupportedVersion", "[RestSource]")
+{
+    IRestClient::Information information{ "Source123", { "2.0.0" } };
+    REQUIRE_THROWS_HR(RestClient::CreateFromInformation(utility::conversions::to_utf8string(TestRestUri), information, {}, {}), APPINSTALLER_CLI_ERROR_UNSUPPORTED_RESTSOURCE);
+}
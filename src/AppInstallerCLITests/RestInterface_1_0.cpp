@@ -413,7 +413,7 @@ TEST_CASE("Search_Optimized_ManifestResponse", "[RestSource][Interface_1_0]")
     REQUIRE(result.Matches[0].Versions[0].Manifest);
     
     // Verify manifest is populated
-    Manifest manifest = result.Matches[0].Versions[0].Manifest.value();
+    Manifest manifest = result.Matches[0].Versions[0].Manifest->Get();
     REQUIRE(manifest.Id == "Foo.Bar");
     REQUIRE(manifest.Version == "5.0.0");
     REQUIRE(manifest.DefaultLocalization.Locale == "en-us");
@@ -428,6 +428,59 @@ TEST_CASE("Search_Optimized_ManifestResponse", "[RestSource][Interface_1_0]")
     REQUIRE(manifest.Installers[0].Url == "https://installer.example.com/foobar.exe");
 }
 
+TEST_CASE("Search_Optimized_ManifestResponse_DeserializedOnUse", "[RestSource][Interface_1_0]")
+{
+    utility::string_t sample = _XPLATSTR(
+        R"delimiter({
+        "Data": {
+            "PackageIdentifier": "Foo.Bar",
+            "Versions": [
+                {
+                    "PackageVersion": "5.0.0",
+                    "DefaultLocale": {
+                        "PackageLocale": "en-us",
+                        "Publisher": "Foo",
+                        "PackageName": "Bar",
+                        "ShortDescription": "Foo bar description"
+                    },
+                    "Installers": [
+                        {
+                            "Architecture": "x64",
+                            "InstallerSha256": "011048877dfaef109801b3f3ab2b60afc74f3fc4f7b3430e0c897f5da1df84b6",
+                            "InstallerType": "exe",
+                            "InstallerUrl": "https://installer.example.com/foobar.exe"
+                        }
+                    ]
+                },
+                {
+                    "PackageVersion": "4.0.0"
+                }
+            ]
+        }
+    })delimiter");
+
+    HttpClientHelper helper{ GetTestRestRequestHandler(web::http::status_codes::OK, std::move(sample)) };
+    AppInstaller::Repository::SearchRequest request;
+    PackageMatchFilter filter{ PackageMatchField::Id, MatchType::Exact, "Foo.Bar" };
+    request.Filters.emplace_back(std::move(filter));
+    Interface v1{ TestRestUriString, std::move(helper) };
+    Schema::IRestClient::SearchResult result = v1.Search(request);
+    REQUIRE(result.Matches.size() == 1);
+    REQUIRE(result.Matches[0].PackageInformation.PackageIdentifier == "Foo.Bar");
+    REQUIRE(result.Matches[0].PackageInformation.PackageName == "Bar");
+    REQUIRE(result.Matches[0].PackageInformation.Publisher == "Foo");
+    REQUIRE(result.Matches[0].Versions.size() == 2);
+
+    // The invalid version only fails once its manifest is requested
+    const auto& validVersion = result.Matches[0].Versions[0];
+    REQUIRE(validVersion.VersionAndChannel.GetVersion().ToString() == "5.0.0");
+    REQUIRE(validVersion.Manifest->Get().Installers.size() == 1);
+
+    const auto& invalidVersion = result.Matches[0].Versions[1];
+    REQUIRE(invalidVersion.VersionAndChannel.GetVersion().ToString() == "4.0.0");
+    REQUIRE_THROWS_HR(invalidVersion.Manifest->Get(), APPINSTALLER_CLI_ERROR_RESTSOURCE_INVALID_DATA);
+}
+
 TEST_CASE("Search_Optimized_NoResponse_NotFoundCode", "[RestSource][Interface_1_0]")
 {
     HttpClientHelper helper{ GetTestRestRequestHandler(web::http::status_codes::NotFound) };
@@ -0,0 +1,226 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+#include "pch.h"
+#include "TestCommon.h"
+#include <AppInstallerSHA256.h>
+#include <winget/FileHashCache.h>
+
+using namespace AppInstaller::Utility;
+using namespace std::string_literals;
+using namespace TestCommon;
+
+namespace
+{
+    std::string MakeFileContent(size_t size, char seed)
+    {
+        std::string result(size, '\0');
+        for (size_t i = 0; i < size; ++i)
+        {
+            result[i] = static_cast<char>(seed + (i * 31) % 251);
+        }
+        return result;
+    }
+
+    void WriteContent(const std::filesystem::path& path, const std::string& content)
+    {
+        std::ofstream out{ path, std::ofstream::binary };
+        out << content;
+    }
+}
+
+TEST_CASE("SHA256_ComputeHash_KnownValues", "[SHA256]")
+{
+    REQUIRE(SHA256::ConvertToString(SHA256::ComputeHash(""s)) == "e3b0c44298fc1c149afbf4c8996fb92427ae41e4649b934ca495991b7852b855");
+    REQUIRE(SHA256::ConvertToString(SHA256::ComputeHash("abc"s)) == "ba7816bf8f01cfea414140de5dae2223b00361a396177a9cb410ff61f20015ad");
+
+    SHA256 hasher;
+    hasher.Add(reinterpret_cast<const uint8_t*>("a"), 1);
+    hasher.Add(reinterpret_cast<const uint8_t*>("bc"), 2);
+    REQUIRE(SHA256::ConvertToString(hasher.Get()) == "ba7816bf8f01cfea414140de5dae2223b00361a396177a9cb410ff61f20015ad");
+}
+
+TEST_CASE("SHA256_ComputeHashFromFile", "[SHA256]")
+{
+    // Cover an empty file, a file smaller than one read, and a file spanning several reads.
+    size_t size = GENERATE(0, 1000, 9 * 1024 * 1024 + 17);
+
+    TempFile tempFile{ "sha256"s, ".bin"s };
+    std::string content = MakeFileContent(size, 'a');
+    WriteContent(tempFile, content);
+
+    REQUIRE(SHA256::AreEqual(SHA256::ComputeHashFromFile(tempFile), SHA256::ComputeHash(content)));
+}
+
+TEST_CASE("SHA256_ComputeHashFromFile_MissingFile", "[SHA256]")
+{
+    TempFile tempFile{ "sha256"s, ".bin"s };
+    REQUIRE_THROWS(SHA256::ComputeHashFromFile(tempFile));
+}
+
+TEST_CASE("SHA256_ComputeHashesFromFiles", "[SHA256]")
+{
+    TempDirectory tempDirectory{ "sha256"s };
+    std::vector<std::filesystem::path> paths;
+    std::vector<SHA256::HashBuffer> expectedHashes;
+
+    for (size_t i = 0; i < 12; ++i)
+    {
+        std::string content = MakeFileContent(1024 * 1024 * i + i, static_cast<char>('a' + i));
+
+        std::filesystem::path path = tempDirectory.GetPath() / ("file"s + std::to_string(i) + ".bin"s);
+        WriteContent(path, content);
+
+        paths.emplace_back(std::move(path));
+        expectedHashes.emplace_back(SHA256::ComputeHash(content));
+    }
+
+    auto hashes = SHA256::ComputeHashesFromFiles(paths);
+    REQUIRE(hashes.size() == expectedHashes.size());
+
+    for (size_t i = 0; i < hashes.size(); ++i)
+    {
+        INFO(i);
+        REQUIRE(SHA256::AreEqual(hashes[i], expectedHashes[i]));
+    }
+
+    paths.emplace_back(tempDirectory.GetPath() / "missing.bin");
+    REQUIRE_THROWS(SHA256::ComputeHashesFromFiles(paths));
+}
+
+TEST_CASE("FileHashCache_ReusesUnchangedFiles", "[SHA256]")
+{
+    TempDirectory tempDirectory{ "filehashcache"s };
+    std::filesystem::path storagePath = tempDirectory.GetPath() / "cache.json";
+    std::filesystem::path filePath = tempDirectory.GetPath() / "file.bin";
+    std::filesystem::path missingPath = tempDirectory.GetPath() / "missing.bin";
+
+    WriteContent(filePath, "first"s);
+    auto lastWriteTime = std::filesystem::last_write_time(filePath);
+
+    {
+        FileHashCache cache{ storagePath };
+        auto hashes = cache.GetHashes({ filePath, missingPath });
+        REQUIRE(hashes.size() == 2);
+        REQUIRE(SUCCEEDED(hashes[0].Error));
+        REQUIRE(SHA256::AreEqual(hashes[0].Hash, SHA256::ComputeHash("first"s)));
+        REQUIRE(FAILED(hashes[1].Error));
+        cache.Save();
+    }
+
+    // Change the content without changing the size or last write time; the cached hash is still used.
+    WriteContent(filePath, "other"s);
+    std::filesystem::last_write_time(filePath, lastWriteTime);
+
+    {
+        FileHashCache cache{ storagePath };
+        auto hashes = cache.GetHashes({ filePath });
+        REQUIRE(SHA256::AreEqual(hashes[0].Hash, SHA256::ComputeHash("first"s)));
+    }
+
+    // Once the last write time changes, the file is hashed again.
+    std::filesystem::last_write_time(filePath, lastWriteTime + std::chrono::seconds(10));
+
+    {
+        FileHashCache cache{ storagePath };
+        auto hashes = cache.GetHashes({ filePath });
+        REQUIRE(SHA256::AreEqual(hashes[0].Hash, SHA256::ComputeHash("other"s)));
+    }
+}
+
+TEST_CASE("FileHashCache_EvictsOldestEntries", "[SHA256]")
+{
+    TempDirectory tempDirectory{ "filehashcache"s };
+    std::filesystem::path storagePath = tempDirectory.GetPath() / "cache.json";
+
+    std::vector<std::filesystem::path> paths;
+    std::vector<std::filesystem::file_time_type> lastWriteTimes;
+    for (size_t i = 0; i < 5; ++i)
+    {
+        paths.emplace_back(tempDirectory.GetPath() / ("file" + std::to_string(i) + ".bin"));
+        WriteContent(paths.back(), "first"s);
+        lastWriteTimes.emplace_back(std::filesystem::last_write_time(paths.back()));
+    }
+
+    {
+        FileHashCache cache{ storagePath, 4 };
+        cache.GetHashes({ paths[0], paths[1], paths[2], paths[3] });
+        cache.Save();
+    }
+
+    {
+        // Adding a hash to the full cache removes the oldest ones rather than all of them.
+        FileHashCache cache{ storagePath, 4 };
+        cache.GetHashes({ paths[4] });
+        cache.Save();
+    }
+
+    // The cache is written in place of the previous one, without leaving any other files behind.
+    REQUIRE(std::distance(std::filesystem::directory_iterator{ tempDirectory.GetPath() }, std::filesystem::directory_iterator{}) == 6);
+
+    // Change the content without changing the size or last write time; only the files still cached return the old hash.
+    for (size_t i = 0; i < paths.size(); ++i)
+    {
+        WriteContent(paths[i], "other"s);
+        std::filesystem::last_write_time(paths[i], lastWriteTimes[i]);
+    }
+
+    FileHashCache cache{ storagePath, 4 };
+    auto hashes = cache.GetHashes(paths);
+    auto first = SHA256::ComputeHash("first"s);
+
+    REQUIRE_FALSE(SHA256::AreEqual(hashes[0].Hash, first));
+    REQUIRE_FALSE(SHA256::AreEqual(hashes[1].Hash, first));
+    REQUIRE(SHA256::AreEqual(hashes[2].Hash, first));
+    REQUIRE(SHA256::AreEqual(hashes[3].Hash, first));
+    REQUIRE(SHA256::AreEqual(hashes[4].Hash, first));
+}
+
+TEST_CASE("FileHashCache_EvictsLeastRecentlyUsedEntries", "[SHA256]")
+{
+    TempDirectory tempDirectory{ "filehashcache"s };
+    std::filesystem::path storagePath = tempDirectory.GetPath() / "cache.json";
+
+    std::vector<std::filesystem::path> paths;
+    std::vector<std::filesystem::file_time_type> lastWriteTimes;
+    for (size_t i = 0; i < 5; ++i)
+    {
+        paths.emplace_back(tempDirectory.GetPath() / ("file" + std::to_string(i) + ".bin"));
+        WriteContent(paths.back(), "first"s);
+        lastWriteTimes.emplace_back(std::filesystem::last_write_time(paths.back()));
+    }
+
+    {
+        FileHashCache cache{ storagePath, 4 };
+        cache.GetHashes({ paths[0], paths[1], paths[2], paths[3] });
+        cache.Save();
+    }
+
+    {
+        // Using the first entry again makes it the most recent, and that must be saved even though nothing was hashed.
+        FileHashCache cache{ storagePath, 4 };
+        cache.GetHashes({ paths[0] });
+        cache.Save();
+    }
+
+    {
+        FileHashCache cache{ storagePath, 4 };
+        cache.GetHashes({ paths[4] });
+        cache.Save();
+    }
+
+    for (size_t i = 0; i < paths.size(); ++i)
+    {
+        WriteContent(paths[i], "other"s);
+        std::filesystem::last_write_time(paths[i], lastWriteTimes[i]);
+    }
+
+    FileHashCache cache{ storagePath, 4 };
+    auto hashes = cache.GetHashes(paths);
+    auto first = SHA256::ComputeHash("first"s);
+
+    REQUIRE(SHA256::AreEqual(hashes[0].Hash, first));
+    REQUIRE_FALSE(SHA256::AreEqual(hashes[1].Hash, first));
+    REQUIRE_FALSE(SHA256::AreEqual(hashes[2].Hash, first));
+    REQUIRE(SHA256::AreEqual(hashes[3].Hash, first));
+    REQUIRE(SHA256::AreEqual(hashes[4].Hash, first));
+}
@@ -6,6 +6,7 @@
 #include <PackageDependenciesValidation.h>
 #include <ArpVersionValidation.h>
 #include <Microsoft/SQLiteIndex.h>
+#include <Microsoft/CompletionIndex.h>
 #include <winget/Manifest.h>
 #include <AppInstallerStrings.h>
 
@@ -882,6 +883,82 @@ TEST_CASE("SQLiteIndex_ValidateManifestWithDependenciesNoSuitableMinVersion", "[
         APPINSTALLER_CLI_ERROR_DEPENDENCIES_VALIDATION_FAILED);
 }
 
+TEST_CASE("SQLiteIndex_ValidateManifestsWithDependencies", "[sqliteindex][V1_4]")
+{
+    TempFile tempFile{ "repolibtest_tempdb"s, ".db"s };
+    INFO("Using temporary file named: " << tempFile.GetPath());
+
+    Manifest levelOneManifest, levelTwoManifest, levelThreeManifest, topLevelManifest;
+    SQLiteIndex index = SimpleTestSetup(tempFile, levelThreeManifest, Schema::Version::Latest());
+
+    constexpr std::string_view levelTwoManifestPublisher = "LevelTwoManifest";
+    CreateFakeManifest(levelTwoManifest, levelTwoManifestPublisher);
+    levelTwoManifest.Installers[0].Dependencies.Add(Dependency(DependencyType::Package, levelThreeManifest.Id, "1.0.0"));
+    index.AddManifest(levelTwoManifest, GetPathFromManifest(levelTwoManifest));
+
+    REQUIRE(index.GetAllManifestVersions().size() == 2);
+    REQUIRE(index.GetAllDependencies().size() == 1);
+
+    // Neither of these is in the index, but the batch satisfies the dependency of one on the other.
+    constexpr std::string_view levelOneManifestPublisher = "LevelOneManifest";
+    CreateFakeManifest(levelOneManifest, levelOneManifestPublisher);
+    levelOneManifest.Installers[0].Dependencies.Add(Dependency(DependencyType::Package, levelTwoManifest.Id, "1.0.0"));
+
+    constexpr std::string_view topLevelManifestPublisher = "TopLevelManifest";
+    CreateFakeManifest(topLevelManifest, topLevelManifestPublisher);
+    topLevelManifest.Installers[0].Dependencies.Add(Dependency(DependencyType::Package, levelOneManifest.Id, "1.0.0"));
+
+    REQUIRE(PackageDependenciesValidation::ValidateManifestsDependencies(&index, { topLevelManifest, levelOneManifest }));
+
+    SECTION("Missing node")
+    {
+        REQUIRE_THROWS_HR(
+            PackageDependenciesValidation::ValidateManifestsDependencies(&index, { topLevelManifest }),
+            APPINSTALLER_CLI_ERROR_DEPENDENCIES_VALIDATION_FAILED);
+    }
+    SECTION("No suitable min version")
+    {
+        levelOneManifest.Installers[0].Dependencies.Clear();
+        levelOneManifest.Installers[0].Dependencies.Add(Dependency(DependencyType::Package, levelTwoManifest.Id, "2.0.0"));
+
+        REQUIRE_THROWS_HR(
+            PackageDependenciesValidation::ValidateManifestsDependencies(&index, { topLevelManifest, levelOneManifest }),
+            APPINSTALLER_CLI_ERROR_DEPENDENCIES_VALIDATION_FAILED);
+    }
+    SECTION("Loop")
+    {
+        // Updating the manifest in the index replaces its dependencies from the index.
+        levelThreeManifest.Installers[0].Dependencies.Add(Dependency(DependencyType::Package, topLevelManifest.Id, "1.0.0"));
+
+        REQUIRE_THROWS_HR(
+            PackageDependenciesValidation::ValidateManifestsDependencies(&index, { topLevelManifest, levelOneManifest, levelThreeManifest }),
+            APPINSTALLER_CLI_ERROR_DEPENDENCIES_VALIDATION_FAILED);
+    }
+    SECTION("Older version")
+    {
+        // A manifest older than the latest in the index has its own dependencies validated, but nothing depends on them.
+        Manifest olderManifest = levelThreeManifest;
+        olderManifest.Version = "0.5.0";
+        olderManifest.Installers[0].Dependencies.Add(Dependency(DependencyType::Package, topLevelManifest.Id, "1.0.0"));
+
+        REQUIRE(PackageDependenciesValidation::ValidateManifestsDependencies(&index, { topLevelManifest, levelOneManifest, olderManifest }));
+    }
+    SECTION("Two versions in the batch")
+    {
+        // The dependencies of the older version are validated even though the newer one is what dependents resolve to.
+        Manifest olderManifest = levelOneManifest;
+        olderManifest.Version = "0.5.0";
+        olderManifest.Installers[0].Dependencies.Add(Dependency(DependencyType::Package, "Missing.Package", "1.0.0"));
+
+        REQUIRE_THROWS_HR(
+            PackageDependenciesValidation::ValidateManifestsDependencies(&index, { topLevelManifest, olderManifest, levelOneManifest }),
+            APPINSTALLER_CLI_ERROR_DEPENDENCIES_VALIDATION_FAILED);
+        REQUIRE_THROWS_HR(
+            PackageDependenciesValidation::ValidateManifestsDependencies(&index, { topLevelManifest, levelOneManifest, olderManifest }),
+            APPINSTALLER_CLI_ERROR_DEPENDENCIES_VALIDATION_FAILED);
+    }
+}
+
 TEST_CASE("SQLiteIndex_ValidateManifestWhenManifestIsDependency_StructureBroken", "[sqliteindex][V1_4]")
 {
     TempFile tempFile{ "repolibtest_tempdb"s, ".db"s };
@@ -1649,6 +1726,87 @@ TEST_CASE("SQLiteIndex_PrepareForPackaging", "[sqliteindex]")
     index.PrepareForPackaging();
 }
 
+TEST_CASE("SQLiteIndex_PrepareForPackaging_CompletionIndex", "[sqliteindex]")
+{
+    TempFile tempFile{ "repolibtest_tempdb"s, ".db"s };
+    INFO("Using temporary file named: " << tempFile.GetPath());
+
+    TempFile completionFile{ "repolibtest_completion"s, ".idx"s };
+
+    Manifest manifest;
+    SQLiteIndex index = SimpleTestSetup(tempFile, manifest);
+
+    Manifest otherManifest;
+    CreateFakeManifest(otherManifest, "Other");
+    index.AddManifest(otherManifest, GetPathFromManifest(otherManifest));
+
+    index.PrepareForPackaging(completionFile.GetPath());
+
+    auto completion = CompletionIndex::Open(completionFile.GetPath());
+    REQUIRE(completion);
+
+    auto ids = completion->FindByPrefix(PackageMatchField::Id, "test");
+    REQUIRE(ids.size() == 1);
+    REQUIRE(ids[0] == manifest.Id);
+
+    auto names = completion->FindByPrefix(PackageMatchField::Name, "OTHER.ID N");
+    REQUIRE(names.size() == 1);
+    REQUIRE(names[0] == otherManifest.DefaultLocalization.Get<Localization::PackageName>());
+
+    auto allIds = completion->FindByPrefix(PackageMatchField::Id, "");
+    REQUIRE(allIds.size() == 2);
+    REQUIRE(allIds[0] == otherManifest.Id);
+    REQUIRE(allIds[1] == manifest.Id);
+
+    REQUIRE(completion->FindByPrefix(PackageMatchField::Id, "", 1).size() == 1);
+
+    // Both manifests share the same moniker
+    REQUIRE(completion->FindByPrefix(PackageMatchField::Moniker, "TestMon").size() == 1);
+
+    REQUIRE(completion->FindByPrefix(PackageMatchField::Id, "nomatch").empty());
+    REQUIRE(completion->FindByPrefix(PackageMatchField::Tag, "t").empty());
+}
+
+TEST_CASE("SQLiteIndex_CompletionIndex_ReplaceWhileMapped", "[sqliteindex]")
+{
+    TempFile completionFile{ "repolibtest_completion"s, ".idx"s };
+
+    CompletionIndex::Create({ { PackageMatchField::Id, { "First.Id" } } }, completionFile.GetPath());
+
+    {
+        auto first = CompletionIndex::Open(completionFile.GetPath());
+        REQUIRE(first);
+
+        // Replacing the file must succeed while a reader has it mapped, and the reader keeps its data.
+        CompletionIndex::Create({ { PackageMatchField::Id, { "Second.Id" } } }, completionFile.GetPath());
+
+        auto firstIds = first->FindByPrefix(PackageMatchField::Id, "");
+        REQUIRE(firstIds.size() == 1);
+        REQUIRE(firstIds[0] == "First.Id");
+
+        auto second = CompletionIndex::Open(completionFile.GetPath());
+        REQUIRE(second);
+
+        auto secondIds = second->FindByPrefix(PackageMatchField::Id, "");
+        REQUIRE(secondIds.size() == 1);
+        REQUIRE(secondIds[0] == "Second.Id");
+    }
+
+    // Once nothing has it mapped, the replaced file is removed by the next write.
+    CompletionIndex::Create({ { PackageMatchField::Id, { "Third.Id" } } }, completionFile.GetPath());
+
+    size_t fileCount = 0;
+    for (const auto& entry : std::filesystem::directory_iterator{ completionFile.GetPath().parent_path() })
+    {
+        if (entry.path().filename().u8string().rfind(completionFile.GetPath().filename().u8string(), 0) == 0)
+        {
+            ++fileCount;
+        }
+    }
+
+    REQUIRE(fileCount == 1);
+}
+
 TEST_CASE("SQLiteIndex_Search_IdExactMatch", "[sqliteindex]")
 {
     TempFile tempFile{ "repolibtest_tempdb"s, ".db"s };
@@ -1958,6 +2116,73 @@ TEST_CASE("SQLiteIndex_PathString_CaseInsensitive", "[sqliteindex]")
     REQUIRE(!result.has_value());
 }
 
+TEST_CASE("SQLiteIndex_PrepareForPackaging_VersionKeys", "[sqliteindex]")
+{
+    TempFile tempFile{ "repolibtest_tempdb"s, ".db"s };
+    INFO("Using temporary file named: " << tempFile.GetPath());
+
+    SQLiteIndex index = SearchTestSetup(tempFile, {
+        { "Id", "Name", "Moniker", "14.0.0", "", { "foot" }, { "com34" }, "Path1" },
+        { "Id", "Name", "Moniker", "16.0.0", "alpha", { "floor" }, { "com3" }, "Path2" },
+        { "Id", "Name", "Moniker", "15.0.0", "", {}, { "Command" }, "Path3" },
+        { "Id", "Name", "Moniker", "13.2.0-BUGFIX", "", {}, { "Command" }, "Path4" },
+        { "Id", "Name", "Moniker", "15.1.0", "beta", { "foo" }, { "com3" }, "Path5" },
+        { "Id", "Name", "Moniker", "15.8.0", "alpha", { "foo" }, { "com3" }, "Path6" },
+        { "Id", "Name", "Moniker", "13.2.0-bugfix", "beta", { "foo" }, { "com3" }, "Path7" },
+        { "Id", "Name", "Moniker", "13.0.0", "", { "foo" }, { "com3" }, "Path8" },
+        { "Id2", "Name2", "Moniker2", "1.0.0", "", { "foo" }, { "com3" }, "Path9" },
+        });
+
+    SearchRequest request;
+    request.Filters.emplace_back(PackageMatchField::Id, MatchType::Exact, "Id");
+
+    auto results = index.Search(request);
+    REQUIRE(results.Matches.size() == 1);
+    auto id = results.Matches[0].first;
+
+    std::vector<std::pair<std::string_view, std::string_view>> keys =
+    {
+        { "", "" },
+        { "", "alpha" },
+        { "", "Beta" },
+        { "", "gamma" },
+        { "14.0.0", "" },
+        { "13.2.0-BugFix", "" },
+        { "13.2.0-BugFix", "BETA" },
+        { "15.8.0", "alpha" },
+        { "99.0.0", "" },
+    };
+
+    auto getPaths = [&]()
+    {
+        std::vector<std::string> result;
+        for (const auto& key : keys)
+        {
+            auto manifestId = index.GetManifestIdByKey(id, key.first, key.second);
+            result.emplace_back(manifestId ? index.GetPropertyByManifestId(manifestId.value(), PackageVersionProperty::RelativePath).value() : "<none>");
+        }
+        return result;
+    };
+
+    auto expectedVersionKeys = index.GetVersionKeysById(id);
+    auto expectedPaths = getPaths();
+
+    // The lookups on the packaged index must produce the same results.
+    index.PrepareForPackaging();
+    REQUIRE(index.CheckConsistency(true));
+
+    auto versionKeys = index.GetVersionKeysById(id);
+    REQUIRE(versionKeys.size() == expectedVersionKeys.size());
+    for (size_t i = 0; i < versionKeys.size(); ++i)
+    {
+        INFO(i);
+        REQUIRE(versionKeys[i].GetVersion().ToString() == expectedVersionKeys[i].GetVersion().ToString());
+        REQUIRE(versionKeys[i].GetChannel().ToString() == expectedVersionKeys[i].GetChannel().ToString());
+    }
+
+    REQUIRE(getPaths() == expectedPaths);
+}
+
 TEST_CASE("SQLiteIndex_SearchResultsTableSearches", "[sqliteindex][V1_0]")
 {
     TempFile tempFile{ "repolibtest_tempdb"s, ".db"s };
@@ -156,18 +156,21 @@ TEST_CASE("SQLiteIndexSource_GetManifest", "[sqliteindexsource]")
     auto specificResultVersion = package->GetAvailableVersion(PackageVersionKey("", manifest.Version, manifest.Channel));
     REQUIRE(specificResultVersion);
     auto specificResult = specificResultVersion->GetManifest();
-    REQUIRE(specificResult.Id == manifest.Id);
-    REQUIRE(specificResult.DefaultLocalization.Get<Localization::PackageName>() == manifest.DefaultLocalization.Get<Localization::PackageName>());
-    REQUIRE(specificResult.Version == manifest.Version);
-    REQUIRE(specificResult.Channel == manifest.Channel);
+    REQUIRE(specificResult->Id == manifest.Id);
+    REQUIRE(specificResult->DefaultLocalization.Get<Localization::PackageName>() == manifest.DefaultLocalization.Get<Localization::PackageName>());
+    REQUIRE(specificResult->Version == manifest.Version);
+    REQUIRE(specificResult->Channel == manifest.Channel);
+
+    // The manifest is retrieved once and shared with later callers.
+    REQUIRE(specificResultVersion->GetManifest().IsSharedWith(specificResult));
 
     auto latestResultVersion = package->GetAvailableVersion(PackageVersionKey("", "", manifest.Channel));
     REQUIRE(latestResultVersion);
     auto latestResult = latestResultVersion->GetManifest();
-    REQUIRE(latestResult.Id == manifest.Id);
-    REQUIRE(latestResult.DefaultLocalization.Get<Localization::PackageName>() == manifest.DefaultLocalization.Get<Localization::PackageName>());
-    REQUIRE(latestResult.Version == manifest.Version);
-    REQUIRE(latestResult.Channel == manifest.Channel);
+    REQUIRE(latestResult->Id == manifest.Id);
+    REQUIRE(latestResult->DefaultLocalization.Get<Localization::PackageName>() == manifest.DefaultLocalization.Get<Localization::PackageName>());
+    REQUIRE(latestResult->Version == manifest.Version);
+    REQUIRE(latestResult->Channel == manifest.Channel);
 
     auto noResultVersion = package->GetAvailableVersion(PackageVersionKey("", "blargle", "flargle"));
     REQUIRE(!noResultVersion);
@@ -10,6 +10,8 @@
 #include <AppInstallerRuntime.h>
 #include <AppInstallerStrings.h>
 #include <AppInstallerErrors.h>
+#include <winget/OpenedSourceCache.h>
+#include <winget/SourceUpdateScheduler.h>
 #include <winget/Settings.h>
 
 using namespace TestCommon;
@@ -594,6 +596,75 @@ TEST_CASE("RepoSources_UpdateOnOpen", "[sources]")
     REQUIRE(sources[0].LastUpdateTime != ConvertUnixEpochToSystemClock(0));
 }
 
+TEST_CASE("RepoSources_DeferredUpdateOnOpen", "[sources]")
+{
+    TestHook_ClearSourceFactoryOverrides();
+
+    size_t updateCount = 0;
+    TestSourceFactory factory{ SourcesTestSource::Create };
+    factory.OnUpdate = [&](const SourceDetails&) { ++updateCount; };
+    TestHook_SetSourceFactoryOverride("testType", factory);
+
+    SetSetting(Stream::UserSources, s_SingleSource);
+    SetSetting(Stream::SourcesMetadata, s_SingleSourceMetadata);
+
+    auto& scheduler = SourceUpdateScheduler::Instance();
+    scheduler.EnableDeferredUpdates();
+    auto disableDeferredUpdates = wil::scope_exit([&]() { scheduler.DisableDeferredUpdates(); });
+
+    ProgressCallback progress;
+    auto source = OpenSource("testName", progress);
+    REQUIRE(updateCount == 0);
+
+    // Opening again before the update runs does not schedule another one
+    OpenSource("testName", progress);
+
+    scheduler.RunPending();
+    REQUIRE(updateCount == 1);
+
+    std::vector<SourceDetails> sources = GetSources();
+    REQUIRE(sources[0].Name == "testName");
+    REQUIRE(sources[0].LastUpdateTime > ConvertUnixEpochToSystemClock(100));
+
+    scheduler.RunPending();
+    REQUIRE(updateCount == 1);
+}
+
+TEST_CASE("RepoSources_DeferredUpdateNeverUpdated", "[sources]")
+{
+    TestHook_ClearSourceFactoryOverrides();
+
+    bool updateCalledOnFactory = false;
+    TestSourceFactory factory{ SourcesTestSource::Create };
+    factory.OnUpdate = [&](const SourceDetails&) { updateCalledOnFactory = true; };
+    TestHook_SetSourceFactoryOverride("testType", factory);
+
+    // Without metadata, the source has never been updated and there is no copy to use in the meantime
+    SetSetting(Stream::UserSources, s_SingleSource);
+
+    auto& scheduler = SourceUpdateScheduler::Instance();
+    scheduler.EnableDeferredUpdates();
+    auto disableDeferredUpdates = wil::scope_exit([&]() { scheduler.DisableDeferredUpdates(); });
+
+    ProgressCallback progress;
+    auto source = OpenSource("testName", progress);
+    REQUIRE(updateCalledOnFactory);
+}
+
+TEST_CASE("RepoSources_UpdateScheduleJitter", "[sources]")
+{
+    using namespace std::chrono_literals;
+
+    std::chrono::milliseconds interval = 60min;
+
+    for (size_t i = 0; i < 100; ++i)
+    {
+        auto jittered = SourceUpdateScheduler::AddJitter(interval);
+        REQUIRE(jittered >= interval);
+        REQUIRE(jittered <= interval + interval / 4);
+    }
+}
+
 TEST_CASE("RepoSources_DropSourceByName", "[sources]")
 {
     SetSetting(Stream::UserSources, s_ThreeSources);
@@ -1294,3 +1365,59 @@ TEST_CASE("RepoSources_GroupPolicy_BypassCertificatePinningForMicrosoftStore", "
         REQUIRE_FALSE(source.GetDetails().CertificatePinningConfiguration.IsEmpty());
     }
 }
+
+TEST_CASE("RepoSources_OpenedSourceCache", "[sources]")
+{
+    TestHook_ClearSourceFactoryOverrides();
+
+    size_t openCount = 0;
+    TestSourceFactory factory{ [&](const SourceDetails& details) { ++openCount; return SourcesTestSource::Create(details); } };
+    TestHook_SetSourceFactoryOverride("testType", factory);
+
+    SetSetting(Stream::UserSources, s_SingleSource);
+
+    OpenedSourceCache cache;
+    ProgressCallback progress;
+
+    Source first = cache.Open(Source{ "testName" }, "caller", progress);
+    Source second = cache.Open(Source{ "testName" }, "caller", progress);
+    REQUIRE(openCount == 1);
+    REQUIRE(second.Search({}).Matches.size() == 3);
+
+    // Each caller gets its own instance
+    cache.Open(Source{ "testName" }, "otherCaller", progress);
+    REQUIRE(openCount == 2);
+
+    // Changes to the installed packages do not affect available sources
+    cache.InvalidateInstalled();
+    cache.Open(Source{ "testName" }, "caller", progress);
+    REQUIRE(openCount == 2);
+
+    cache.Invalidate(first.GetIdentifier());
+    cache.Open(Source{ "testName" }, "caller", progress);
+    REQUIRE(openCount == 3);
+
+    // Sources opened with a custom header are not shared with those opened with another header, or without one
+    Source withHeader{ "testName" };
+    REQUIRE(withHeader.SetCustomHeader("header"));
+    cache.Open(withHeader, "caller", progress);
+    REQUIRE(openCount == 4);
+    cache.Open(withHeader, "caller", progress);
+    REQUIRE(openCount == 4);
+
+    Source withOtherHeader{ "testName" };
+    REQUIRE(withOtherHeader.SetCustomHeader("otherHeader"));
+    cache.Open(withOtherHeader, "caller", progress);
+    REQUIRE(openCount == 5);
+
+    Source withEmptyHeader{ "testName" };
+    REQUIRE(withEmptyHeader.SetCustomHeader(""));
+    cache.Open(withEmptyHeader, "caller", progress);
+    REQUIRE(openCount == 6);
+
+    cache.Open(Source{ "testName" }, "caller", progress);
+    REQUIRE(openCount == 6);
+
+    // Sources that were already handed out keep working after invalidation
+    REQUIRE(first.Search({}).Matches.size() == 3);
+}
@@ -83,7 +83,7 @@ namespace TestCommon
         return result;
     }
 
-    TestPackageVersion::Manifest TestPackageVersion::GetManifest()
+    AppInstaller::Manifest::SharedManifest TestPackageVersion::GetManifest()
     {
         return VersionManifest;
     }
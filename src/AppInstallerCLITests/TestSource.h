@@ -29,7 +29,7 @@ namespace TestCommon
 
         LocIndString GetProperty(AppInstaller::Repository::PackageVersionProperty property) const override;
         std::vector<LocIndString> GetMultiProperty(AppInstaller::Repository::PackageVersionMultiProperty property) const override;
-        Manifest GetManifest() override;
+        AppInstaller::Manifest::SharedManifest GetManifest() override;
         AppInstaller::Repository::Source GetSource() const override;
         MetadataMap GetMetadata() const override;
 
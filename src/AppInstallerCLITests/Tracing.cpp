@@ -0,0 +1,153 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+#include "pch.h"
+#include "TestCommon.h"
+#include <winget/Tracing.h>
+
+using namespace AppInstaller::Logging;
+using namespace TestCommon;
+
+namespace
+{
+    // Enables tracing for the scope, discarding any spans recorded before and during it.
+    struct TracingScope
+    {
+        TracingScope()
+        {
+            std::ignore = TakeTraceEvents();
+            EnableTracing();
+        }
+
+        ~TracingScope()
+        {
+            DisableTracing();
+            std::ignore = TakeTraceEvents();
+        }
+    };
+
+    const TraceEvent* FindEvent(const std::vector<TraceEvent>& events, std::string_view name)
+    {
+        auto itr = std::find_if(events.begin(), events.end(), [&](const TraceEvent& event) { return event.Name == name; });
+        return itr == events.end() ? nullptr : &*itr;
+    }
+}
+
+TEST_CASE("Tracing_DisabledRecordsNothing", "[tracing]")
+{
+    std::ignore = TakeTraceEvents();
+    REQUIRE_FALSE(IsTracingEnabled());
+
+    {
+        TraceSpan span{ Channel::Test, "Disabled" };
+        REQUIRE_FALSE(span);
+        span.AddArgument("value", 1);
+    }
+
+    REQUIRE(TakeTraceEvents().empty());
+}
+
+TEST_CASE("Tracing_NestedSpans", "[tracing]")
+{
+    TracingScope tracing;
+
+    {
+        TraceSpan outer{ Channel::Test, "Outer" };
+        REQUIRE(outer);
+        outer.AddArgument("count", 42);
+        outer.AddArgument("text", std::string_view{ "value" });
+
+        {
+            AICLI_TRACE_SPAN(Test, "Inner");
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+    }
+
+    auto events = TakeTraceEvents();
+    REQUIRE(events.size() == 2);
+
+    const TraceEvent* outer = FindEvent(events, "Outer");
+    const TraceEvent* inner = FindEvent(events, "Inner");
+    REQUIRE(outer);
+    REQUIRE(inner);
+
+    REQUIRE(outer->Category == Channel::Test);
+    REQUIRE(outer->ThreadId == GetCurrentThreadId());
+    REQUIRE(inner->ThreadId == GetCurrentThreadId());
+
+    // The inner span is contained by the outer span.
+    REQUIRE(outer->Start <= inner->Start);
+    REQUIRE(inner->Start + inner->Duration <= outer->Start + outer->Duration);
+    REQUIRE(inner->Duration >= std::chrono::milliseconds(1));
+
+    REQUIRE(outer->Arguments.size() == 2);
+    REQUIRE(outer->Arguments[0].first == "count");
+    REQUIRE(std::get<int64_t>(outer->Arguments[0].second) == 42);
+    REQUIRE(outer->Arguments[1].first == "text");
+    REQUIRE(std::get<std::string>(outer->Arguments[1].second) == "value");
+    REQUIRE(inner->Arguments.empty());
+}
+
+TEST_CASE("Tracing_SpansFromOtherThreads", "[tracing]")
+{
+    TracingScope tracing;
+
+    DWORD otherThreadId = 0;
+    std::thread other{ [&]()
+        {
+            otherThreadId = GetCurrentThreadId();
+            AICLI_TRACE_SPAN(Test, "OtherThread");
+        } };
+    other.join();
+
+    {
+        AICLI_TRACE_SPAN(Test, "ThisThread");
+    }
+
+    // The spans of a thread are kept after it exits.
+    auto events = TakeTraceEvents();
+    REQUIRE(events.size() == 2);
+
+    const TraceEvent* otherEvent = FindEvent(events, "OtherThread");
+    const TraceEvent* thisEvent = FindEvent(events, "ThisThread");
+    REQUIRE(otherEvent);
+    REQUIRE(thisEvent);
+    REQUIRE(otherEvent->ThreadId == otherThreadId);
+    REQUIRE(thisEvent->ThreadId == GetCurrentThreadId());
+}
+
+TEST_CASE("Tracing_WriteChromeTrace", "[tracing]")
+{
+    TempFile traceFile{ "trace", ".json" };
+
+    {
+        TracingScope tracing;
+
+        {
+            TraceSpan span{ Channel::Repo, "Written" };
+            span.AddArgument("name", std::string{ "value" });
+        }
+
+        DisableTracing();
+        WriteChromeTrace(traceFile);
+
+        // The spans are removed once written.
+        REQUIRE(TakeTraceEvents().empty());
+    }
+
+    std::ifstream stream{ traceFile.GetPath() };
+    Json::Value root = ConvertToJson(std::string{ std::istreambuf_iterator<char>{ stream }, std::istreambuf_iterator<char>{} });
+
+    const Json::Value& traceEvents = root["traceEvents"];
+    REQUIRE(traceEvents.isArray());
+    REQUIRE(traceEvents.size() == 1);
+
+    const Json::Value& event = traceEvents[0];
+    REQUIRE(event["name"].asString() == "Written");
+    REQUIRE(event["cat"].asString() == GetChannelName(Channel::Repo));
+    REQUIRE(event["ph"].asString() == "X");
+    REQUIRE(event["ts"].isNumeric());
+    REQUIRE(event["dur"].isNumeric());
+    REQUIRE(event["pid"].asUInt() == GetCurrentProcessId());
+    REQUIRE(event["tid"].asUInt() == GetCurrentThreadId());
+    REQUIRE(event["args"]["name"].asString() == "value");
+}
@@ -399,6 +399,37 @@ TEST_CASE("SettingAutoUpdateIntervalInMinutes", "[settings]")
     }
 }
 
+TEST_CASE("SettingNetworkMaxConcurrentDownloads", "[settings]")
+{
+    auto again = DeleteUserSettingsFiles();
+
+    SECTION("Default value")
+    {
+        UserSettingsTest userSettingTest;
+
+        REQUIRE(userSettingTest.Get<Setting::NetworkMaxConcurrentDownloads>() == 0);
+        REQUIRE(userSettingTest.GetWarnings().size() == 0);
+    }
+    SECTION("Valid value")
+    {
+        std::string_view json = R"({ "network": { "maxConcurrentDownloads": 6 } })";
+        SetSetting(Stream::PrimaryUserSettings, json);
+        UserSettingsTest userSettingTest;
+
+        REQUIRE(userSettingTest.Get<Setting::NetworkMaxConcurrentDownloads>() == 6);
+        REQUIRE(userSettingTest.GetWarnings().size() == 0);
+    }
+    SECTION("Invalid value too large")
+    {
+        std::string_view json = R"({ "network": { "maxConcurrentDownloads": 100 } })";
+        SetSetting(Stream::PrimaryUserSettings, json);
+        UserSettingsTest userSettingTest;
+
+        REQUIRE(userSettingTest.Get<Setting::NetworkMaxConcurrentDownloads>() == 0);
+        REQUIRE(userSettingTest.GetWarnings().size() == 1);
+    }
+}
+
 TEST_CASE("SettingsExperimentalCmd", "[settings]")
 {
     auto again = DeleteUserSettingsFiles();
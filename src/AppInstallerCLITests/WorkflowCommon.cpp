@@ -552,7 +552,7 @@ namespace TestCommon
             context.Add<Data::HashPair>({ {}, {} });
             context.Add<Data::InstallerPath>(TestDataFile("AppInstallerTestExeInstaller.exe"));
 
-            auto dependency = Dependency(DependencyType::Package, context.Get<Execution::Data::Manifest>().Id, context.Get<Execution::Data::Manifest>().Version);
+            auto dependency = Dependency(DependencyType::Package, context.Get<Execution::Data::Manifest>()->Id, context.Get<Execution::Data::Manifest>()->Version);
             installationLog.push_back(dependency);
         } });
 
@@ -975,6 +975,64 @@ TEST_CASE("ManifestApplyLocale", "[ManifestValidation]")
     REQUIRE(manifest.CurrentLocalization.Get<Localization::Publisher>() == "es-MX publisher");
 }
 
+TEST_CASE("ManifestLocalization_AddGetMerge", "[ManifestValidation]")
+{
+    ManifestLocalization localization;
+    REQUIRE_FALSE(localization.Contains(Localization::PackageName));
+    REQUIRE(localization.Get<Localization::PackageName>().empty());
+    REQUIRE(localization.Get<Localization::Tags>().empty());
+
+    localization.Add<Localization::PackageName>("name");
+    localization.Add<Localization::Tags>({ "tag1", "tag2" });
+    REQUIRE(localization.Contains(Localization::PackageName));
+    REQUIRE(localization.Contains(Localization::Tags));
+    REQUIRE_FALSE(localization.Contains(Localization::Publisher));
+    REQUIRE(localization.Get<Localization::PackageName>() == "name");
+    REQUIRE(localization.Get<Localization::Tags>().size() == 2);
+
+    ManifestLocalization other;
+    other.Locale = "fr-FR";
+    other.Add<Localization::PackageName>("nom");
+    other.Add<Localization::Publisher>("editeur");
+
+    localization.ReplaceOrMergeWith(other);
+    REQUIRE(localization.Locale == "fr-FR");
+    REQUIRE(localization.Get<Localization::PackageName>() == "nom");
+    REQUIRE(localization.Get<Localization::Publisher>() == "editeur");
+    REQUIRE(localization.Get<Localization::Tags>().size() == 2);
+}
+
+TEST_CASE("SharedManifest_CopyOnWrite", "[ManifestValidation]")
+{
+    SharedManifest original = YamlParser::CreateFromPath(TestDataFile("Manifest-Good-MultiLocale.yaml"));
+    original.ApplyLocale("en-US");
+
+    // Applying the locale that is already applied does not copy.
+    SharedManifest copy = original;
+    REQUIRE(copy.IsSharedWith(original));
+    copy.ApplyLocale("en-US");
+    REQUIRE(copy.IsSharedWith(original));
+    REQUIRE(copy->CurrentLocalization.Locale == "en-GB");
+
+    // A different locale gives the copy its own manifest.
+    copy.ApplyLocale("fr-FR");
+    REQUIRE_FALSE(copy.IsSharedWith(original));
+    REQUIRE(copy->CurrentLocalization.Locale == "fr-FR");
+    REQUIRE(original->CurrentLocalization.Locale == "en-GB");
+
+    // Edits never affect other owners.
+    SharedManifest edited = original;
+    edited.Edit().Installers.clear();
+    REQUIRE_FALSE(edited.IsSharedWith(original));
+    REQUIRE(edited->Installers.empty());
+    REQUIRE_FALSE(original->Installers.empty());
+
+    // An unshared manifest is edited in place.
+    const Manifest* before = &edited.Get();
+    edited.Edit().Moniker = "edited";
+    REQUIRE(&edited.Get() == before);
+}
+
 TEST_CASE("ManifestLocalizationValidation", "[ManifestValidation]")
 {
     Manifest manifest = YamlParser::CreateFromPath(TestDataFile("Manifest-Good-MultiLocale.yaml"));
@@ -1236,3 +1294,53 @@ TEST_CASE("YamlParserTypes", "[YAML]")
     auto localTag = document["LocalTag"];
     CHECK(localTag.GetTagType() == Node::TagType::Unknown);
 }
+
+std::string CreateLargeYamlList(size_t count)
+{
+    std::string result = "Key: Value\nList:\n";
+
+    for (size_t i = 0; i < count; ++i)
+    {
+        result += "  - Item" + std::to_string(i) + "\n";
+    }
+
+    return result;
+}
+
+TEST_CASE("YamlLoadFromPath_Hash", "[YAML]")
+{
+    std::string content = GENERATE(
+        std::string{ "Key: Value\n" },
+        // Larger than the parser's read buffer
+        CreateLargeYamlList(5000),
+        // The parser stops reading after the first document
+        std::string{ "Key: Value\n---\nKey: Second\n" } + std::string(100000, '#') + "\n",
+        // Windows-1252, which is converted before parsing
+        std::string{ "Key: Valu\xE9\n" });
+
+    TempFile yamlFile{ "YamlLoadFromPath.yaml" };
+    {
+        std::ofstream stream{ yamlFile.GetPath(), std::ios_base::out | std::ios_base::binary };
+        stream << content;
+    }
+
+    SHA256::HashBuffer hash;
+    Node document = Load(yamlFile.GetPath(), hash);
+
+    REQUIRE(SHA256::AreEqual(hash, SHA256::ComputeHash(content)));
+    REQUIRE(document["Key"].as<std::string>().substr(0, 4) == "Valu");
+}
+
+TEST_CASE("YamlLoadFromPath_EmptyFile", "[YAML]")
+{
+    TempFile yamlFile{ "YamlLoadFromPath.yaml" };
+    {
+        std::ofstream stream{ yamlFile.GetPath(), std::ios_base::out | std::ios_base::binary };
+    }
+
+    SHA256::HashBuffer hash;
+    Node document = Load(yamlFile.GetPath(), hash);
+
+    REQUIRE(!document.IsDefined());
+    REQUIRE(SHA256::AreEqual(hash, SHA256::ComputeHash(std::string_view{})));
+}
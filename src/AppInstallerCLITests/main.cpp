@@ -12,6 +12,7 @@
 #include <Public/AppInstallerTelemetry.h>
 #include <Telemetry/TraceLogging.h>
 
+#include "Benchmarks.h"
 #include "TestCommon.h"
 #include "TestSettings.h"
 
@@ -114,6 +115,22 @@ int main(int argc, char** argv)
         {
             keepSQLLogging = true;
         }
+        else if ("-benchsize"s == argv[i])
+        {
+            ++i;
+            if (i < argc)
+            {
+                TestCommon::BenchmarkSettings::SetPackageCount(std::stoul(argv[i]));
+            }
+        }
+        else if ("-benchout"s == argv[i])
+        {
+            ++i;
+            if (i < argc)
+            {
+                TestCommon::BenchmarkSettings::SetResultsPath(argv[i]);
+            }
+        }
         else
         {
             args.push_back(argv[i]);
@@ -722,6 +722,23 @@ namespace AppInstaller::Logging
         }
     }
 
+    void TelemetryTraceLogger::LogOrchestratorQueueConcurrency(std::string_view queueName, uint32_t concurrency, uint64_t throughput) const noexcept
+    {
+        if (IsTelemetryEnabled())
+        {
+            AICLI_TraceLoggingWriteActivity(
+                "OrchestratorQueueConcurrency",
+                TraceLoggingUInt32(m_subExecutionId, "SubExecutionId"),
+                AICLI_TraceLoggingStringView(queueName, "QueueName"),
+                TraceLoggingUInt32(concurrency, "Concurrency"),
+                TraceLoggingUInt64(throughput, "Throughput"),
+                TelemetryPrivacyDataTag(PDT_ProductAndServicePerformance),
+                TraceLoggingKeyword(MICROSOFT_KEYWORD_MEASURES));
+        }
+
+        AICLI_LOG(Core, Info, << "Orchestrator queue " << queueName << " concurrency set to " << concurrency << " at " << throughput << " bytes per second");
+    }
+
     TelemetryTraceLogger::~TelemetryTraceLogger()
     {
         if (IsTelemetryEnabled())
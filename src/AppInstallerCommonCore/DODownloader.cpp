@@ -403,8 +403,7 @@ namespace AppInstaller::Utility
 
             if (computeHash)
             {
-                std::ifstream inStream{ dest, std::ifstream::binary };
-                return SHA256::ComputeHash(inStream);
+                return SHA256::ComputeHashFromFile(dest);
             }
         }
 
@@ -7,58 +7,50 @@ namespace AppInstaller::Manifest
 {
     // this constructor was intented for use during installation flow (we already have installer dependencies and there's no need to search the source again)
     DependencyGraph::DependencyGraph(const Dependency& root, const DependencyList& rootDependencies,
-        std::function<const DependencyList(const Dependency&)> infoFunction) : m_root(root), getDependencies(infoFunction)
+        std::function<const DependencyList(const Dependency&)> infoFunction) : getDependencies(infoFunction)
     {
-        m_adjacents[m_root] = std::set<Dependency>();
-        m_toCheck = std::vector<Dependency>();
+        GetOrAddNode(root);
         rootDependencies.ApplyToType(DependencyType::Package, [&](Dependency dependency)
             {
-                m_toCheck.push_back(dependency);
-                AddNode(dependency);
                 AddAdjacent(root, dependency);
             });
         m_rootDependencyEvaluated = true;
     }
 
-    DependencyGraph::DependencyGraph(const Dependency& root, std::function<const DependencyList(const Dependency&)> infoFunction) : m_root(root), getDependencies(infoFunction)
+    DependencyGraph::DependencyGraph(const Dependency& root, std::function<const DependencyList(const Dependency&)> infoFunction) : getDependencies(infoFunction)
     {
-        m_adjacents[m_root] = std::set<Dependency>();
-        m_toCheck = std::vector<Dependency>();
+        GetOrAddNode(root);
     }
 
     void DependencyGraph::BuildGraph()
     {
-        if (!m_rootDependencyEvaluated) 
+        if (!m_rootDependencyEvaluated)
         {
-            const DependencyList& rootDependencies = getDependencies(m_root);
+            // Copy the root, as adding nodes may move it.
+            Dependency root = m_nodes[0];
+            const DependencyList& rootDependencies = getDependencies(root);
             rootDependencies.ApplyToType(DependencyType::Package, [&](Dependency dependency)
                 {
-                    m_toCheck.push_back(dependency);
-                    AddNode(dependency);
-                    AddAdjacent(m_root, dependency);
+                    AddAdjacent(root, dependency);
                 });
             m_rootDependencyEvaluated = true;
         }
 
-        if (m_toCheck.empty())
+        if (m_nodes.size() == 1)
         {
             return;
         }
 
-        for (unsigned int i = 0; i < m_toCheck.size(); ++i)
+        // Every node added while walking the list is appended to it, so this visits each node exactly once.
+        for (; m_nextToCheck < m_nodes.size(); ++m_nextToCheck)
         {
-            auto node = m_toCheck.at(i);
+            Dependency node = m_nodes[m_nextToCheck];
 
             const auto& nodeDependencies = getDependencies(node);
             nodeDependencies.ApplyToType(DependencyType::Package, [&](Dependency dependency)
                 {
-                    if (!HasNode(dependency))
-                    {
-                        m_toCheck.push_back(dependency);
-                        AddNode(dependency);
-                    }
-
-                    AddAdjacent(node, dependency);
+                    NodeIndex adjacent = GetOrAddNode(dependency);
+                    m_adjacents[m_nextToCheck].push_back(adjacent);
                 });
         }
 
@@ -67,18 +59,20 @@ namespace AppInstaller::Manifest
 
     void DependencyGraph::AddNode(const Dependency& node)
     {
-        m_adjacents[node] = std::set<Dependency>();
+        GetOrAddNode(node);
     }
 
     void DependencyGraph::AddAdjacent(const Dependency& node, const Dependency& adjacent)
     {
-        m_adjacents[node].emplace(adjacent);
+        NodeIndex nodeIndex = GetOrAddNode(node);
+        NodeIndex adjacentIndex = GetOrAddNode(adjacent);
+        m_adjacents[nodeIndex].push_back(adjacentIndex);
     }
 
     bool DependencyGraph::HasNode(const Dependency& dependency)
     {
-        auto search = m_adjacents.find(dependency);
-        return search != m_adjacents.end();
+        auto search = m_nodeIndices.find(dependency);
+        return search != m_nodeIndices.end();
     }
 
     bool DependencyGraph::HasLoop()
@@ -88,47 +82,95 @@ namespace AppInstaller::Manifest
 
     void DependencyGraph::CheckForLoopsAndGetOrder()
     {
-        m_installationOrder = std::vector<Dependency>();
-        std::set<Dependency> visited;
-        m_HasLoop = HasLoopDFS(visited, m_root);
-    }
+        enum class State : uint8_t
+        {
+            NotVisited,
+            InProgress,
+            Done,
+        };
 
-    std::vector<Dependency> DependencyGraph::GetInstallationOrder()
-    {
-        return m_installationOrder;
-    }
+        m_installationOrder.clear();
+        m_loop.clear();
+        m_HasLoop = false;
 
-    // TODO make this function iterative
-    bool DependencyGraph::HasLoopDFS(std::set<Dependency> visited, const Dependency& node)
-    {
-        bool loop = false;
+        // Visit the adjacent nodes of each node in id order, and only once each.
+        for (auto& adjacents : m_adjacents)
+        {
+            std::sort(adjacents.begin(), adjacents.end(), [&](NodeIndex a, NodeIndex b) { return m_nodes[a] < m_nodes[b]; });
+            adjacents.erase(std::unique(adjacents.begin(), adjacents.end()), adjacents.end());
+        }
+
+        std::vector<State> states(m_nodes.size(), State::NotVisited);
+
+        // The path from the root to the node being visited, with the position of the next adjacent node to visit from each.
+        std::vector<std::pair<NodeIndex, size_t>> path;
 
-        visited.insert(node);
-        auto lAdjacents = m_adjacents.at(node);
-        for (const auto& adjacent : m_adjacents.at(node))
+        states[0] = State::InProgress;
+        path.emplace_back(0, 0);
+
+        while (!path.empty())
         {
-            auto search = visited.find(adjacent);
-            if (search == visited.end()) // if not found
+            auto [current, next] = path.back();
+            const auto& adjacents = m_adjacents[current];
+
+            if (next == adjacents.size())
             {
-                if (HasLoopDFS(visited, adjacent))
-                {
-                    loop = true;
-                    // didn't break the loop to have a complete order at the end (even if a loop exists)
-                }
+                // All of the node's dependencies come before it in the order.
+                states[current] = State::Done;
+                m_installationOrder.push_back(m_nodes[current]);
+                path.pop_back();
+                continue;
             }
-            else
+
+            ++path.back().second;
+            NodeIndex adjacent = adjacents[next];
+
+            switch (states[adjacent])
             {
-                loop = true;
-                // didn't break the loop to have a complete order at the end (even if a loop exists)
+            case State::NotVisited:
+                states[adjacent] = State::InProgress;
+                path.emplace_back(adjacent, 0);
+                break;
+            case State::InProgress:
+                // The adjacent node is on the current path, so this edge closes a loop.
+                // Didn't stop here to have a complete order at the end (even if a loop exists).
+                if (!m_HasLoop)
+                {
+                    m_HasLoop = true;
+
+                    auto loopStart = std::find_if(path.begin(), path.end(), [&](const auto& entry) { return entry.first == adjacent; });
+                    for (auto itr = loopStart; itr != path.end(); ++itr)
+                    {
+                        m_loop.push_back(m_nodes[itr->first]);
+                    }
+                }
+                break;
+            default:
+                break;
             }
         }
+    }
+
+    std::vector<Dependency> DependencyGraph::GetInstallationOrder()
+    {
+        return m_installationOrder;
+    }
+
+    std::vector<Dependency> DependencyGraph::GetLoop()
+    {
+        return m_loop;
+    }
+
+    DependencyGraph::NodeIndex DependencyGraph::GetOrAddNode(const Dependency& node)
+    {
+        auto [itr, inserted] = m_nodeIndices.emplace(node, m_nodes.size());
 
-        // Adding to have an order even if a loop is present
-        if (std::find(m_installationOrder.begin(), m_installationOrder.end(), node) == m_installationOrder.end())
+        if (inserted)
         {
-            m_installationOrder.push_back(node);
+            m_nodes.push_back(node);
+            m_adjacents.emplace_back();
         }
 
-        return loop;
+        return itr->second;
     }
-}
\ No newline at end of file
+}
@@ -0,0 +1,258 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+#include "pch.h"
+#include "Public/AppInstallerErrors.h"
+#include "Public/AppInstallerLogging.h"
+#include "Public/AppInstallerStrings.h"
+#include "Public/winget/FileHashCache.h"
+
+namespace AppInstaller::Utility
+{
+    namespace
+    {
+        // When the cache is full, this fraction of the entries is removed so that it is not done on every addition.
+        constexpr size_t s_EvictionDivisor = 4;
+
+        const std::string FileHashCache_Files = "Files";
+        const std::string FileHashCache_Size = "Size";
+        const std::string FileHashCache_LastWriteTime = "LastWriteTime";
+        const std::string FileHashCache_Sha256 = "Sha256";
+        const std::string FileHashCache_Order = "Order";
+
+        // Gets the key identifying a file; paths are case insensitive.
+        std::string GetFileKey(const std::filesystem::path& path)
+        {
+            return FoldCase(std::string_view{ std::filesystem::absolute(path).lexically_normal().u8string() });
+        }
+    }
+
+    FileHashCache::FileHashCache(std::filesystem::path storagePath, size_t maximumEntries) :
+        m_storagePath(std::move(storagePath)), m_maximumEntries(std::max<size_t>(maximumEntries, 1))
+    {
+        try
+        {
+            std::ifstream storage{ m_storagePath, std::ifstream::binary };
+            if (!storage)
+            {
+                return;
+            }
+
+            Json::Value root;
+            Json::CharReaderBuilder builder;
+            std::string errors;
+            if (!Json::parseFromStream(builder, storage, &root, &errors))
+            {
+                AICLI_LOG(Core, Warning, << "Ignoring file hash cache that could not be parsed: " << errors);
+                return;
+            }
+
+            const Json::Value& files = root[FileHashCache_Files];
+            if (!files.isObject())
+            {
+                return;
+            }
+
+            for (const auto& key : files.getMemberNames())
+            {
+                const Json::Value& file = files[key];
+                const Json::Value& size = file[FileHashCache_Size];
+                const Json::Value& lastWriteTime = file[FileHashCache_LastWriteTime];
+                const Json::Value& hash = file[FileHashCache_Sha256];
+                const Json::Value& order = file[FileHashCache_Order];
+
+                if (!size.isUInt64() || !lastWriteTime.isInt64() || !hash.isString() || hash.asString().length() != SHA256::HashStringSizeInChars)
+                {
+                    continue;
+                }
+
+                // Entries written without an order are treated as the oldest.
+                uint64_t entryOrder = order.isUInt64() ? order.asUInt64() : 0;
+                m_nextOrder = std::max(m_nextOrder, entryOrder + 1);
+
+                m_entries[key] = Entry{ size.asUInt64(), lastWriteTime.asInt64(), SHA256::ConvertToBytes(hash.asString()), entryOrder };
+            }
+        }
+        catch (...)
+        {
+            LOG_CAUGHT_EXCEPTION_MSG("Failed to read the file hash cache");
+            m_entries.clear();
+        }
+    }
+
+    FileHashCache& FileHashCache::Instance()
+    {
+        static FileHashCache s_instance;
+        return s_instance;
+    }
+
+    std::vector<FileHashCache::FileHash> FileHashCache::GetHashes(const std::vector<std::filesystem::path>& paths)
+    {
+        std::vector<FileHash> result(paths.size());
+        std::vector<std::string> keys(paths.size());
+        std::vector<Entry> fileEntries(paths.size());
+
+        std::vector<size_t> indicesToHash;
+        std::vector<std::filesystem::path> pathsToHash;
+
+        for (size_t i = 0; i < paths.size(); ++i)
+        {
+            try
+            {
+                keys[i] = GetFileKey(paths[i]);
+                fileEntries[i].Size = std::filesystem::file_size(paths[i]);
+                fileEntries[i].LastWriteTime = std::filesystem::last_write_time(paths[i]).time_since_epoch().count();
+            }
+            catch (...)
+            {
+                result[i].Error = LOG_CAUGHT_EXCEPTION();
+                continue;
+            }
+
+            {
+                std::lock_guard<std::mutex> lock{ m_lock };
+
+                auto itr = m_entries.find(keys[i]);
+                if (itr != m_entries.end() && itr->second.Size == fileEntries[i].Size && itr->second.LastWriteTime == fileEntries[i].LastWriteTime)
+                {
+                    result[i].Hash = itr->second.Hash;
+
+                    // Using the entry makes it the most recent, so that eviction keeps it.
+                    if (itr->second.Order + 1 != m_nextOrder)
+                    {
+                        itr->second.Order = m_nextOrder++;
+                        m_changed = true;
+                    }
+
+                    continue;
+                }
+            }
+
+            indicesToHash.emplace_back(i);
+            pathsToHash.emplace_back(paths[i]);
+        }
+
+        if (pathsToHash.empty())
+        {
+            return result;
+        }
+
+        std::vector<HRESULT> errors;
+        std::vector<SHA256::HashBuffer> hashes = SHA256::ComputeHashesFromFiles(pathsToHash, &errors);
+
+        for (size_t i = 0; i < indicesToHash.size(); ++i)
+        {
+            size_t index = indicesToHash[i];
+
+            if (FAILED(errors[i]))
+            {
+                result[index].Error = errors[i];
+                continue;
+            }
+
+            result[index].Hash = hashes[i];
+            fileEntries[index].Hash = std::move(hashes[i]);
+            Set(keys[index], std::move(fileEntries[index]));
+        }
+
+        return result;
+    }
+
+    void FileHashCache::Save()
+    {
+        std::lock_guard<std::mutex> lock{ m_lock };
+
+        if (m_storagePath.empty() || !m_changed)
+        {
+            return;
+        }
+
+        try
+        {
+            Json::Value files{ Json::ValueType::objectValue };
+            for (const auto& [key, entry] : m_entries)
+            {
+                Json::Value& file = files[key];
+                file[FileHashCache_Size] = Json::Value::UInt64{ entry.Size };
+                file[FileHashCache_LastWriteTime] = Json::Value::Int64{ entry.LastWriteTime };
+                file[FileHashCache_Sha256] = SHA256::ConvertToString(entry.Hash);
+                file[FileHashCache_Order] = Json::Value::UInt64{ entry.Order };
+            }
+
+            Json::Value root{ Json::ValueType::objectValue };
+            root[FileHashCache_Files] = std::move(files);
+
+            std::filesystem::create_directories(m_storagePath.parent_path());
+
+            Json::StreamWriterBuilder writerBuilder;
+            writerBuilder.settings_["indentation"] = "";
+
+            // Write to a file in the same directory and then move it over the cache, so that a process
+            // reading the cache, or one that exits while writing it, never leaves it partially written.
+            std::filesystem::path tempPath = m_storagePath;
+            tempPath += "." + std::to_string(GetCurrentProcessId()) + ".tmp";
+
+            {
+                std::ofstream storage{ tempPath, std::ofstream::binary | std::ofstream::trunc };
+                if (!storage)
+                {
+                    AICLI_LOG(Core, Warning, << "Failed to open the file hash cache for writing: " << tempPath.u8string());
+                    return;
+                }
+
+                storage << Json::writeString(writerBuilder, root);
+                storage.flush();
+
+                if (!storage)
+                {
+                    AICLI_LOG(Core, Warning, << "Failed to write the file hash cache: " << tempPath.u8string());
+                    storage.close();
+
+                    std::error_code error;
+                    std::filesystem::remove(tempPath, error);
+                    return;
+                }
+            }
+
+            std::error_code error;
+            std::filesystem::rename(tempPath, m_storagePath, error);
+            if (error)
+            {
+                AICLI_LOG(Core, Warning, << "Failed to replace the file hash cache: " << error.message());
+                std::filesystem::remove(tempPath, error);
+                return;
+            }
+
+            m_changed = false;
+        }
+        CATCH_LOG_MSG("Failed to write the file hash cache");
+    }
+
+    void FileHashCache::Set(const std::string& key, Entry&& entry)
+    {
+        std::lock_guard<std::mutex> lock{ m_lock };
+
+        if (m_entries.size() >= m_maximumEntries && m_entries.find(key) == m_entries.end())
+        {
+            // Remove the least recently used entries, keeping the hashes of the files that were seen most recently.
+            std::vector<std::pair<uint64_t, std::string>> orderedKeys;
+            orderedKeys.reserve(m_entries.size());
+            for (const auto& [existingKey, existingEntry] : m_entries)
+            {
+                orderedKeys.emplace_back(existingEntry.Order, existingKey);
+            }
+
+            size_t evictCount = std::max<size_t>(1, m_entries.size() - m_maximumEntries + 1 + m_maximumEntries / s_EvictionDivisor);
+            evictCount = std::min(evictCount, orderedKeys.size());
+            std::nth_element(orderedKeys.begin(), orderedKeys.begin() + (evictCount - 1), orderedKeys.end());
+
+            for (size_t i = 0; i < evictCount; ++i)
+            {
+                m_entries.erase(orderedKeys[i].second);
+            }
+        }
+
+        entry.Order = m_nextOrder++;
+        m_entries[key] = std::move(entry);
+        m_changed = true;
+    }
+}
@@ -17,6 +17,39 @@ namespace AppInstaller::Logging
     static constexpr std::string_view s_fileLoggerDefaultFilePrefix = "WinGet"sv;
     static constexpr std::string_view s_fileLoggerDefaultFileExt = ".log"sv;
 
+    namespace
+    {
+        std::terminate_handler s_previousTerminateHandler = nullptr;
+        LPTOP_LEVEL_EXCEPTION_FILTER s_previousUnhandledExceptionFilter = nullptr;
+
+        void FlushOnTerminate()
+        {
+            try
+            {
+                Log().Flush();
+            }
+            catch (...) {}
+
+            if (s_previousTerminateHandler)
+            {
+                s_previousTerminateHandler();
+            }
+
+            std::abort();
+        }
+
+        LONG WINAPI FlushOnUnhandledException(EXCEPTION_POINTERS* exceptionInfo)
+        {
+            try
+            {
+                Log().Flush();
+            }
+            catch (...) {}
+
+            return s_previousUnhandledExceptionFilter ? s_previousUnhandledExceptionFilter(exceptionInfo) : EXCEPTION_CONTINUE_SEARCH;
+        }
+    }
+
     FileLogger::FileLogger() : FileLogger(s_fileLoggerDefaultFilePrefix) {}
 
     FileLogger::FileLogger(const std::filesystem::path& filePath)
@@ -36,7 +69,17 @@ namespace AppInstaller::Logging
 
     FileLogger::~FileLogger()
     {
-        m_stream.flush();
+        // The writer thread is not waited on, as this may run under the loader lock. It exits once woken,
+        // and everything queued is written here; Shutdown should be used to stop it deterministically.
+        m_state->StopWriter = true;
+
+        if (m_writerThread.joinable())
+        {
+            m_state->WakeWriter.SetEvent();
+            m_writerThread.detach();
+        }
+
+        m_state->Flush();
     }
 
     std::string FileLogger::GetNameForPath(const std::filesystem::path& filePath)
@@ -60,27 +103,156 @@ namespace AppInstaller::Logging
         return m_name;
     }
 
-    void FileLogger::Write(Channel channel, Level, std::string_view message) noexcept try
+    void FileLogger::Write(Channel channel, Level level, std::string_view message) noexcept try
+    {
+        // Only capture the data here; formatting is done by the writer.
+        Submit(channel, level, { std::chrono::system_clock::now(), channel, false, std::string{ message }, std::nullopt });
+    }
+    catch (...)
+    {
+        // Just eat any exceptions here; better than losing logs
+    }
+
+    void FileLogger::WriteDirect(Channel channel, Level level, std::string_view message) noexcept try
+    {
+        Submit(channel, level, { {}, channel, true, std::string{ message }, std::nullopt });
+    }
+    catch (...)
+    {
+        // Just eat any exceptions here; better than losing logs
+    }
+
+    void FileLogger::WriteFormatted(Channel channel, Level level, const LogFormatRecord& record) noexcept try
     {
-        // Send to a string first to create a single block to write to a file.
-        std::stringstream strstr;
-        strstr << std::chrono::system_clock::now() << " [" << std::setw(GetMaxChannelNameLength()) << std::left << std::setfill(' ') << GetChannelName(channel) << "] " << message;
-        m_stream << strstr.str() << std::endl;
+        // The record is formatted by the writer, keeping string construction off of the logging thread.
+        Submit(channel, level, { std::chrono::system_clock::now(), channel, false, {}, record });
     }
     catch (...)
     {
         // Just eat any exceptions here; better than losing logs
     }
 
-    void FileLogger::WriteDirect(Channel, Level, std::string_view message) noexcept try
+    void FileLogger::Flush() noexcept
+    {
+        m_state->Flush();
+    }
+
+    void FileLogger::Shutdown() noexcept try
     {
-        m_stream << message << std::endl;
+        m_state->StopWriter = true;
+
+        if (m_writerThread.joinable())
+        {
+            m_state->WakeWriter.SetEvent();
+            m_writerThread.join();
+        }
+
+        // The final flush picks up anything queued after the writer thread exited.
+        m_state->Flush();
     }
     catch (...)
     {
         // Just eat any exceptions here; better than losing logs
     }
 
+    void FileLogger::Submit(Channel channel, Level level, Entry&& entry)
+    {
+        m_state->Enqueue(std::move(entry));
+
+        // Errors are written out immediately so that they are not lost if the process goes down.
+        if (level >= Level::Error || channel == Channel::Fail || m_state->StopWriter)
+        {
+            m_state->Flush();
+        }
+    }
+
+    void FileLogger::WriterState::Enqueue(Entry&& entry)
+    {
+        while (!Queue.TryPush(entry))
+        {
+            // The writer has fallen behind; apply back pressure by writing on this thread rather than dropping logs.
+            std::lock_guard<std::mutex> lock{ StreamLock };
+            DrainingThreadId = GetCurrentThreadId();
+            auto clearDrainingThread = wil::scope_exit([&]() { DrainingThreadId = 0; });
+
+            DrainQueue();
+        }
+
+        // Only the first entry since the writer last woke needs to signal it.
+        if (!WakePending.exchange(true))
+        {
+            WakeWriter.SetEvent();
+        }
+    }
+
+    void FileLogger::WriterState::Flush() noexcept try
+    {
+        // A failure on the thread that is already draining cannot wait for it to finish.
+        if (DrainingThreadId == GetCurrentThreadId())
+        {
+            return;
+        }
+
+        std::lock_guard<std::mutex> lock{ StreamLock };
+        DrainingThreadId = GetCurrentThreadId();
+        auto clearDrainingThread = wil::scope_exit([&]() { DrainingThreadId = 0; });
+
+        DrainQueue();
+        Stream.flush();
+    }
+    catch (...)
+    {
+        // Just eat any exceptions here; better than losing logs
+    }
+
+    void FileLogger::WriterState::DrainQueue()
+    {
+        // Format the whole batch into one buffer to create a single block to write to the file.
+        std::string buffer;
+
+        for (auto entry = Queue.TryPop(); entry; entry = Queue.TryPop())
+        {
+            if (entry->IsDirect)
+            {
+                buffer.append(entry->Message);
+            }
+            else
+            {
+                std::stringstream strstr;
+                strstr << entry->Time << " [" << std::setw(GetMaxChannelNameLength()) << std::left << std::setfill(' ') << GetChannelName(entry->LogChannel) << "] ";
+                buffer.append(strstr.str());
+
+                if (entry->Record)
+                {
+                    entry->Record->AppendTo(buffer);
+                }
+                else
+                {
+                    buffer.append(entry->Message);
+                }
+            }
+
+            buffer.push_back('\n');
+        }
+
+        if (!buffer.empty())
+        {
+            Stream.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+        }
+    }
+
+    void FileLogger::WriterState::WriterThreadProc()
+    {
+        while (!StopWriter)
+        {
+            WakeWriter.wait();
+
+            // Cleared before draining, so that an entry queued during the drain wakes the writer again.
+            WakePending = false;
+            Flush();
+        }
+    }
+
     void FileLogger::Add()
     {
         Log().AddLogger(std::make_unique<FileLogger>());
@@ -96,6 +268,16 @@ namespace AppInstaller::Logging
         Log().AddLogger(std::make_unique<FileLogger>(fileNamePrefix));
     }
 
+    void FileLogger::EnableFlushOnFailure()
+    {
+        static std::once_flag s_enabled;
+        std::call_once(s_enabled, []()
+            {
+                s_previousTerminateHandler = std::set_terminate(FlushOnTerminate);
+                s_previousUnhandledExceptionFilter = SetUnhandledExceptionFilter(FlushOnUnhandledException);
+            });
+    }
+
     void FileLogger::BeginCleanup()
     {
         BeginCleanup(Runtime::GetPathTo(Runtime::PathName::DefaultLogLocation));
@@ -126,6 +308,8 @@ namespace AppInstaller::Logging
 
     void FileLogger::OpenFileLoggerStream() 
     {
+        m_state->WakeWriter.create(wil::EventOptions::None);
+
         // Prevent inheritance to ensure log file handle is not opened by other processes.
         FILE* filePtr;
         errno_t fopenError = _wfopen_s(&filePtr, m_filePath.wstring().c_str(), L"w");
@@ -133,12 +317,14 @@ namespace AppInstaller::Logging
         {
             THROW_HR_IF(E_UNEXPECTED, filePtr == nullptr);
             THROW_IF_WIN32_BOOL_FALSE(SetHandleInformation(reinterpret_cast<HANDLE>(_get_osfhandle(_fileno(filePtr))), HANDLE_FLAG_INHERIT, 0));
-            m_stream = std::ofstream{ filePtr };
+            m_state->Stream = std::ofstream{ filePtr };
         }
         else
         {
             AICLI_LOG(Core, Error, << "Failed to open log file " << m_filePath.u8string());
             throw std::system_error(fopenError, std::generic_category());
         }
+
+        m_writerThread = std::thread([state = m_state]() { state->WriterThreadProc(); });
     }
 }
@@ -0,0 +1,635 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+#include "pch.h"
+#include "AppInstallerErrors.h"
+#include "AppInstallerLogging.h"
+#include "winget/JsonStreamingReader.h"
+
+#include <charconv>
+
+namespace AppInstaller::JSON
+{
+    namespace
+    {
+        bool IsWhitespace(char c)
+        {
+            return c == ' ' || c == '\t' || c == '\n' || c == '\r';
+        }
+
+        bool IsDigit(char c)
+        {
+            return c >= '0' && c <= '9';
+        }
+
+        int HexValue(char c)
+        {
+            if (c >= '0' && c <= '9')
+            {
+                return c - '0';
+            }
+            else if (c >= 'a' && c <= 'f')
+            {
+                return c - 'a' + 10;
+            }
+            else if (c >= 'A' && c <= 'F')
+            {
+                return c - 'A' + 10;
+            }
+
+            return -1;
+        }
+
+        void AppendUTF8(std::string& buffer, uint32_t codePoint)
+        {
+            if (codePoint < 0x80)
+            {
+                buffer.push_back(static_cast<char>(codePoint));
+            }
+            else if (codePoint < 0x800)
+            {
+                buffer.push_back(static_cast<char>(0xC0 | (codePoint >> 6)));
+                buffer.push_back(static_cast<char>(0x80 | (codePoint & 0x3F)));
+            }
+            else if (codePoint < 0x10000)
+            {
+                buffer.push_back(static_cast<char>(0xE0 | (codePoint >> 12)));
+                buffer.push_back(static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F)));
+                buffer.push_back(static_cast<char>(0x80 | (codePoint & 0x3F)));
+            }
+            else
+            {
+                buffer.push_back(static_cast<char>(0xF0 | (codePoint >> 18)));
+                buffer.push_back(static_cast<char>(0x80 | ((codePoint >> 12) & 0x3F)));
+                buffer.push_back(static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F)));
+                buffer.push_back(static_cast<char>(0x80 | (codePoint & 0x3F)));
+            }
+        }
+    }
+
+    StreamingReader::StreamingReader(std::string_view input) : m_input(input) {}
+
+    bool StreamingReader::IsAtEnd()
+    {
+        while (m_position < m_input.size() && IsWhitespace(m_input[m_position]))
+        {
+            ++m_position;
+        }
+
+        return m_position >= m_input.size();
+    }
+
+    ValueType StreamingReader::PeekType()
+    {
+        char c = PeekChar();
+
+        switch (c)
+        {
+        case 'n':
+            return ValueType::Null;
+        case 't':
+        case 'f':
+            return ValueType::Boolean;
+        case '"':
+            return ValueType::String;
+        case '[':
+            return ValueType::Array;
+        case '{':
+            return ValueType::Object;
+        default:
+            if (c == '-' || (c >= '0' && c <= '9'))
+            {
+                return ValueType::Number;
+            }
+
+            ThrowInvalid("Unexpected character at the start of a value");
+        }
+    }
+
+    bool StreamingReader::BeginObject()
+    {
+        if (PeekType() != ValueType::Object)
+        {
+            SkipValue();
+            return false;
+        }
+
+        return EnterContainer(ValueType::Object);
+    }
+
+    std::optional<std::string_view> StreamingReader::NextMember()
+    {
+        THROW_HR_IF(E_UNEXPECTED, m_containers.empty() || m_containers.back().End != '}');
+
+        if (!NextItem())
+        {
+            return std::nullopt;
+        }
+
+        if (PeekChar() != '"')
+        {
+            ThrowInvalid("Expected a member name");
+        }
+
+        std::string_view name = ReadStringToken(m_nameBuffer);
+        Expect(':');
+        return name;
+    }
+
+    bool StreamingReader::BeginArray()
+    {
+        if (PeekType() != ValueType::Array)
+        {
+            SkipValue();
+            return false;
+        }
+
+        return EnterContainer(ValueType::Array);
+    }
+
+    bool StreamingReader::NextElement()
+    {
+        THROW_HR_IF(E_UNEXPECTED, m_containers.empty() || m_containers.back().End != ']');
+        return NextItem();
+    }
+
+    std::optional<std::string> StreamingReader::ReadString()
+    {
+        if (PeekType() != ValueType::String)
+        {
+            SkipValue();
+            return std::nullopt;
+        }
+
+        std::string buffer;
+        std::string_view value = ReadStringToken(buffer);
+
+        if (value.data() == buffer.data())
+        {
+            return buffer;
+        }
+
+        return std::string{ value };
+    }
+
+    std::optional<bool> StreamingReader::ReadBool()
+    {
+        if (PeekType() != ValueType::Boolean)
+        {
+            SkipValue();
+            return std::nullopt;
+        }
+
+        bool result = m_input[m_position] == 't';
+        ExpectLiteral(result ? "true" : "false");
+        return result;
+    }
+
+    std::optional<int> StreamingReader::ReadInt()
+    {
+        std::optional<int64_t> value = ReadInt64();
+
+        // Integers that do not fit are an error rather than being truncated to a different value.
+        if (value && (*value < std::numeric_limits<int>::min() || *value > std::numeric_limits<int>::max()))
+        {
+            ThrowInvalid("Integer out of range");
+        }
+
+        return value ? std::optional<int>{ static_cast<int>(*value) } : std::nullopt;
+    }
+
+    std::optional<int64_t> StreamingReader::ReadInt64()
+    {
+        if (PeekType() != ValueType::Number)
+        {
+            SkipValue();
+            return std::nullopt;
+        }
+
+        size_t start = m_position;
+        SkipNumberToken();
+        std::string_view token = m_input.substr(start, m_position - start);
+
+        // Only integral values are returned, matching the behavior of the DOM helpers.
+        if (token.find_first_of(".eE") != std::string_view::npos)
+        {
+            return std::nullopt;
+        }
+
+        int64_t value = 0;
+        auto [end, error] = std::from_chars(token.data(), token.data() + token.size(), value);
+        if (error == std::errc::result_out_of_range)
+        {
+            ThrowInvalid("Integer out of range");
+        }
+        else if (error != std::errc{} || end != token.data() + token.size())
+        {
+            return std::nullopt;
+        }
+
+        return value;
+    }
+
+    std::vector<std::string> StreamingReader::ReadStringArray()
+    {
+        std::vector<std::string> result;
+
+        if (BeginArray())
+        {
+            while (NextElement())
+            {
+                std::optional<std::string> value = ReadString();
+                if (value)
+                {
+                    result.emplace_back(std::move(value).value());
+                }
+            }
+        }
+
+        return result;
+    }
+
+    std::string_view StreamingReader::SkipValue()
+    {
+        ValueType type = PeekType();
+        size_t start = m_position;
+
+        if (!EnterContainer(type))
+        {
+            SkipScalarToken(type);
+            return m_input.substr(start, m_position - start);
+        }
+
+        // Skipped containers are checked for the same structure as those that are read; only the unescaping of strings is avoided.
+        size_t depth = m_containers.size() - 1;
+
+        do
+        {
+            bool isObject = m_containers.back().End == '}';
+
+            if (!NextItem())
+            {
+                continue;
+            }
+
+            if (isObject)
+            {
+                if (PeekChar() != '"')
+                {
+                    ThrowInvalid("Expected a member name");
+                }
+
+                SkipStringToken();
+                Expect(':');
+            }
+
+            ValueType itemType = PeekType();
+            if (!EnterContainer(itemType))
+            {
+                SkipScalarToken(itemType);
+            }
+        } while (m_containers.size() > depth);
+
+        return m_input.substr(start, m_position - start);
+    }
+
+    void StreamingReader::EndDocument()
+    {
+        if (!m_containers.empty() || !IsAtEnd())
+        {
+            ThrowInvalid("Unexpected content at the end of the document");
+        }
+    }
+
+    char StreamingReader::PeekChar()
+    {
+        if (IsAtEnd())
+        {
+            ThrowInvalid("Unexpected end of input");
+        }
+
+        return m_input[m_position];
+    }
+
+    void StreamingReader::Expect(char c)
+    {
+        if (PeekChar() != c)
+        {
+            ThrowInvalid("Unexpected character");
+        }
+
+        ++m_position;
+    }
+
+    void StreamingReader::ExpectLiteral(std::string_view literal)
+    {
+        if (m_input.substr(m_position, literal.size()) != literal)
+        {
+            ThrowInvalid("Invalid literal");
+        }
+
+        m_position += literal.size();
+    }
+
+    std::string_view StreamingReader::ReadStringToken(std::string& buffer)
+    {
+        size_t start = ++m_position;
+
+        // Most strings have no escapes and can be returned as a view of the input.
+        while (m_position < m_input.size())
+        {
+            char c = m_input[m_position];
+
+            if (c == '"')
+            {
+                return m_input.substr(start, m_position++ - start);
+            }
+            else if (c == '\\')
+            {
+                break;
+            }
+            else if (static_cast<unsigned char>(c) < 0x20)
+            {
+                ThrowInvalid("Control character in string");
+            }
+
+            ++m_position;
+        }
+
+        buffer.assign(m_input.substr(start, m_position - start));
+
+        for (;;)
+        {
+            if (m_position >= m_input.size())
+            {
+                ThrowInvalid("Unexpected end of input in string");
+            }
+
+            char c = m_input[m_position++];
+
+            if (c == '"')
+            {
+                return buffer;
+            }
+            else if (static_cast<unsigned char>(c) < 0x20)
+            {
+                ThrowInvalid("Control character in string");
+            }
+            else if (c != '\\')
+            {
+                buffer.push_back(c);
+                continue;
+            }
+
+            if (m_position >= m_input.size())
+            {
+                ThrowInvalid("Unexpected end of input in string");
+            }
+
+            char escape = m_input[m_position++];
+
+            switch (escape)
+            {
+            case '"':
+            case '\\':
+            case '/':
+                buffer.push_back(escape);
+                break;
+            case 'b':
+                buffer.push_back('\b');
+                break;
+            case 'f':
+                buffer.push_back('\f');
+                break;
+            case 'n':
+                buffer.push_back('\n');
+                break;
+            case 'r':
+                buffer.push_back('\r');
+                break;
+            case 't':
+                buffer.push_back('\t');
+                break;
+            case 'u':
+            {
+                auto readCodeUnit = [&]()
+                {
+                    if (m_input.size() - m_position < 4)
+                    {
+                        ThrowInvalid("Unexpected end of input in unicode escape");
+                    }
+
+                    uint32_t result = 0;
+                    for (size_t i = 0; i < 4; ++i)
+                    {
+                        int digit = HexValue(m_input[m_position++]);
+                        if (digit < 0)
+                        {
+                            ThrowInvalid("Invalid unicode escape");
+                        }
+
+                        result = (result << 4) | static_cast<uint32_t>(digit);
+                    }
+
+                    return result;
+                };
+
+                uint32_t codePoint = readCodeUnit();
+
+                if (codePoint >= 0xD800 && codePoint <= 0xDBFF)
+                {
+                    if (m_input.substr(m_position, 2) != "\\u")
+                    {
+                        ThrowInvalid("Unpaired surrogate in unicode escape");
+                    }
+
+                    m_position += 2;
+                    uint32_t low = readCodeUnit();
+                    if (low < 0xDC00 || low > 0xDFFF)
+                    {
+                        ThrowInvalid("Unpaired surrogate in unicode escape");
+                    }
+
+                    codePoint = 0x10000 + ((codePoint - 0xD800) << 10) + (low - 0xDC00);
+                }
+                else if (codePoint >= 0xDC00 && codePoint <= 0xDFFF)
+                {
+                    ThrowInvalid("Unpaired surrogate in unicode escape");
+                }
+
+                AppendUTF8(buffer, codePoint);
+                break;
+            }
+            default:
+                ThrowInvalid("Invalid escape in string");
+            }
+        }
+    }
+
+    void StreamingReader::SkipStringToken()
+    {
+        ++m_position;
+
+        while (m_position < m_input.size())
+        {
+            char c = m_input[m_position];
+
+            if (c == '"')
+            {
+                ++m_position;
+                return;
+            }
+            else if (c == '\\')
+            {
+                if (m_input.size() - m_position < 2)
+                {
+                    ThrowInvalid("Unexpected end of input in string");
+                }
+
+                char escape = m_input[m_position + 1];
+                m_position += 2;
+
+                if (escape == 'u')
+                {
+                    if (m_input.size() - m_position < 4)
+                    {
+                        ThrowInvalid("Unexpected end of input in unicode escape");
+                    }
+
+                    for (size_t i = 0; i < 4; ++i)
+                    {
+                        if (HexValue(m_input[m_position++]) < 0)
+                        {
+                            ThrowInvalid("Invalid unicode escape");
+                        }
+                    }
+                }
+                else if (std::string_view{ "\"\\/bfnrt" }.find(escape) == std::string_view::npos)
+                {
+                    ThrowInvalid("Invalid escape in string");
+                }
+
+                continue;
+            }
+            else if (static_cast<unsigned char>(c) < 0x20)
+            {
+                ThrowInvalid("Control character in string");
+            }
+
+            ++m_position;
+        }
+
+        ThrowInvalid("Unexpected end of input in string");
+    }
+
+    void StreamingReader::SkipNumberToken()
+    {
+        auto isNext = [&](std::string_view characters)
+        {
+            return m_position < m_input.size() && characters.find(m_input[m_position]) != std::string_view::npos;
+        };
+
+        auto skipDigits = [&]()
+        {
+            size_t start = m_position;
+            while (m_position < m_input.size() && IsDigit(m_input[m_position]))
+            {
+                ++m_position;
+            }
+
+            if (m_position == start)
+            {
+                ThrowInvalid("Invalid number");
+            }
+        };
+
+        // -?(0|[1-9][0-9]*)(\.[0-9]+)?([eE][+-]?[0-9]+)?
+        if (isNext("-"))
+        {
+            ++m_position;
+        }
+
+        if (isNext("0"))
+        {
+            ++m_position;
+        }
+        else
+        {
+            skipDigits();
+        }
+
+        if (isNext("."))
+        {
+            ++m_position;
+            skipDigits();
+        }
+
+        if (isNext("eE"))
+        {
+            ++m_position;
+            if (isNext("+-"))
+            {
+                ++m_position;
+            }
+            skipDigits();
+        }
+    }
+
+    void StreamingReader::SkipScalarToken(ValueType type)
+    {
+        switch (type)
+        {
+        case ValueType::Null:
+            ExpectLiteral("null");
+            break;
+        case ValueType::Boolean:
+            ExpectLiteral(m_input[m_position] == 't' ? "true" : "false");
+            break;
+        case ValueType::Number:
+            SkipNumberToken();
+            break;
+        case ValueType::String:
+            SkipStringToken();
+            break;
+        default:
+            THROW_HR(E_UNEXPECTED);
+        }
+    }
+
+    bool StreamingReader::EnterContainer(ValueType type)
+    {
+        if (type != ValueType::Object && type != ValueType::Array)
+        {
+            return false;
+        }
+
+        ++m_position;
+        m_containers.push_back({ type == ValueType::Object ? '}' : ']', false });
+        return true;
+    }
+
+    bool StreamingReader::NextItem()
+    {
+        Container& container = m_containers.back();
+
+        if (PeekChar() == container.End)
+        {
+            ++m_position;
+            m_containers.pop_back();
+            return false;
+        }
+
+        if (container.HasItems)
+        {
+            Expect(',');
+        }
+
+        container.HasItems = true;
+        return true;
+    }
+
+    void StreamingReader::ThrowInvalid(std::string_view reason)
+    {
+        AICLI_LOG(Core, Error, << "Invalid JSON at offset " << m_position << ": " << reason);
+        THROW_HR(APPINSTALLER_CLI_ERROR_JSON_INVALID_FILE);
+    }
+}
@@ -16,50 +16,60 @@ namespace AppInstaller::Manifest
                 set.emplace(Utility::FoldCase(value));
             }
         }
-    }
-
-    void Manifest::ApplyLocale(const std::string& locale)
-    {
-        CurrentLocalization = DefaultLocalization;
 
         // Get target locale from Preferred Languages settings if applicable
-        std::vector<std::string> targetLocales;
-        if (locale.empty())
-        {
-            targetLocales = Locale::GetUserPreferredLanguages();
-        }
-        else
+        std::vector<std::string> GetTargetLocales(const std::string& locale)
         {
-            targetLocales.emplace_back(locale);
+            std::vector<std::string> targetLocales;
+            if (locale.empty())
+            {
+                targetLocales = Locale::GetUserPreferredLanguages();
+            }
+            else
+            {
+                targetLocales.emplace_back(locale);
+            }
+
+            return targetLocales;
         }
 
-        for (auto const& targetLocale : targetLocales)
+        void ApplyTargetLocales(Manifest& manifest, const std::vector<std::string>& targetLocales)
         {
-            const ManifestLocalization* bestLocalization = nullptr;
-            double bestScore = Locale::GetDistanceOfLanguage(targetLocale, DefaultLocalization.Locale);
+            manifest.CurrentLocalization = manifest.DefaultLocalization;
 
-            for (auto const& localization : Localizations)
+            for (auto const& targetLocale : targetLocales)
             {
-                double score = Locale::GetDistanceOfLanguage(targetLocale, localization.Locale);
-                if (score > bestScore)
+                const ManifestLocalization* bestLocalization = nullptr;
+                double bestScore = Locale::GetDistanceOfLanguage(targetLocale, manifest.DefaultLocalization.Locale);
+
+                for (auto const& localization : manifest.Localizations)
                 {
-                    bestLocalization = &localization;
-                    bestScore = score;
+                    double score = Locale::GetDistanceOfLanguage(targetLocale, localization.Locale);
+                    if (score > bestScore)
+                    {
+                        bestLocalization = &localization;
+                        bestScore = score;
+                    }
                 }
-            }
 
-            // If there's better locale than default And is compatible with target locale, merge and return;
-            if (bestScore >= Locale::MinimumDistanceScoreAsCompatibleMatch)
-            {
-                if (bestLocalization != nullptr)
+                // If there's better locale than default And is compatible with target locale, merge and return;
+                if (bestScore >= Locale::MinimumDistanceScoreAsCompatibleMatch)
                 {
-                    CurrentLocalization.ReplaceOrMergeWith(*bestLocalization);
+                    if (bestLocalization != nullptr)
+                    {
+                        manifest.CurrentLocalization.ReplaceOrMergeWith(*bestLocalization);
+                    }
+                    break;
                 }
-                break;
             }
         }
     }
 
+    void Manifest::ApplyLocale(const std::string& locale)
+    {
+        ApplyTargetLocales(*this, GetTargetLocales(locale));
+    }
+
     std::vector<string_t> Manifest::GetAggregatedTags() const
     {
         std::vector<string_t> resultTags = DefaultLocalization.Get<Localization::Tags>();
@@ -240,4 +250,32 @@ namespace AppInstaller::Manifest
 
         return result;
     }
+
+    SharedManifest::SharedManifest() : m_data(std::make_shared<Data>(Manifest{})) {}
+
+    SharedManifest::SharedManifest(Manifest manifest) : m_data(std::make_shared<Data>(std::move(manifest))) {}
+
+    Manifest& SharedManifest::Edit()
+    {
+        if (m_data.use_count() > 1)
+        {
+            m_data = std::make_shared<Data>(m_data->Value);
+        }
+
+        m_data->AppliedLocales.reset();
+        return m_data->Value;
+    }
+
+    void SharedManifest::ApplyLocale(const std::string& locale)
+    {
+        std::vector<std::string> targetLocales = GetTargetLocales(locale);
+
+        if (m_data->AppliedLocales == targetLocales)
+        {
+            return;
+        }
+
+        ApplyTargetLocales(Edit(), targetLocales);
+        m_data->AppliedLocales = std::move(targetLocales);
+    }
 }
\ No newline at end of file
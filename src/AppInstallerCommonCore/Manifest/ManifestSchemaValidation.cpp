@@ -7,6 +7,7 @@
 #include "winget/ManifestSchemaValidation.h"
 #include "winget/ManifestYamlParser.h"
 #include "winget/Resources.h"
+#include "winget/Tracing.h"
 
 #include <ManifestSchema.h>
 
@@ -176,6 +177,8 @@ namespace AppInstaller::Manifest::YamlParser
 
     std::vector<ValidationError> ValidateAgainstSchema(const std::vector<YamlManifestInfo>& manifestList, const ManifestVer& manifestVersion)
     {
+        AICLI_TRACE_SPAN(YAML, "YamlParser::ValidateAgainstSchema");
+
         std::vector<ValidationError> errors;
         // A list of schema validator to avoid multiple loadings of same schema
         std::map<ManifestTypeEnum, valijson::Schema> schemaList;
@@ -11,6 +11,14 @@ namespace AppInstaller::Manifest
 
     namespace
     {
+        // The fields that every file of a multi file manifest contains; only the root (installer) manifest's values are used.
+        constexpr std::string_view s_MultiFileCommonFields[] = { "PackageIdentifier"sv, "PackageVersion"sv, "ManifestType"sv, "ManifestVersion"sv };
+
+        bool IsMultiFileCommonField(std::string_view key)
+        {
+            return std::find(std::begin(s_MultiFileCommonFields), std::end(s_MultiFileCommonFields), key) != std::end(s_MultiFileCommonFields);
+        }
+
         // Only used in preview manifest
         std::vector<Manifest::string_t> SplitMultiValueField(const std::string& input)
         {
@@ -665,19 +673,48 @@ namespace AppInstaller::Manifest
 
         // Keeps track of already processed fields. Used to check duplicate fields.
         std::set<std::string> processedFields;
+        ProcessFields(rootNode, fieldInfos, processedFields, false, resultErrors);
+
+        return resultErrors;
+    }
+
+    size_t ManifestYamlPopulator::ProcessFields(
+        const YAML::Node& rootNode,
+        const std::vector<FieldProcessInfo>& fieldInfos,
+        std::set<std::string>& processedFields,
+        bool skipMultiFileCommonFields,
+        ValidationErrors& resultErrors)
+    {
+        size_t result = 0;
 
         for (auto const& keyValuePair : rootNode.Mapping())
         {
             std::string key = keyValuePair.first.as<std::string>();
             const YAML::Node& valueNode = keyValuePair.second;
 
-            // We'll do case insensitive search first and validate correct case later.
+            if (skipMultiFileCommonFields && IsMultiFileCommonField(key))
+            {
+                continue;
+            }
+
+            ++result;
+
+            // Fields are required to be Pascal Case, so look for an exact match before the more expensive case insensitive search.
             auto fieldIter = std::find_if(fieldInfos.begin(), fieldInfos.end(),
                 [&](auto const& s)
                 {
-                    return Utility::CaseInsensitiveEquals(s.Name, key);
+                    return s.Name == key;
                 });
 
+            if (fieldIter == fieldInfos.end())
+            {
+                fieldIter = std::find_if(fieldInfos.begin(), fieldInfos.end(),
+                    [&](auto const& s)
+                    {
+                        return Utility::CaseInsensitiveEquals(s.Name, key);
+                    });
+            }
+
             if (fieldIter != fieldInfos.end())
             {
                 const FieldProcessInfo& fieldInfo = *fieldIter;
@@ -724,7 +761,7 @@ namespace AppInstaller::Manifest
             }
         }
 
-        return resultErrors;
+        return result;
     }
 
     ValidationErrors ManifestYamlPopulator::ProcessPackageDependenciesNode(const YAML::Node& rootNode)
@@ -928,8 +965,87 @@ namespace AppInstaller::Manifest
 
         ValidationErrors resultErrors;
         manifest.ManifestVersion = manifestVersion;
+        PrepareFieldInfos(manifestVersion);
+
+        // Populate root
+        m_p_manifest = &manifest;
+        m_p_installer = &(manifest.DefaultInstallerInfo);
+        m_p_localization = &(manifest.DefaultLocalization);
+        resultErrors = ValidateAndProcessFields(rootNode, RootFieldInfos);
+
+        PopulateInstallersAndLocalizations(manifest, resultErrors);
+
+        return resultErrors;
+    }
+
+    ValidationErrors ManifestYamlPopulator::PopulateMultiFileManifestInternal(
+        const YAML::Node& installerNode,
+        const YAML::Node& defaultLocaleNode,
+        const std::vector<const YAML::Node*>& localeNodes,
+        Manifest& manifest,
+        const ManifestVer& manifestVersion,
+        ManifestValidateOption validateOption)
+    {
+        m_validateOption = validateOption;
+        // Errors are reported the same as for a merged manifest, as the locations are not associated with a file.
+        m_isMergedManifest = true;
+
+        ValidationErrors resultErrors;
+        manifest.ManifestVersion = manifestVersion;
+        PrepareFieldInfos(manifestVersion);
+
+        // Populate root from the installer manifest and default locale manifest together, so that
+        // a field present in both is reported as a duplicate.
+        m_p_manifest = &manifest;
+        m_p_installer = &(manifest.DefaultInstallerInfo);
+        m_p_localization = &(manifest.DefaultLocalization);
+
+        if (!installerNode.IsMap() || installerNode.size() == 0)
+        {
+            resultErrors.emplace_back(ManifestError::InvalidRootNode);
+            return resultErrors;
+        }
+
+        std::set<std::string> processedFields;
+        ProcessFields(installerNode, RootFieldInfos, processedFields, false, resultErrors);
+
+        if (defaultLocaleNode.IsMap())
+        {
+            ProcessFields(defaultLocaleNode, RootFieldInfos, processedFields, true, resultErrors);
+        }
+
+        if (!localeNodes.empty())
+        {
+            // The locale manifests take the place of any Localization field.
+            if (m_p_localizationsNode)
+            {
+                resultErrors.emplace_back(ManifestError::FieldDuplicate, "Localization");
+                m_p_localizationsNode = nullptr;
+            }
+        }
+
+        PopulateInstallersAndLocalizations(manifest, resultErrors);
+
+        // Populate additional localizations from the locale manifests
+        for (const YAML::Node* localeNode : localeNodes)
+        {
+            ManifestLocalization localization;
+            m_p_localization = &localization;
+
+            std::set<std::string> processedLocalizationFields;
+            if (!localeNode->IsMap() || ProcessFields(*localeNode, LocalizationFieldInfos, processedLocalizationFields, true, resultErrors) == 0)
+            {
+                resultErrors.emplace_back(ManifestError::InvalidRootNode);
+            }
+
+            manifest.Localizations.emplace_back(std::move(localization));
+        }
+
+        return resultErrors;
+    }
 
-        // Prepare field infos
+    void ManifestYamlPopulator::PrepareFieldInfos(const ManifestVer& manifestVersion)
+    {
         RootFieldInfos = GetRootFieldProcessInfo(manifestVersion);
         InstallerFieldInfos = GetInstallerFieldProcessInfo(manifestVersion);
         SwitchesFieldInfos = GetSwitchesFieldProcessInfo(manifestVersion);
@@ -945,16 +1061,13 @@ namespace AppInstaller::Manifest
         NestedInstallerFileFieldInfos = GetNestedInstallerFileFieldProcessInfo(manifestVersion);
         InstallationMetadataFieldInfos = GetInstallationMetadataFieldProcessInfo(manifestVersion);
         InstallationMetadataFilesFieldInfos = GetInstallationMetadataFilesFieldProcessInfo(manifestVersion);
+    }
 
-        // Populate root
-        m_p_manifest = &manifest;
-        m_p_installer = &(manifest.DefaultInstallerInfo);
-        m_p_localization = &(manifest.DefaultLocalization);
-        resultErrors = ValidateAndProcessFields(rootNode, RootFieldInfos);
-
+    void ManifestYamlPopulator::PopulateInstallersAndLocalizations(Manifest& manifest, ValidationErrors& resultErrors)
+    {
         if (!m_p_installersNode)
         {
-            return resultErrors;
+            return;
         }
 
         // Populate installers
@@ -1047,8 +1160,6 @@ namespace AppInstaller::Manifest
                 manifest.Localizations.emplace_back(std::move(std::move(localization)));
             }
         }
-
-        return resultErrors;
     }
 
     ValidationErrors ManifestYamlPopulator::PopulateManifest(
@@ -1060,4 +1171,16 @@ namespace AppInstaller::Manifest
         ManifestYamlPopulator manifestPopulator;
         return manifestPopulator.PopulateManifestInternal(rootNode, manifest, manifestVersion, validateOption);
     }
+
+    ValidationErrors ManifestYamlPopulator::PopulateManifest(
+        const YAML::Node& installerNode,
+        const YAML::Node& defaultLocaleNode,
+        const std::vector<const YAML::Node*>& localeNodes,
+        Manifest& manifest,
+        const ManifestVer& manifestVersion,
+        ManifestValidateOption validateOption)
+    {
+        ManifestYamlPopulator manifestPopulator;
+        return manifestPopulator.PopulateMultiFileManifestInternal(installerNode, defaultLocaleNode, localeNodes, manifest, manifestVersion, validateOption);
+    }
 }
\ No newline at end of file
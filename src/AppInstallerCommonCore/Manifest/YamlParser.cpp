@@ -6,6 +6,7 @@
 #include "winget/ManifestSchemaValidation.h"
 #include "winget/ManifestYamlPopulator.h"
 #include "winget/ManifestYamlParser.h"
+#include "winget/Tracing.h"
 
 namespace AppInstaller::Manifest::YamlParser
 {
@@ -426,10 +427,30 @@ namespace AppInstaller::Manifest::YamlParser
                 return resultErrors;
             }
 
-            // Merge manifests in multi file manifest case
-            const YAML::Node& manifestDoc = (input.size() > 1) ? MergeMultiFileManifest(input) : input[0].Root;
+            std::vector<ValidationError> errors;
+
+            if (input.size() > 1)
+            {
+                // Populate directly from the individual files of a multi file manifest, rather than merging them first
+                std::vector<const YAML::Node*> localeNodes;
+                for (const auto& entry : input)
+                {
+                    if (entry.ManifestType == ManifestTypeEnum::Locale)
+                    {
+                        localeNodes.emplace_back(&entry.Root);
+                    }
+                }
+
+                errors = ManifestYamlPopulator::PopulateManifest(
+                    FindUniqueRequiredDocFromMultiFileManifest(input, ManifestTypeEnum::Installer),
+                    FindUniqueRequiredDocFromMultiFileManifest(input, ManifestTypeEnum::DefaultLocale),
+                    localeNodes, manifest, manifestVersion, validateOption);
+            }
+            else
+            {
+                errors = ManifestYamlPopulator::PopulateManifest(input[0].Root, manifest, manifestVersion, validateOption);
+            }
 
-            auto errors = ManifestYamlPopulator::PopulateManifest(manifestDoc, manifest, manifestVersion, validateOption);
             std::move(errors.begin(), errors.end(), std::inserter(resultErrors, resultErrors.end()));
 
             // Extra semantic validations after basic validation and field population
@@ -448,7 +469,7 @@ namespace AppInstaller::Manifest::YamlParser
             // Output merged manifest if requested
             if (!mergedManifestPath.empty())
             {
-                OutputYamlDoc(manifestDoc, mergedManifestPath);
+                OutputYamlDoc(MergeMultiFileManifest(input), mergedManifestPath);
             }
 
             // If there is only one input file, use its hash for the stream
@@ -466,6 +487,12 @@ namespace AppInstaller::Manifest::YamlParser
         ManifestValidateOption validateOption,
         const std::filesystem::path& mergedManifestPath)
     {
+        Logging::TraceSpan span{ Logging::Channel::YAML, "YamlParser::CreateFromPath" };
+        if (span)
+        {
+            span.AddArgument("path", inputPath.u8string());
+        }
+
         std::vector<YamlManifestInfo> docList;
 
         try
@@ -503,6 +530,9 @@ namespace AppInstaller::Manifest::YamlParser
         ManifestValidateOption validateOption,
         const std::filesystem::path& mergedManifestPath)
     {
+        Logging::TraceSpan span{ Logging::Channel::YAML, "YamlParser::Create" };
+        span.AddArgument("length", input.length());
+
         std::vector<YamlManifestInfo> docList;
 
         try
@@ -524,6 +554,9 @@ namespace AppInstaller::Manifest::YamlParser
         ManifestValidateOption validateOption,
         const std::filesystem::path& mergedManifestPath)
     {
+        Logging::TraceSpan span{ Logging::Channel::YAML, "YamlParser::ParseManifest" };
+        span.AddArgument("documents", input.size());
+
         Manifest manifest;
         std::vector<ValidationError> errors;
 
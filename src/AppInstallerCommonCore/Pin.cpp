@@ -115,4 +115,34 @@ namespace AppInstaller::Pinning
             m_key == other.m_key &&
             m_gatedVersion == other.m_gatedVersion;
     }
+
+    size_t PinKeyHash::operator()(const PinKey& key) const
+    {
+        std::hash<std::string> hasher;
+        size_t result = hasher(key.PackageId);
+        result ^= hasher(key.SourceId) + 0x9e3779b9 + (result << 6) + (result >> 2);
+        return result;
+    }
+
+    PinLookup::PinLookup(std::vector<Pin>&& pins)
+    {
+        m_pins.reserve(pins.size());
+
+        for (auto& pin : pins)
+        {
+            PinKey key = pin.GetKey();
+            m_pins.emplace(std::move(key), std::move(pin));
+        }
+    }
+
+    std::optional<Pin> PinLookup::GetPin(const PinKey& pinKey) const
+    {
+        auto itr = m_pins.find(pinKey);
+        if (itr == m_pins.end())
+        {
+            return {};
+        }
+
+        return itr->second;
+    }
 }
\ No newline at end of file
@@ -2,15 +2,26 @@
 // Licensed under the MIT License.
 #pragma once
 #include <AppInstallerLogging.h>
+#include <winget/MPSCRingBuffer.h>
+#include <wil/resource.h>
 
+#include <atomic>
+#include <chrono>
 #include <filesystem>
 #include <fstream>
+#include <memory>
+#include <mutex>
+#include <optional>
 #include <string>
 #include <string_view>
+#include <thread>
 
 namespace AppInstaller::Logging
 {
     // Logs to a file.
+    // Writes are queued without taking a lock and written in batches by a background thread, which producers wake
+    // when there is something to write. Errors are written out immediately, as is everything queued on Shutdown,
+    // on destruction, and (once EnableFlushOnFailure is called) when the process terminates or crashes.
     struct FileLogger : public ILogger
     {
         FileLogger();
@@ -22,8 +33,8 @@ namespace AppInstaller::Logging
         FileLogger(const FileLogger&) = delete;
         FileLogger& operator=(const FileLogger&) = delete;
 
-        FileLogger(FileLogger&&) = default;
-        FileLogger& operator=(FileLogger&&) = default;
+        FileLogger(FileLogger&&) = delete;
+        FileLogger& operator=(FileLogger&&) = delete;
 
         static std::string GetNameForPath(const std::filesystem::path& filePath);
 
@@ -37,6 +48,8 @@ namespace AppInstaller::Logging
 
         void WriteDirect(Channel channel, Level level, std::string_view message) noexcept override;
 
+        void WriteFormatted(Channel channel, Level level, const LogFormatRecord& record) noexcept override;
+
         // Adds a FileLogger to the current Log
         static void Add();
         static void Add(const std::filesystem::path& filePath);
@@ -46,11 +59,65 @@ namespace AppInstaller::Logging
         static void BeginCleanup();
         static void BeginCleanup(const std::filesystem::path& filePath);
 
+        // Installs std::terminate and unhandled exception handlers that write out the logs queued by all loggers
+        // before the process goes down; the previous handlers are called afterwards.
+        static void EnableFlushOnFailure();
+
+        // Writes all queued logs to the file and flushes it.
+        void Flush() noexcept override;
+
+        // Writes all queued logs and stops the background writer, waiting for it to exit.
+        // Later logs are written on the logging thread.
+        void Shutdown() noexcept override;
+
     private:
+        // A log line waiting to be written by the background thread.
+        struct Entry
+        {
+            std::chrono::system_clock::time_point Time;
+            Channel LogChannel = Channel::All;
+            bool IsDirect = false;
+            std::string Message;
+            // When present, the message is produced from this record by the writer.
+            std::optional<LogFormatRecord> Record;
+        };
+
+        // The state used by the writer thread. The thread holds a reference to it, so that a logger destroyed without
+        // being shut down (such as by a static destructor under the loader lock) does not need to wait for the thread.
+        struct WriterState
+        {
+            std::ofstream Stream;
+
+            Utility::MPSCRingBuffer<Entry> Queue{ 4096 };
+            // Held by whichever thread is currently acting as the consumer of the queue.
+            std::mutex StreamLock;
+            // The thread holding StreamLock, so that a failure while it is draining does not wait on itself.
+            std::atomic<DWORD> DrainingThreadId = 0;
+
+            // Set by the first producer to queue an entry since the writer last woke.
+            wil::unique_event WakeWriter;
+            std::atomic_bool WakePending = false;
+            std::atomic_bool StopWriter = false;
+
+            // Adds the entry to the queue, draining it on this thread if it is full.
+            void Enqueue(Entry&& entry);
+
+            // Writes all queued entries; must be called with StreamLock held.
+            void DrainQueue();
+
+            void Flush() noexcept;
+
+            void WriterThreadProc();
+        };
+
         std::string m_name;
         std::filesystem::path m_filePath;
-        std::ofstream m_stream;
+        std::shared_ptr<WriterState> m_state = std::make_shared<WriterState>();
+        std::thread m_writerThread;
 
         void OpenFileLoggerStream();
+
+        // Queues the entry, writing it out immediately for errors or once the writer has stopped.
+        void Submit(Channel channel, Level level, Entry&& entry);
     };
 }
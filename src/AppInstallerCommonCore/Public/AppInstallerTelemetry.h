@@ -252,6 +252,10 @@ namespace AppInstaller::Logging
 
         void LogNonFatalDOError(std::string_view url, HRESULT hr) const noexcept;
 
+        // Logs a change to the number of items that an orchestrator queue runs at once, along with the
+        // aggregate throughput (in bytes per second) that led to the change.
+        void LogOrchestratorQueueConcurrency(std::string_view queueName, uint32_t concurrency, uint64_t throughput) const noexcept;
+
     protected:
         bool IsTelemetryEnabled() const noexcept;
 
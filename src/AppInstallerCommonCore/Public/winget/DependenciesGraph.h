@@ -3,7 +3,7 @@
 #pragma once
 #include "winget/ManifestCommon.h"
 
-namespace AppInstaller::Manifest 
+namespace AppInstaller::Manifest
 {
     struct DependencyGraph
     {
@@ -15,6 +15,7 @@ namespace AppInstaller::Manifest
 
         void BuildGraph();
 
+        // Adds the node if it is not already in the graph.
         void AddNode(const Dependency& node);
 
         void AddAdjacent(const Dependency& node, const Dependency& adjacent);
@@ -23,20 +24,32 @@ namespace AppInstaller::Manifest
 
         bool HasLoop();
 
+        // Walks the graph once from the root, detecting loops and computing the installation order.
         void CheckForLoopsAndGetOrder();
 
         std::vector<Dependency> GetInstallationOrder();
 
+        // Gets the nodes of the first loop found, in dependency order; empty if there is no loop.
+        std::vector<Dependency> GetLoop();
+
     private:
-        // TODO make this function iterative
-        bool HasLoopDFS(std::set<Dependency> visited, const Dependency& node);
+        using NodeIndex = size_t;
+
+        // Gets the index of the node, adding it if it is not already in the graph.
+        NodeIndex GetOrAddNode(const Dependency& node);
+
+        // Nodes are referred to by their index in m_nodes; the root is always the first node.
+        std::vector<Dependency> m_nodes;
+        std::map<Dependency, NodeIndex> m_nodeIndices;
+        std::vector<std::vector<NodeIndex>> m_adjacents;
 
-        const Dependency& m_root;
-        std::map<Dependency, std::set<Dependency>> m_adjacents;
         std::function<const DependencyList(const Dependency&)> getDependencies;
         bool m_HasLoop = false;
         bool m_rootDependencyEvaluated = false;
         std::vector<Dependency> m_installationOrder;
-        std::vector<Dependency> m_toCheck;
+        std::vector<Dependency> m_loop;
+
+        // Nodes before this index have already had their dependencies added.
+        NodeIndex m_nextToCheck = 1;
     };
 }
@@ -0,0 +1,70 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+#pragma once
+#include <AppInstallerSHA256.h>
+
+#include <filesystem>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace AppInstaller::Utility
+{
+    // Caches the SHA256 hashes of files by path.
+    // A cached hash is only used while the size and last write time of the file are unchanged.
+    struct FileHashCache
+    {
+        // The hash of a file, or the error that prevented hashing it.
+        struct FileHash
+        {
+            SHA256::HashBuffer Hash;
+            HRESULT Error = S_OK;
+        };
+
+        // The default maximum number of hashes kept; when it is reached, the oldest hashes are removed.
+        static constexpr size_t DefaultMaximumEntries = 4096;
+
+        // Creates a cache that is only kept in memory.
+        FileHashCache() = default;
+
+        // Creates a cache that is read from the given file, and written back to it by Save.
+        FileHashCache(std::filesystem::path storagePath, size_t maximumEntries = DefaultMaximumEntries);
+
+        FileHashCache(const FileHashCache&) = delete;
+        FileHashCache& operator=(const FileHashCache&) = delete;
+
+        FileHashCache(FileHashCache&&) = delete;
+        FileHashCache& operator=(FileHashCache&&) = delete;
+
+        // Gets the in memory cache shared by the whole process.
+        static FileHashCache& Instance();
+
+        // Gets the hashes of the files, in the same order as the paths.
+        // The files that are not in the cache are hashed concurrently.
+        std::vector<FileHash> GetHashes(const std::vector<std::filesystem::path>& paths);
+
+        // Writes the cache to its file, if it has one and it has changed.
+        // The file is replaced as a whole, so readers never see a partially written cache.
+        void Save();
+
+    private:
+        struct Entry
+        {
+            uintmax_t Size = 0;
+            int64_t LastWriteTime = 0;
+            SHA256::HashBuffer Hash;
+            // The order in which the hashes were added, used to remove the oldest when the cache is full.
+            uint64_t Order = 0;
+        };
+
+        void Set(const std::string& key, Entry&& entry);
+
+        std::filesystem::path m_storagePath;
+        size_t m_maximumEntries = DefaultMaximumEntries;
+        std::mutex m_lock;
+        std::unordered_map<std::string, Entry> m_entries;
+        uint64_t m_nextOrder = 0;
+        bool m_changed = false;
+    };
+}
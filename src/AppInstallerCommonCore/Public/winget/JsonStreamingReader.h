@@ -0,0 +1,106 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+#pragma once
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace AppInstaller::JSON
+{
+    // The type of a JSON value.
+    enum class ValueType
+    {
+        Null,
+        Boolean,
+        Number,
+        String,
+        Array,
+        Object,
+    };
+
+    // A forward only reader over UTF-8 JSON text.
+    // Values are visited in document order without building a tree, and strings are unescaped directly into UTF-8.
+    // Every member name returned by NextMember and every element signaled by NextElement must have its value
+    // consumed by exactly one call to Begin*, Read* or SkipValue.
+    // Malformed input throws APPINSTALLER_CLI_ERROR_JSON_INVALID_FILE.
+    struct StreamingReader
+    {
+        StreamingReader(std::string_view input);
+
+        StreamingReader(const StreamingReader&) = delete;
+        StreamingReader& operator=(const StreamingReader&) = delete;
+
+        StreamingReader(StreamingReader&&) = default;
+        StreamingReader& operator=(StreamingReader&&) = default;
+
+        // Determines whether only whitespace remains in the input.
+        bool IsAtEnd();
+
+        // Gets the type of the next value without consuming it.
+        ValueType PeekType();
+
+        // If the next value is an object, enters it and returns true; its members must then be read until NextMember returns nothing.
+        // Otherwise, the value is skipped and false is returned.
+        bool BeginObject();
+
+        // Gets the name of the next member of the current object, or nothing if the end of the object was reached.
+        // The returned view is only valid until the next call on the reader.
+        std::optional<std::string_view> NextMember();
+
+        // If the next value is an array, enters it and returns true; its elements must then be read until NextElement returns false.
+        // Otherwise, the value is skipped and false is returned.
+        bool BeginArray();
+
+        // Determines whether there is another element in the current array, leaving the end of the array if not.
+        bool NextElement();
+
+        // Reads the next value if it is of the requested type; otherwise the value is skipped and nothing is returned.
+        // The integer functions also return nothing for numbers that are not integers, and throw for integers that do not fit.
+        std::optional<std::string> ReadString();
+        std::optional<bool> ReadBool();
+        std::optional<int> ReadInt();
+        std::optional<int64_t> ReadInt64();
+
+        // Reads the string values from the next value if it is an array; other values are skipped.
+        std::vector<std::string> ReadStringArray();
+
+        // Skips the next value, returning the JSON text that it spans.
+        std::string_view SkipValue();
+
+        // Ensures that the whole input has been consumed.
+        void EndDocument();
+
+    private:
+        struct Container
+        {
+            char End;
+            bool HasItems;
+        };
+
+        char PeekChar();
+        void Expect(char c);
+        void ExpectLiteral(std::string_view literal);
+
+        // Reads the string at the current position. When the string contains no escapes, the returned view refers
+        // directly to the input; otherwise the unescaped value is written to the buffer and a view of it is returned.
+        std::string_view ReadStringToken(std::string& buffer);
+        void SkipStringToken();
+        void SkipNumberToken();
+        void SkipScalarToken(ValueType type);
+
+        // Enters the container at the current position, returning false if the type is not a container.
+        bool EnterContainer(ValueType type);
+
+        // Moves to the next item of the current container, returning false if the end was reached.
+        bool NextItem();
+
+        [[noreturn]] void ThrowInvalid(std::string_view reason);
+
+        std::string_view m_input;
+        size_t m_position = 0;
+        std::vector<Container> m_containers;
+        std::string m_nameBuffer;
+    };
+}
@@ -7,6 +7,8 @@
 #include <winget/ManifestInstaller.h>
 #include <winget/ManifestLocalization.h>
 
+#include <memory>
+#include <optional>
 #include <vector>
 
 namespace AppInstaller::Manifest
@@ -72,4 +74,46 @@ namespace AppInstaller::Manifest
             std::function<const string_t& (const ManifestInstaller&)> extractStringFromInstaller = {},
             std::function<const string_t& (const AppsAndFeaturesEntry&)> extractStringFromAppsAndFeaturesEntry = {}) const;
     };
+
+    // A reference counted manifest that is cheap to copy between sources, contexts and callers.
+    // The manifest is immutable while it is shared; Edit makes a private copy first if any other owner exists.
+    struct SharedManifest
+    {
+        SharedManifest();
+        SharedManifest(Manifest manifest);
+
+        SharedManifest(const SharedManifest&) = default;
+        SharedManifest& operator=(const SharedManifest&) = default;
+
+        SharedManifest(SharedManifest&&) = default;
+        SharedManifest& operator=(SharedManifest&&) = default;
+
+        const Manifest& Get() const { return m_data->Value; }
+        const Manifest& operator*() const { return m_data->Value; }
+        const Manifest* operator->() const { return &m_data->Value; }
+        operator const Manifest&() const { return m_data->Value; }
+
+        // Gets a mutable manifest, copying it first if it is shared.
+        Manifest& Edit();
+
+        // Applies the locale as Manifest::ApplyLocale does.
+        // No copy is made if the shared manifest already has the same locale applied.
+        void ApplyLocale(const std::string& locale = {});
+
+        // Determines whether both refer to the same underlying manifest.
+        bool IsSharedWith(const SharedManifest& other) const { return m_data == other.m_data; }
+
+    private:
+        struct Data
+        {
+            Data(Manifest value) : Value(std::move(value)) {}
+
+            Manifest Value;
+
+            // The target locales of the last ApplyLocale, cleared on any other edit.
+            std::optional<std::vector<std::string>> AppliedLocales;
+        };
+
+        std::shared_ptr<Data> m_data;
+    };
 }
\ No newline at end of file
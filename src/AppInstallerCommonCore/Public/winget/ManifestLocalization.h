@@ -3,7 +3,9 @@
 #pragma once
 #include <AppInstallerStrings.h>
 
-#include <variant>
+#include <optional>
+#include <tuple>
+#include <utility>
 
 namespace AppInstaller::Manifest
 {
@@ -89,15 +91,21 @@ namespace AppInstaller::Manifest
             using value_t = std::vector<Icon>;
         };
 
-        // Used to deduce the LocalizationVariant type; making a variant that includes std::monostate and all LocalizationMapping types.
+        // Used to deduce the LocalizationStorage type; making a tuple with an optional slot for every LocalizationMapping type.
         template <size_t... I>
-        inline auto Deduce(std::index_sequence<I...>) { return std::variant<std::monostate, typename LocalizationMapping<static_cast<Localization>(I)>::value_t...>{}; }
+        inline auto Deduce(std::index_sequence<I...>) { return std::tuple<std::optional<typename LocalizationMapping<static_cast<Localization>(I)>::value_t>...>{}; }
 
-        // Holds data of any type listed in a LocalizationMapping.
-        using LocalizationVariant = decltype(Deduce(std::make_index_sequence<static_cast<size_t>(Localization::Max)>()));
+        using LocalizationIndices = std::make_index_sequence<static_cast<size_t>(Localization::Max)>;
 
-        // Gets the index into the variant for the given Localization.
-        constexpr inline size_t LocalizationIndex(Localization l) { return static_cast<size_t>(l) + 1; }
+        // Holds the data for every Localization, indexed by its value.
+        using LocalizationStorage = decltype(Deduce(LocalizationIndices{}));
+
+        // Gets the index into the storage for the given Localization.
+        constexpr inline size_t LocalizationIndex(Localization l) { return static_cast<size_t>(l); }
+
+        // An empty value for each Localization, returned when it is not present.
+        template <Localization L>
+        inline const typename LocalizationMapping<L>::value_t EmptyLocalizationValue{};
     }
 
     struct ManifestLocalization
@@ -108,43 +116,44 @@ namespace AppInstaller::Manifest
         template <Localization L>
         void Add(typename details::LocalizationMapping<L>::value_t&& v)
         {
-            m_data[L].emplace<details::LocalizationIndex(L)>(std::forward<typename details::LocalizationMapping<L>::value_t>(v));
+            std::get<details::LocalizationIndex(L)>(m_data).emplace(std::forward<typename details::LocalizationMapping<L>::value_t>(v));
         }
         template <Localization L>
         void Add(const typename details::LocalizationMapping<L>::value_t& v)
         {
-            m_data[L].emplace<details::LocalizationIndex(L)>(v);
+            std::get<details::LocalizationIndex(L)>(m_data).emplace(v);
         }
 
         // Return a value indicating whether the given localization type exists.
-        bool Contains(Localization l) const { return (m_data.find(l) != m_data.end()); }
+        bool Contains(Localization l) const { return Contains(l, details::LocalizationIndices{}); }
 
         // Gets the localization value if exists, otherwise empty for easier access
         template <Localization L>
-        typename details::LocalizationMapping<L>::value_t Get() const
+        const typename details::LocalizationMapping<L>::value_t& Get() const
         {
-            auto itr = m_data.find(L);
-            if (itr == m_data.end())
-            {
-                return {};
-            }
-            else
-            {
-                return std::get<details::LocalizationIndex(L)>(itr->second);
-            }
+            const auto& value = std::get<details::LocalizationIndex(L)>(m_data);
+            return value ? value.value() : details::EmptyLocalizationValue<L>;
         }
 
         void ReplaceOrMergeWith(const ManifestLocalization& other)
         {
-            for (auto const& entry : other.m_data)
-            {
-                this->m_data[entry.first] = entry.second;
-            }
-
+            ReplaceOrMergeWith(other, details::LocalizationIndices{});
             this->Locale = other.Locale;
         }
 
     private:
-        std::map<Localization, details::LocalizationVariant> m_data;
+        template <size_t... I>
+        bool Contains(Localization l, std::index_sequence<I...>) const
+        {
+            return ((details::LocalizationIndex(l) == I && std::get<I>(m_data).has_value()) || ...);
+        }
+
+        template <size_t... I>
+        void ReplaceOrMergeWith(const ManifestLocalization& other, std::index_sequence<I...>)
+        {
+            ((std::get<I>(other.m_data) ? void(std::get<I>(m_data) = std::get<I>(other.m_data)) : void()), ...);
+        }
+
+        details::LocalizationStorage m_data;
     };
 }
\ No newline at end of file
@@ -15,6 +15,17 @@ namespace AppInstaller::Manifest
             const ManifestVer& manifestVersion,
             ManifestValidateOption validateOption);
 
+        // Populates the manifest from the documents of a multi file manifest as though they had been merged.
+        // The installer manifest is the root, the default locale manifest's fields are added to the root and
+        // each locale manifest becomes an additional localization; no merged document is created.
+        static std::vector<ValidationError> PopulateManifest(
+            const YAML::Node& installerNode,
+            const YAML::Node& defaultLocaleNode,
+            const std::vector<const YAML::Node*>& localeNodes,
+            Manifest& manifest,
+            const ManifestVer& manifestVersion,
+            ManifestValidateOption validateOption);
+
     private:
 
         bool m_isMergedManifest = false;
@@ -92,6 +103,16 @@ namespace AppInstaller::Manifest
             const YAML::Node& rootNode,
             const std::vector<FieldProcessInfo>& fieldInfos);
 
+        // Processes the fields of the node, sharing the set of processed fields so that multiple nodes can be
+        // processed as one. When skipMultiFileCommonFields is set, the fields that every file of a multi file
+        // manifest contains are skipped. Returns the number of fields that were not skipped.
+        size_t ProcessFields(
+            const YAML::Node& rootNode,
+            const std::vector<FieldProcessInfo>& fieldInfos,
+            std::set<std::string>& processedFields,
+            bool skipMultiFileCommonFields,
+            std::vector<ValidationError>& resultErrors);
+
         void ProcessDependenciesNode(DependencyType type, const YAML::Node& rootNode);
         std::vector<ValidationError> ProcessPackageDependenciesNode(const YAML::Node& rootNode);
         std::vector<ValidationError> ProcessAgreementsNode(const YAML::Node& agreementsNode);
@@ -103,10 +124,23 @@ namespace AppInstaller::Manifest
         std::vector<ValidationError> ProcessNestedInstallerFilesNode(const YAML::Node& nestedInstallerFilesNode);
         std::vector<ValidationError> ProcessInstallationMetadataFilesNode(const YAML::Node& installedFilesNode);
 
+        void PrepareFieldInfos(const ManifestVer& manifestVersion);
+
+        // Populates the installers and localizations once the root fields have been processed.
+        void PopulateInstallersAndLocalizations(Manifest& manifest, std::vector<ValidationError>& resultErrors);
+
         std::vector<ValidationError> PopulateManifestInternal(
             const YAML::Node& rootNode,
             Manifest& manifest,
             const ManifestVer& manifestVersion,
             ManifestValidateOption validateOption);
+
+        std::vector<ValidationError> PopulateMultiFileManifestInternal(
+            const YAML::Node& installerNode,
+            const YAML::Node& defaultLocaleNode,
+            const std::vector<const YAML::Node*>& localeNodes,
+            Manifest& manifest,
+            const ManifestVer& manifestVersion,
+            ManifestValidateOption validateOption);
     };
 }
\ No newline at end of file
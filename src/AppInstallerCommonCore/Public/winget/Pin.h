@@ -4,6 +4,10 @@
 #include "winget/Manifest.h"
 #include "AppInstallerVersions.h"
 
+#include <optional>
+#include <unordered_map>
+#include <vector>
+
 namespace AppInstaller::Pinning
 {
     // The pin types are ordered by how "strict" they are.
@@ -75,6 +79,12 @@ namespace AppInstaller::Pinning
         const std::string SourceId;
     };
 
+    // Hashes a PinKey for use in unordered containers.
+    struct PinKeyHash
+    {
+        size_t operator()(const PinKey& key) const;
+    };
+
     struct Pin
     {
         static Pin CreateBlockingPin(PinKey&& pinKey);
@@ -106,4 +116,20 @@ namespace AppInstaller::Pinning
         PinKey m_key;
         Utility::GatedVersion m_gatedVersion;
     };
+
+    // A set of pins held in memory and indexed by key.
+    // Used to look up the pins for many packages after reading the pinning index once.
+    struct PinLookup
+    {
+        PinLookup() = default;
+        PinLookup(std::vector<Pin>&& pins);
+
+        // Returns the pin for the given key if it exists.
+        std::optional<Pin> GetPin(const PinKey& pinKey) const;
+
+        bool Empty() const { return m_pins.empty(); }
+
+    private:
+        std::unordered_map<PinKey, Pin, PinKeyHash> m_pins;
+    };
 }
@@ -66,6 +66,7 @@ namespace AppInstaller::Settings
         AnonymizePathForDisplay,
         // Source
         AutoUpdateTimeInMinutes,
+        AutoUpdateInBackground,
         // Experimental
         EFExperimentalCmd,
         EFExperimentalArg,
@@ -85,12 +86,14 @@ namespace AppInstaller::Settings
         InstallDefaultRoot,
         InstallSkipDependencies,
         DisableInstallNotes,
+        InstallMaxConcurrentMsixInstalls,
         PortablePackageUserRoot,
         PortablePackageMachineRoot,
         // Network
         NetworkDownloader,
         NetworkDOProgressTimeoutInSeconds,
         NetworkWingetAlternateSourceURL,
+        NetworkMaxConcurrentDownloads,
         // Logging
         LoggingLevelPreference,
         // Uninstall behavior
@@ -137,6 +140,7 @@ namespace AppInstaller::Settings
         SETTINGMAPPING_SPECIALIZATION(Setting::AnonymizePathForDisplay, bool, bool, true, ".visual.anonymizeDisplayedPaths"sv);
         // Source
         SETTINGMAPPING_SPECIALIZATION_POLICY(Setting::AutoUpdateTimeInMinutes, uint32_t, std::chrono::minutes, 5min, ".source.autoUpdateIntervalInMinutes"sv, ValuePolicy::SourceAutoUpdateIntervalInMinutes);
+        SETTINGMAPPING_SPECIALIZATION(Setting::AutoUpdateInBackground, bool, bool, true, ".source.backgroundAutoUpdate"sv);
         // Experimental
         SETTINGMAPPING_SPECIALIZATION(Setting::EFExperimentalCmd, bool, bool, false, ".experimentalFeatures.experimentalCmd"sv);
         SETTINGMAPPING_SPECIALIZATION(Setting::EFExperimentalArg, bool, bool, false, ".experimentalFeatures.experimentalArg"sv);
@@ -155,6 +159,7 @@ namespace AppInstaller::Settings
         SETTINGMAPPING_SPECIALIZATION(Setting::InstallLocaleRequirement, std::vector<std::string>, std::vector<std::string>, {}, ".installBehavior.requirements.locale"sv);
         SETTINGMAPPING_SPECIALIZATION(Setting::InstallSkipDependencies, bool, bool, false, ".installBehavior.skipDependencies"sv);
         SETTINGMAPPING_SPECIALIZATION(Setting::DisableInstallNotes, bool, bool, false, ".installBehavior.disableInstallNotes"sv);
+        SETTINGMAPPING_SPECIALIZATION(Setting::InstallMaxConcurrentMsixInstalls, uint32_t, uint32_t, 0, ".installBehavior.maxConcurrentMsixInstalls"sv);
         SETTINGMAPPING_SPECIALIZATION(Setting::PortablePackageUserRoot, std::string, std::filesystem::path, {}, ".installBehavior.portablePackageUserRoot"sv);
         SETTINGMAPPING_SPECIALIZATION(Setting::PortablePackageMachineRoot, std::string, std::filesystem::path, {}, ".installBehavior.portablePackageMachineRoot"sv);
         SETTINGMAPPING_SPECIALIZATION(Setting::InstallDefaultRoot, std::string, std::filesystem::path, {}, ".installBehavior.defaultInstallRoot"sv);
@@ -164,6 +169,7 @@ namespace AppInstaller::Settings
         SETTINGMAPPING_SPECIALIZATION(Setting::NetworkDownloader, std::string, InstallerDownloader, InstallerDownloader::Default, ".network.downloader"sv);
         SETTINGMAPPING_SPECIALIZATION(Setting::NetworkDOProgressTimeoutInSeconds, uint32_t, std::chrono::seconds, 60s, ".network.doProgressTimeoutInSeconds"sv);
         SETTINGMAPPING_SPECIALIZATION(Setting::NetworkWingetAlternateSourceURL, bool, bool, true, ".network.enableWingetAlternateSourceURL"sv);
+        SETTINGMAPPING_SPECIALIZATION(Setting::NetworkMaxConcurrentDownloads, uint32_t, uint32_t, 0, ".network.maxConcurrentDownloads"sv);
         // Debug
         SETTINGMAPPING_SPECIALIZATION(Setting::EnableSelfInitiatedMinidump, bool, bool, false, ".debugging.enableSelfInitiatedMinidump"sv);
         // Logging
@@ -263,6 +263,7 @@ namespace AppInstaller::Settings
         WINGET_VALIDATE_PASS_THROUGH(EFConfiguration)
         WINGET_VALIDATE_PASS_THROUGH(EFWindowsFeature)
         WINGET_VALIDATE_PASS_THROUGH(AnonymizePathForDisplay)
+        WINGET_VALIDATE_PASS_THROUGH(AutoUpdateInBackground)
         WINGET_VALIDATE_PASS_THROUGH(TelemetryDisable)
         WINGET_VALIDATE_PASS_THROUGH(InteractivityDisable)
         WINGET_VALIDATE_PASS_THROUGH(EnableSelfInitiatedMinidump)
@@ -372,6 +373,30 @@ namespace AppInstaller::Settings
             return std::chrono::seconds(value);
         }
 
+        WINGET_VALIDATE_SIGNATURE(NetworkMaxConcurrentDownloads)
+        {
+            static constexpr uint32_t s_maxConcurrentDownloads = 16;
+
+            if (value > s_maxConcurrentDownloads)
+            {
+                return {};
+            }
+
+            return value;
+        }
+
+        WINGET_VALIDATE_SIGNATURE(InstallMaxConcurrentMsixInstalls)
+        {
+            static constexpr uint32_t s_maxConcurrentMsixInstalls = 8;
+
+            if (value > s_maxConcurrentMsixInstalls)
+            {
+                return {};
+            }
+
+            return value;
+        }
+
         WINGET_VALIDATE_SIGNATURE(LoggingLevelPreference)
         {
             // logging preference possible values
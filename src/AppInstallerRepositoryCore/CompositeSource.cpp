@@ -4,6 +4,7 @@
 #include "CompositeSource.h"
 #include "Microsoft/PinningIndex.h"
 #include <winget/ExperimentalFeature.h>
+#include <winget/Tracing.h>
 
 using namespace AppInstaller::Repository::Microsoft;
 using namespace AppInstaller::Settings;
@@ -369,7 +370,7 @@ namespace AppInstaller::Repository
                 return m_baseInstalledVersion->GetMultiProperty(property);
             }
 
-            Manifest::Manifest GetManifest() override
+            Manifest::SharedManifest GetManifest() override
             {
                 return m_baseInstalledVersion->GetManifest();
             }
@@ -766,7 +767,7 @@ namespace AppInstaller::Repository
             }
 
             // Gets the information about the pins that exist for this package
-            void GetExistingPins(PinningIndex& pinningIndex)
+            void GetExistingPins(const Pinning::PinLookup& pins)
             {
                 for (auto& availablePackage : m_availablePackages)
                 {
@@ -778,7 +779,7 @@ namespace AppInstaller::Repository
 
                     Pinning::PinKey pinKey = GetPinKeyForAvailable(availablePackage.GetPackage().get());
 
-                    auto pin = pinningIndex.GetPin(pinKey);
+                    auto pin = pins.GetPin(pinKey);
                     if (pin.has_value())
                     {
                         availablePackage.SetPin(std::move(pin.value()));
@@ -791,7 +792,7 @@ namespace AppInstaller::Repository
                         m_installedPackage->GetProperty(PackageProperty::Id).get()
                     );
 
-                    auto pin = pinningIndex.GetPin(pinKey);
+                    auto pin = pins.GetPin(pinKey);
                     if (pin.has_value())
                     {
                         m_installedPackage->SetPin(std::move(pin.value()));
@@ -985,7 +986,7 @@ namespace AppInstaller::Repository
                     if (downloadManifests && manifestsDownloaded < c_downloadManifestsLimit)
                     {
                         auto manifest = packageVersion->GetManifest();
-                        AddSystemReferenceStringsFromManifest(manifest, result);
+                        AddSystemReferenceStringsFromManifest(*manifest, result);
                         manifestsDownloaded++;
                     }
                 }
@@ -1214,13 +1215,20 @@ namespace AppInstaller::Repository
         {
             if (!result.Matches.empty())
             {
-                // Look up any pins for the packages found
+                // Look up any pins for the packages found.
+                // All pins are read at once so that each package is matched in memory rather than with its own query.
                 auto pinningIndex = PinningIndex::OpenOrCreateDefault();
                 if (pinningIndex)
                 {
+                    Pinning::PinLookup pins{ pinningIndex->GetAllPins() };
+                    if (pins.Empty())
+                    {
+                        return;
+                    }
+
                     for (auto& match : result.Matches)
                     {
-                        match.Package->GetExistingPins(*pinningIndex);
+                        match.Package->GetExistingPins(pins);
                     }
                 }
             }
@@ -1298,6 +1306,12 @@ namespace AppInstaller::Repository
     //          Installed :: Search system references
     SearchResult CompositeSource::SearchInstalled(const SearchRequest& request) const
     {
+        Logging::TraceSpan span{ Logging::Channel::Repo, "CompositeSource::SearchInstalled" };
+        if (span)
+        {
+            span.AddArgument("request", request.ToString());
+        }
+
         CompositeResult result;
 
         // If the search behavior is for AllPackages or Installed then the result can contain packages that are
@@ -1555,6 +1569,12 @@ namespace AppInstaller::Repository
     // An available search goes through each source, searching individually and then sorting the full result set.
     SearchResult CompositeSource::SearchAvailable(const SearchRequest& request) const
     {
+        Logging::TraceSpan span{ Logging::Channel::Repo, "CompositeSource::SearchAvailable" };
+        if (span)
+        {
+            span.AddArgument("request", request.ToString());
+        }
+
         SearchResult result;
 
         // Search available sources
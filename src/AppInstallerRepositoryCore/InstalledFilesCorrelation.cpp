@@ -294,8 +294,7 @@ namespace AppInstaller::Repository::Correlation
                         {
                             AppInstaller::Manifest::InstalledFile fileEntry;
                             fileEntry.RelativeFilePath = relativePath->string();
-                            std::ifstream in{ linkInfo->Path, std::ifstream::binary };
-                            fileEntry.FileSha256 = Utility::SHA256::ComputeHash(in);
+                            fileEntry.FileSha256 = Utility::SHA256::ComputeHashFromFile(linkInfo->Path);
                             fileEntry.InvocationParameter = linkInfo->Args;
                             fileEntry.DisplayName = linkInfo->DisplayName;
                             fileEntry.FileType = installedFileType;
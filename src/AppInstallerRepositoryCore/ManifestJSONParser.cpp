@@ -6,9 +6,76 @@
 #include "Rest/Schema/1_1/Json/ManifestDeserializer.h"
 #include "Rest/Schema/1_4/Json/ManifestDeserializer.h"
 #include "Rest/Schema/1_5/Json/ManifestDeserializer.h"
+#include "Rest/Schema/CommonRestConstants.h"
+#include <winget/JsonStreamingReader.h>
 
 namespace AppInstaller::Repository::JSON
 {
+    namespace
+    {
+        // These fields are present in every schema version
+        constexpr std::string_view PackageIdentifier = "PackageIdentifier"sv;
+        constexpr std::string_view Versions = "Versions"sv;
+        constexpr std::string_view PackageVersion = "PackageVersion"sv;
+        constexpr std::string_view Channel = "Channel"sv;
+        constexpr std::string_view DefaultLocale = "DefaultLocale"sv;
+        constexpr std::string_view PackageName = "PackageName"sv;
+        constexpr std::string_view Publisher = "Publisher"sv;
+
+        // Reads the identifying values of a version, leaving everything else for the full deserialization.
+        ManifestVersionJson ReadVersionJson(std::string_view versionJson)
+        {
+            ManifestVersionJson result;
+            result.Json = versionJson;
+
+            AppInstaller::JSON::StreamingReader reader{ versionJson };
+            if (reader.BeginObject())
+            {
+                while (auto name = reader.NextMember())
+                {
+                    if (*name == PackageVersion)
+                    {
+                        result.Version = reader.ReadString().value_or("");
+                    }
+                    else if (*name == Channel)
+                    {
+                        result.Channel = reader.ReadString().value_or("");
+                    }
+                    else if (*name == DefaultLocale && reader.BeginObject())
+                    {
+                        while (auto localeName = reader.NextMember())
+                        {
+                            if (*localeName == PackageName)
+                            {
+                                result.PackageName = reader.ReadString().value_or("");
+                            }
+                            else if (*localeName == Publisher)
+                            {
+                                result.Publisher = reader.ReadString().value_or("");
+                            }
+                            else
+                            {
+                                reader.SkipValue();
+                            }
+                        }
+                    }
+                    else if (*name != DefaultLocale)
+                    {
+                        reader.SkipValue();
+                    }
+                }
+            }
+
+            if (result.Version.empty())
+            {
+                AICLI_LOG(Repo, Error, << "Missing package version in package manifest response.");
+                THROW_HR(APPINSTALLER_CLI_ERROR_RESTSOURCE_INVALID_DATA);
+            }
+
+            return result;
+        }
+    }
+
     struct ManifestJSONParser::impl
     {
         // The deserializer.  We only have one lineage (1.0+) right now.
@@ -57,6 +124,94 @@ namespace AppInstaller::Repository::JSON
         return m_pImpl->m_deserializer->Deserialize(response);
     }
 
+    std::vector<Manifest::Manifest> ManifestJSONParser::Deserialize(std::string_view response) const
+    {
+        return m_pImpl->m_deserializer->Deserialize(response);
+    }
+
+    std::vector<ManifestVersionJson> ManifestJSONParser::FindVersions(std::string_view response)
+    {
+        AppInstaller::JSON::StreamingReader reader{ response };
+
+        if (reader.IsAtEnd() || reader.PeekType() != AppInstaller::JSON::ValueType::Object)
+        {
+            AICLI_LOG(Repo, Error, << "Missing json object.");
+            THROW_HR(APPINSTALLER_CLI_ERROR_RESTSOURCE_INVALID_DATA);
+        }
+
+        std::vector<ManifestVersionJson> result;
+        bool foundData = false;
+        reader.BeginObject();
+
+        while (auto name = reader.NextMember())
+        {
+            if (*name != Rest::Schema::Data)
+            {
+                reader.SkipValue();
+                continue;
+            }
+
+            // A null Data means that there are no results
+            if (!reader.BeginObject())
+            {
+                continue;
+            }
+
+            foundData = true;
+            std::string id;
+
+            while (auto dataName = reader.NextMember())
+            {
+                if (*dataName == PackageIdentifier)
+                {
+                    id = reader.ReadString().value_or("");
+                }
+                else if (*dataName == Versions && reader.BeginArray())
+                {
+                    while (reader.NextElement())
+                    {
+                        result.emplace_back(ReadVersionJson(reader.SkipValue()));
+                    }
+                }
+                else if (*dataName != Versions)
+                {
+                    reader.SkipValue();
+                }
+            }
+
+            if (id.empty())
+            {
+                AICLI_LOG(Repo, Error, << "Missing package identifier.");
+                THROW_HR(APPINSTALLER_CLI_ERROR_RESTSOURCE_INVALID_DATA);
+            }
+
+            if (result.empty())
+            {
+                AICLI_LOG(Repo, Error, << "Missing versions in package: " << id);
+                THROW_HR(APPINSTALLER_CLI_ERROR_RESTSOURCE_INVALID_DATA);
+            }
+
+            for (auto& version : result)
+            {
+                version.PackageIdentifier = id;
+            }
+        }
+
+        reader.EndDocument();
+
+        if (!foundData)
+        {
+            AICLI_LOG(Repo, Verbose, << "No manifest results returned.");
+        }
+
+        return result;
+    }
+
+    Manifest::Manifest ManifestJSONParser::DeserializeVersion(const ManifestVersionJson& version) const
+    {
+        return m_pImpl->m_deserializer->DeserializeVersion(version.Json, version.PackageIdentifier);
+    }
+
     std::vector<Manifest::Manifest> ManifestJSONParser::DeserializeData(const web::json::value& data) const
     {
         return m_pImpl->m_deserializer->DeserializeData(data);
@@ -0,0 +1,331 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+#include "pch.h"
+#include "Microsoft/CompletionIndex.h"
+#include "Microsoft/SQLiteIndex.h"
+
+namespace AppInstaller::Repository::Microsoft
+{
+    namespace
+    {
+        // 'WGCI' when read as little endian bytes.
+        constexpr uint32_t s_CompletionIndex_Magic = 0x49434757;
+        constexpr uint32_t s_CompletionIndex_FormatVersion = 1;
+
+        struct FileHeader
+        {
+            uint32_t Magic;
+            uint32_t FormatVersion;
+            uint32_t SectionCount;
+        };
+
+        struct SectionHeader
+        {
+            uint32_t Field;
+            uint32_t EntryCount;
+            uint32_t EntriesOffset;
+        };
+
+        struct Entry
+        {
+            uint32_t KeyOffset;
+            uint32_t KeyLength;
+            uint32_t ValueOffset;
+            uint32_t ValueLength;
+        };
+
+        uint32_t ToUInt32(size_t value)
+        {
+            THROW_HR_IF(HRESULT_FROM_WIN32(ERROR_FILE_TOO_LARGE), value > std::numeric_limits<uint32_t>::max());
+            return static_cast<uint32_t>(value);
+        }
+
+        template <typename T>
+        void WriteStruct(std::ostream& stream, const T& value)
+        {
+            stream.write(reinterpret_cast<const char*>(&value), sizeof(T));
+        }
+
+        // Files that were replaced while mapped are named '<target>.<guid>.old' until they can be removed.
+        constexpr std::wstring_view s_CompletionIndex_ReplacedExtension = L".old";
+
+        std::filesystem::path GetReplacedPath(const std::filesystem::path& target)
+        {
+            GUID guid;
+            THROW_IF_FAILED(CoCreateGuid(&guid));
+            WCHAR guidString[256];
+            THROW_HR_IF(E_UNEXPECTED, StringFromGUID2(guid, guidString, ARRAYSIZE(guidString)) == 0);
+
+            std::filesystem::path result = target;
+            result += L".";
+            result += guidString;
+            result += s_CompletionIndex_ReplacedExtension;
+            return result;
+        }
+
+        // Removes the files replaced by previous writes that are no longer mapped by a reader.
+        void RemoveReplacedFiles(const std::filesystem::path& target)
+        {
+            std::wstring prefix = target.filename().wstring() + L".";
+            std::error_code error;
+
+            for (const auto& entry : std::filesystem::directory_iterator{ target.parent_path(), error })
+            {
+                std::wstring name = entry.path().filename().wstring();
+                if (name.compare(0, prefix.size(), prefix) == 0 && entry.path().extension().wstring() == s_CompletionIndex_ReplacedExtension)
+                {
+                    std::filesystem::remove(entry.path(), error);
+                }
+            }
+        }
+
+        // Moves the source file over the target.
+        // A reader may have the target mapped, which prevents it from being replaced or deleted. As readers allow
+        // the file to be deleted it can still be renamed though, so it is moved aside to be removed on a later write.
+        void ReplaceFile(const std::filesystem::path& source, const std::filesystem::path& target)
+        {
+            std::error_code error;
+            std::filesystem::rename(source, target, error);
+
+            if (error)
+            {
+                AICLI_LOG(Repo, Verbose, << "Failed to replace completion index, moving the existing file aside: " << error.message());
+
+                if (std::filesystem::exists(target))
+                {
+                    std::filesystem::rename(target, GetReplacedPath(target));
+                }
+
+                std::filesystem::rename(source, target);
+            }
+
+            RemoveReplacedFiles(target);
+        }
+    }
+
+    struct CompletionIndex::MappedFile
+    {
+        wil::unique_hfile File;
+        wil::unique_handle Mapping;
+        wil::unique_mapview_ptr<uint8_t> View;
+        size_t Size = 0;
+
+        // Gets a string view into the mapped data, or empty if the range is out of bounds.
+        std::string_view GetString(uint32_t offset, uint32_t length) const
+        {
+            if (static_cast<size_t>(offset) + length > Size)
+            {
+                return {};
+            }
+
+            return { reinterpret_cast<const char*>(View.get() + offset), length };
+        }
+
+        // Finds the section for the given field; returns null if not present or out of bounds.
+        const SectionHeader* FindSection(PackageMatchField field) const
+        {
+            const FileHeader* header = reinterpret_cast<const FileHeader*>(View.get());
+            const SectionHeader* sections = reinterpret_cast<const SectionHeader*>(View.get() + sizeof(FileHeader));
+
+            for (uint32_t i = 0; i < header->SectionCount; ++i)
+            {
+                if (sections[i].Field == static_cast<uint32_t>(field))
+                {
+                    if (static_cast<size_t>(sections[i].EntriesOffset) + static_cast<size_t>(sections[i].EntryCount) * sizeof(Entry) > Size)
+                    {
+                        return nullptr;
+                    }
+
+                    return &sections[i];
+                }
+            }
+
+            return nullptr;
+        }
+    };
+
+    CompletionIndex::CompletionIndex(std::unique_ptr<MappedFile>&& file) : m_file(std::move(file)) {}
+
+    CompletionIndex::CompletionIndex(CompletionIndex&&) = default;
+    CompletionIndex& CompletionIndex::operator=(CompletionIndex&&) = default;
+
+    CompletionIndex::~CompletionIndex() = default;
+
+    const std::vector<PackageMatchField>& CompletionIndex::SupportedFields()
+    {
+        static std::vector<PackageMatchField> s_fields{ PackageMatchField::Id, PackageMatchField::Name, PackageMatchField::Moniker };
+        return s_fields;
+    }
+
+    bool CompletionIndex::IsFieldSupported(PackageMatchField field)
+    {
+        const auto& fields = SupportedFields();
+        return std::find(fields.begin(), fields.end(), field) != fields.end();
+    }
+
+    void CompletionIndex::Create(const SQLiteIndex& index, const std::filesystem::path& target)
+    {
+        std::vector<std::pair<PackageMatchField, std::vector<std::string>>> values;
+
+        for (PackageMatchField field : SupportedFields())
+        {
+            values.emplace_back(field, index.GetAllValuesByField(field));
+        }
+
+        Create(values, target);
+    }
+
+    void CompletionIndex::Create(const std::vector<std::pair<PackageMatchField, std::vector<std::string>>>& values, const std::filesystem::path& target)
+    {
+        // Fold, sort and deduplicate the keys for each section, keeping the first value seen for a key.
+        std::vector<std::pair<PackageMatchField, std::vector<std::pair<std::string, std::string_view>>>> sections;
+
+        for (const auto& fieldValues : values)
+        {
+            std::vector<std::pair<std::string, std::string_view>> entries;
+            entries.reserve(fieldValues.second.size());
+
+            for (const auto& value : fieldValues.second)
+            {
+                if (!value.empty())
+                {
+                    entries.emplace_back(Utility::FoldCase(value), value);
+                }
+            }
+
+            std::stable_sort(entries.begin(), entries.end(), [](const auto& a, const auto& b) { return a.first < b.first; });
+            entries.erase(std::unique(entries.begin(), entries.end(), [](const auto& a, const auto& b) { return a.first == b.first; }), entries.end());
+
+            sections.emplace_back(fieldValues.first, std::move(entries));
+        }
+
+        // Lay out the file; entries follow the section headers, then all of the string data.
+        size_t entriesOffset = sizeof(FileHeader) + sections.size() * sizeof(SectionHeader);
+        size_t stringsOffset = entriesOffset;
+        for (const auto& section : sections)
+        {
+            stringsOffset += section.second.size() * sizeof(Entry);
+        }
+
+        std::filesystem::path tempTarget = target;
+        tempTarget += ".tmp";
+
+        {
+            std::ofstream stream{ tempTarget, std::ios::binary | std::ios::trunc };
+            THROW_LAST_ERROR_IF(!stream);
+
+            WriteStruct(stream, FileHeader{ s_CompletionIndex_Magic, s_CompletionIndex_FormatVersion, ToUInt32(sections.size()) });
+
+            size_t currentEntriesOffset = entriesOffset;
+            for (const auto& section : sections)
+            {
+                WriteStruct(stream, SectionHeader{ static_cast<uint32_t>(section.first), ToUInt32(section.second.size()), ToUInt32(currentEntriesOffset) });
+                currentEntriesOffset += section.second.size() * sizeof(Entry);
+            }
+
+            size_t currentStringOffset = stringsOffset;
+            for (const auto& section : sections)
+            {
+                for (const auto& entry : section.second)
+                {
+                    Entry value{};
+                    value.KeyOffset = ToUInt32(currentStringOffset);
+                    value.KeyLength = ToUInt32(entry.first.size());
+                    currentStringOffset += entry.first.size();
+
+                    value.ValueOffset = ToUInt32(currentStringOffset);
+                    value.ValueLength = ToUInt32(entry.second.size());
+                    currentStringOffset += entry.second.size();
+
+                    WriteStruct(stream, value);
+                }
+            }
+
+            for (const auto& section : sections)
+            {
+                for (const auto& entry : section.second)
+                {
+                    stream.write(entry.first.data(), entry.first.size());
+                    stream.write(entry.second.data(), entry.second.size());
+                }
+            }
+
+            stream.flush();
+            THROW_HR_IF(E_FAIL, !stream);
+        }
+
+        // Replace the existing file only once the new one is completely written.
+        ReplaceFile(tempTarget, target);
+    }
+
+    std::optional<CompletionIndex> CompletionIndex::Open(const std::filesystem::path& path)
+    {
+        auto file = std::make_unique<MappedFile>();
+
+        file->File.reset(CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_DELETE, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr));
+        if (!file->File)
+        {
+            AICLI_LOG(Repo, Verbose, << "Completion index not found: " << path);
+            return {};
+        }
+
+        LARGE_INTEGER fileSize{};
+        THROW_IF_WIN32_BOOL_FALSE(GetFileSizeEx(file->File.get(), &fileSize));
+
+        if (static_cast<uint64_t>(fileSize.QuadPart) < sizeof(FileHeader) || static_cast<uint64_t>(fileSize.QuadPart) > std::numeric_limits<uint32_t>::max())
+        {
+            AICLI_LOG(Repo, Warning, << "Completion index has an invalid size: " << path);
+            return {};
+        }
+
+        file->Size = static_cast<size_t>(fileSize.QuadPart);
+
+        file->Mapping.reset(CreateFileMappingW(file->File.get(), nullptr, PAGE_READONLY, 0, 0, nullptr));
+        THROW_LAST_ERROR_IF_NULL(file->Mapping);
+
+        file->View.reset(reinterpret_cast<uint8_t*>(MapViewOfFile(file->Mapping.get(), FILE_MAP_READ, 0, 0, 0)));
+        THROW_LAST_ERROR_IF_NULL(file->View);
+
+        const FileHeader* header = reinterpret_cast<const FileHeader*>(file->View.get());
+        if (header->Magic != s_CompletionIndex_Magic || header->FormatVersion != s_CompletionIndex_FormatVersion ||
+            sizeof(FileHeader) + static_cast<size_t>(header->SectionCount) * sizeof(SectionHeader) > file->Size)
+        {
+            AICLI_LOG(Repo, Warning, << "Completion index has an unsupported format: " << path);
+            return {};
+        }
+
+        return CompletionIndex{ std::move(file) };
+    }
+
+    std::vector<std::string> CompletionIndex::FindByPrefix(PackageMatchField field, std::string_view prefix, size_t maximum) const
+    {
+        std::vector<std::string> result;
+
+        const SectionHeader* section = m_file->FindSection(field);
+        if (!section)
+        {
+            return result;
+        }
+
+        const Entry* begin = reinterpret_cast<const Entry*>(m_file->View.get() + section->EntriesOffset);
+        const Entry* end = begin + section->EntryCount;
+
+        std::string foldedPrefix = Utility::FoldCase(prefix);
+
+        const Entry* current = std::lower_bound(begin, end, std::string_view{ foldedPrefix },
+            [&](const Entry& entry, std::string_view value) { return m_file->GetString(entry.KeyOffset, entry.KeyLength) < value; });
+
+        for (; current != end && (maximum == 0 || result.size() < maximum); ++current)
+        {
+            std::string_view key = m_file->GetString(current->KeyOffset, current->KeyLength);
+            if (key.substr(0, foldedPrefix.size()) != foldedPrefix)
+            {
+                break;
+            }
+
+            result.emplace_back(m_file->GetString(current->ValueOffset, current->ValueLength));
+        }
+
+        return result;
+    }
+}
@@ -0,0 +1,63 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+#pragma once
+#include <winget/RepositorySearch.h>
+
+#include <filesystem>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace AppInstaller::Repository::Microsoft
+{
+    struct SQLiteIndex;
+
+    // A compact, read only artifact that answers prefix queries for the values used by shell completion.
+    // The file contains a sorted array of case folded keys for each supported field, allowing a binary
+    // search to find every value that starts with a given prefix without opening the SQLite index.
+    //
+    // File layout (all integers are little endian uint32_t):
+    //  Header  :: Magic, FormatVersion, SectionCount
+    //  Section :: Field, EntryCount, EntriesOffset                   (repeated SectionCount times)
+    //  Entry   :: KeyOffset, KeyLength, ValueOffset, ValueLength     (EntryCount per section, sorted by key)
+    //  Strings :: the UTF-8 data referenced by the entries
+    struct CompletionIndex
+    {
+        CompletionIndex(const CompletionIndex&) = delete;
+        CompletionIndex& operator=(const CompletionIndex&) = delete;
+
+        CompletionIndex(CompletionIndex&&);
+        CompletionIndex& operator=(CompletionIndex&&);
+
+        ~CompletionIndex();
+
+        // The fields that are written to the completion index.
+        static const std::vector<PackageMatchField>& SupportedFields();
+
+        // Determines whether the given field is present in completion indices.
+        static bool IsFieldSupported(PackageMatchField field);
+
+        // Writes a completion index containing the values of the given SQLiteIndex to the target path.
+        static void Create(const SQLiteIndex& index, const std::filesystem::path& target);
+
+        // Writes a completion index containing the given values to the target path.
+        static void Create(const std::vector<std::pair<PackageMatchField, std::vector<std::string>>>& values, const std::filesystem::path& target);
+
+        // Opens an existing completion index by mapping it into memory.
+        // Returns an empty value if the file does not exist or is not a valid completion index.
+        static std::optional<CompletionIndex> Open(const std::filesystem::path& path);
+
+        // Gets the values for the field that start with the given prefix (case insensitive), in sorted order.
+        // An empty prefix returns all values. A maximum of zero means no limit.
+        std::vector<std::string> FindByPrefix(PackageMatchField field, std::string_view prefix, size_t maximum = 0) const;
+
+    private:
+        struct MappedFile;
+
+        CompletionIndex(std::unique_ptr<MappedFile>&& file);
+
+        std::unique_ptr<MappedFile> m_file;
+    };
+}
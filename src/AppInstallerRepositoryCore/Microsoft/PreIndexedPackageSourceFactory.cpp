@@ -2,6 +2,7 @@
 // Licensed under the MIT License.
 #include "pch.h"
 #include "Microsoft/PreIndexedPackageSourceFactory.h"
+#include "Microsoft/CompletionIndex.h"
 #include "Microsoft/SQLiteIndex.h"
 #include "Microsoft/SQLiteIndexSource.h"
 
@@ -20,6 +21,7 @@ namespace AppInstaller::Repository::Microsoft
         static constexpr std::string_view s_PreIndexedPackageSourceFactory_IndexFileName = "index.db"sv;
         // TODO: This being hard coded to force using the Public directory name is not ideal.
         static constexpr std::string_view s_PreIndexedPackageSourceFactory_IndexFilePath = "Public\\index.db"sv;
+        static constexpr std::string_view s_PreIndexedPackageSourceFactory_CompletionIndexFileName = "completion.idx"sv;
 
         struct PreIndexedPackageInfo
         {
@@ -112,6 +114,37 @@ namespace AppInstaller::Repository::Microsoft
             return "PreIndexedSourceCPRWL_"s + GetPackageFamilyNameFromDetails(details);
         }
 
+        // Constructs the location that we will write files to.
+        std::filesystem::path GetStatePathFromDetails(const SourceDetails& details)
+        {
+            std::filesystem::path result = Runtime::GetPathTo(Runtime::PathName::LocalState);
+            result /= PreIndexedPackageSourceFactory::Type();
+            result /= GetPackageFamilyNameFromDetails(details);
+            return result;
+        }
+
+        // Writes the completion index for the source from the given index.
+        // Completion falls back to searching the index when the file is missing, so failures are only logged.
+        // *Should only be called when under an exclusive CrossProcessReaderWriteLock*
+        void UpdateCompletionIndex(const SourceDetails& details, const SQLiteIndex& index)
+        {
+            std::filesystem::path completionIndexPath = PreIndexedPackageSourceFactory::GetCompletionIndexPath(details);
+
+            try
+            {
+                std::filesystem::create_directories(completionIndexPath.parent_path());
+                CompletionIndex::Create(index, completionIndexPath);
+                AICLI_LOG(Repo, Info, << "Updated completion index at: " << completionIndexPath);
+            }
+            catch (...)
+            {
+                AICLI_LOG(Repo, Warning, << "Failed to update completion index at: " << completionIndexPath);
+
+                std::error_code error;
+                std::filesystem::remove(completionIndexPath, error);
+            }
+        }
+
         // The base class for a package that comes from a preindexed packaged source.
         struct PreIndexedFactoryBase : public ISourceFactory
         {
@@ -311,6 +344,12 @@ namespace AppInstaller::Repository::Microsoft
                     if (!packageInfo.IsNewerThan(extension->GetPackageVersion()))
                     {
                         AICLI_LOG(Repo, Info, << "Remote source data was not newer than existing, no update needed");
+
+                        if (!std::filesystem::exists(PreIndexedPackageSourceFactory::GetCompletionIndexPath(details)))
+                        {
+                            UpdateCompletionIndexFromExtension(details);
+                        }
+
                         return true;
                     }
                 }
@@ -375,6 +414,8 @@ namespace AppInstaller::Repository::Microsoft
                     }
                 }
 
+                UpdateCompletionIndexFromExtension(details);
+
                 return true;
             }
 
@@ -392,18 +433,32 @@ namespace AppInstaller::Repository::Microsoft
                     Deployment::RemovePackage(*fullName, winrt::Windows::Management::Deployment::RemovalOptions::None, callback);
                 }
 
+                std::error_code error;
+                std::filesystem::remove_all(GetStatePathFromDetails(details), error);
+
                 return true;
             }
-        };
 
-        // Constructs the location that we will write files to.
-        std::filesystem::path GetStatePathFromDetails(const SourceDetails& details)
-        {
-            std::filesystem::path result = Runtime::GetPathTo(Runtime::PathName::LocalState);
-            result /= PreIndexedPackageSourceFactory::Type();
-            result /= GetPackageFamilyNameFromDetails(details);
-            return result;
-        }
+        private:
+            void UpdateCompletionIndexFromExtension(const SourceDetails& details)
+            {
+                try
+                {
+                    auto extension = GetExtensionFromDetails(details);
+                    if (!extension)
+                    {
+                        return;
+                    }
+
+                    std::filesystem::path indexLocation = extension->GetPackagePath();
+                    indexLocation /= s_PreIndexedPackageSourceFactory_IndexFilePath;
+
+                    SQLiteIndex index = SQLiteIndex::Open(indexLocation.u8string(), SQLiteIndex::OpenDisposition::Immutable);
+                    UpdateCompletionIndex(details, index);
+                }
+                CATCH_LOG();
+            }
+        };
 
         struct DesktopContextSourceReference : public ISourceReference
         {
@@ -492,6 +547,12 @@ namespace AppInstaller::Repository::Microsoft
                         !packageInfo.IsNewerThan(packagePath))
                     {
                         AICLI_LOG(Repo, Info, << "Remote source data was not newer than existing, no update needed");
+
+                        if (!std::filesystem::exists(PreIndexedPackageSourceFactory::GetCompletionIndexPath(details)))
+                        {
+                            UpdateCompletionIndexFromPackage(details, packagePath, progress);
+                        }
+
                         return true;
                     }
                 }
@@ -527,6 +588,8 @@ namespace AppInstaller::Repository::Microsoft
                         std::filesystem::rename(tempPackagePath, packagePath);
                         AICLI_LOG(Repo, Info, << "Source update success.");
                         updateSuccess = true;
+
+                        UpdateCompletionIndexFromPackage(details, packagePath, progress);
                     }
                     else
                     {
@@ -565,9 +628,36 @@ namespace AppInstaller::Repository::Microsoft
 
                 return true;
             }
+
+        private:
+            void UpdateCompletionIndexFromPackage(const SourceDetails& details, const std::filesystem::path& packagePath, IProgressCallback& progress)
+            {
+                try
+                {
+                    auto tempIndexFilePath = Runtime::GetNewTempFilePath();
+                    auto tempIndexFile = Utility::ManagedFile::CreateWriteLockedFile(tempIndexFilePath, GENERIC_WRITE, true);
+
+                    Msix::MsixInfo packageInfo(packagePath);
+                    packageInfo.WriteToFileHandle(s_PreIndexedPackageSourceFactory_IndexFilePath, tempIndexFile.GetFileHandle(), progress);
+
+                    if (progress.IsCancelled())
+                    {
+                        return;
+                    }
+
+                    SQLiteIndex index = SQLiteIndex::Open(tempIndexFile.GetFilePath().u8string(), SQLiteIndex::OpenDisposition::Immutable, std::move(tempIndexFile));
+                    UpdateCompletionIndex(details, index);
+                }
+                CATCH_LOG();
+            }
         };
     }
 
+    std::filesystem::path PreIndexedPackageSourceFactory::GetCompletionIndexPath(const SourceDetails& details)
+    {
+        return GetStatePathFromDetails(details) / s_PreIndexedPackageSourceFactory_CompletionIndexFileName;
+    }
+
     std::unique_ptr<ISourceFactory> PreIndexedPackageSourceFactory::Create()
     {
         if (Runtime::IsRunningInPackagedContext())
@@ -4,6 +4,7 @@
 #include "ISource.h"
 #include "SourceFactory.h"
 
+#include <filesystem>
 #include <string_view>
 
 namespace AppInstaller::Repository::Microsoft
@@ -29,5 +30,9 @@ namespace AppInstaller::Repository::Microsoft
 
         // Creates a source factory for this type.
         static std::unique_ptr<ISourceFactory> Create();
+
+        // Gets the location of the completion index that is written when the source is updated.
+        // The file may not exist if the source has not been updated since it was introduced.
+        static std::filesystem::path GetCompletionIndexPath(const SourceDetails& details);
     };
 }
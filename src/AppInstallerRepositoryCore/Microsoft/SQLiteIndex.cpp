@@ -3,8 +3,10 @@
 #include "pch.h"
 #include "SQLiteIndex.h"
 #include "SQLiteStorageBase.h"
+#include "CompletionIndex.h"
 #include "ArpVersionValidation.h"
 #include <winget/ManifestYamlParser.h>
+#include <winget/Tracing.h>
 
 #include "Schema/1_0/Interface.h"
 #include "Schema/1_1/Interface.h"
@@ -214,6 +216,14 @@ namespace AppInstaller::Repository::Microsoft
         m_interface->PrepareForPackaging(m_dbconn);
     }
 
+    void SQLiteIndex::PrepareForPackaging(const std::filesystem::path& completionIndexPath)
+    {
+        PrepareForPackaging();
+
+        AICLI_LOG(Repo, Info, << "Writing completion index to: " << completionIndexPath);
+        CompletionIndex::Create(*this, completionIndexPath);
+    }
+
     bool SQLiteIndex::CheckConsistency(bool log) const
     {
         std::lock_guard<std::mutex> lockInterface{ *m_interfaceLock };
@@ -228,10 +238,18 @@ namespace AppInstaller::Repository::Microsoft
 
     Schema::ISQLiteIndex::SearchResult SQLiteIndex::Search(const SearchRequest& request) const
     {
+        Logging::TraceSpan span{ Logging::Channel::SQL, "SQLiteIndex::Search" };
+        if (span)
+        {
+            span.AddArgument("request", request.ToString());
+        }
+
         std::lock_guard<std::mutex> lockInterface{ *m_interfaceLock };
         AICLI_LOG(Repo, Verbose, << "Performing search: " << request.ToString());
 
-        return m_interface->Search(m_dbconn, request);
+        auto result = m_interface->Search(m_dbconn, request);
+        span.AddArgument("matches", result.Matches.size());
+        return result;
     }
 
     std::optional<std::string> SQLiteIndex::GetPropertyByManifestId(IdType manifestId, PackageVersionProperty property) const
@@ -290,4 +308,22 @@ namespace AppInstaller::Repository::Microsoft
     {
         return m_interface->GetDependentsById(m_dbconn, packageId);
     }
+
+    std::vector<std::string> SQLiteIndex::GetAllValuesByField(PackageMatchField field) const
+    {
+        std::lock_guard<std::mutex> lockInterface{ *m_interfaceLock };
+        return m_interface->GetAllValuesByField(m_dbconn, field);
+    }
+
+    SQLiteIndex::ManifestVersionsResult SQLiteIndex::GetAllManifestVersions() const
+    {
+        std::lock_guard<std::mutex> lockInterface{ *m_interfaceLock };
+        return m_interface->GetAllManifestVersions(m_dbconn);
+    }
+
+    SQLiteIndex::DependenciesResult SQLiteIndex::GetAllDependencies() const
+    {
+        std::lock_guard<std::mutex> lockInterface{ *m_interfaceLock };
+        return m_interface->GetAllDependencies(m_dbconn);
+    }
 }
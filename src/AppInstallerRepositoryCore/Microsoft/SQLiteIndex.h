@@ -34,6 +34,12 @@ namespace AppInstaller::Repository::Microsoft
         // The return type of GetMetadataByManifestId
         using MetadataResult = Schema::ISQLiteIndex::MetadataResult;
 
+        // The return type of GetAllManifestVersions
+        using ManifestVersionsResult = Schema::ISQLiteIndex::ManifestVersionsResult;
+
+        // The return type of GetAllDependencies
+        using DependenciesResult = Schema::ISQLiteIndex::DependenciesResult;
+
         // Options for creating a new index.
         using CreateOptions = Schema::ISQLiteIndex::CreateOptions;
 
@@ -100,6 +106,10 @@ namespace AppInstaller::Repository::Microsoft
         // Removes data that is no longer needed for an index that is to be published.
         void PrepareForPackaging();
 
+        // Removes data that is no longer needed for an index that is to be published,
+        // then writes the completion index for the packaged data to the given path.
+        void PrepareForPackaging(const std::filesystem::path& completionIndexPath);
+
         // Checks the consistency of the index to ensure that every referenced row exists.
         // Returns true if index is consistent; false if it is not.
         bool CheckConsistency(bool log = false) const;
@@ -136,6 +146,16 @@ namespace AppInstaller::Repository::Microsoft
         // Get all the dependencies for a specific manifest.
         std::set<std::pair<SQLite::rowid_t, Utility::NormalizedString>> GetDependenciesByManifestRowId(SQLite::rowid_t manifestRowId) const;
         std::vector<std::pair<SQLite::rowid_t, Utility::NormalizedString>> GetDependentsById(AppInstaller::Manifest::string_t packageId) const;
+
+        // Gets all of the distinct values stored for the given field (Id, Name or Moniker).
+        std::vector<std::string> GetAllValuesByField(PackageMatchField field) const;
+
+        // Gets the package id and version of every manifest, as <manifest id, package id, version>.
+        ManifestVersionsResult GetAllManifestVersions() const;
+
+        // Gets the package dependencies of every manifest, as <manifest id, dependency package id, min version>.
+        DependenciesResult GetAllDependencies() const;
+
     private:
         // Constructor used to create a new index.
         SQLiteIndex(const std::string& target, Schema::Version version);
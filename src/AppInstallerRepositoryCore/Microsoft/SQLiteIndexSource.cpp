@@ -66,7 +66,40 @@ namespace AppInstaller::Repository::Microsoft
                 return result;
             }
 
-            Manifest::Manifest GetManifest() override
+            Manifest::SharedManifest GetManifest() override
+            {
+                // The manifest is only retrieved once and then shared with every caller.
+                // Concurrent callers wait for the first retrieval rather than each downloading the manifest.
+                std::lock_guard<std::mutex> lock{ m_manifestLock };
+
+                if (!m_manifest)
+                {
+                    m_manifest = RetrieveManifest();
+                }
+
+                return m_manifest.value();
+            }
+
+            Source GetSource() const override
+            {
+                return Source{ GetReferenceSource() };
+            }
+
+            IPackageVersion::Metadata GetMetadata() const override
+            {
+                auto metadata = GetReferenceSource()->GetIndex().GetMetadataByManifestId(m_manifestId);
+
+                IPackageVersion::Metadata result;
+                for (auto&& data : metadata)
+                {
+                    result.emplace(std::move(data));
+                }
+
+                return result;
+            }
+
+        private:
+            Manifest::Manifest RetrieveManifest() const
             {
                 std::shared_ptr<SQLiteIndexSource> source = GetReferenceSource();
 
@@ -107,25 +140,6 @@ namespace AppInstaller::Repository::Microsoft
                 THROW_HR(primaryHR);
             }
 
-            Source GetSource() const override
-            {
-                return Source{ GetReferenceSource() };
-            }
-
-            IPackageVersion::Metadata GetMetadata() const override
-            {
-                auto metadata = GetReferenceSource()->GetIndex().GetMetadataByManifestId(m_manifestId);
-
-                IPackageVersion::Metadata result;
-                for (auto&& data : metadata)
-                {
-                    result.emplace(std::move(data));
-                }
-
-                return result;
-            }
-
-        private:
             static Manifest::Manifest GetManifestFromArgAndRelativePath(const std::string& arg, const std::string& relativePath, const SHA256::HashBuffer& expectedHash)
             {
                 std::string fullPath = arg;
@@ -192,6 +206,8 @@ namespace AppInstaller::Repository::Microsoft
             }
 
             SQLiteIndex::IdType m_manifestId;
+            std::mutex m_manifestLock;
+            std::optional<Manifest::SharedManifest> m_manifest;
         };
 
         // The base for IPackage implementations here.
@@ -40,6 +40,10 @@ namespace AppInstaller::Repository::Microsoft::Schema::V1_0
         std::set<std::pair<SQLite::rowid_t, Utility::NormalizedString>> GetDependenciesByManifestRowId(const SQLite::Connection& connection, SQLite::rowid_t manifestRowId) const override;
         std::vector<std::pair<SQLite::rowid_t, Utility::NormalizedString>> GetDependentsById(const SQLite::Connection& connection, AppInstaller::Manifest::string_t packageId) const override;   
 
+        std::vector<std::string> GetAllValuesByField(const SQLite::Connection& connection, PackageMatchField field) const override;
+        ManifestVersionsResult GetAllManifestVersions(const SQLite::Connection& connection) const override;
+        DependenciesResult GetAllDependencies(const SQLite::Connection& connection) const override;
+
     protected:
         virtual bool NotNeeded(const SQLite::Connection& connection, std::string_view tableName, std::string_view valueName, SQLite::rowid_t id) const;
 
@@ -544,6 +544,31 @@ namespace AppInstaller::Repository::Microsoft::Schema::V1_0
         return {};
     }
 
+    std::vector<std::string> Interface::GetAllValuesByField(const SQLite::Connection& connection, PackageMatchField field) const
+    {
+        switch (field)
+        {
+        case PackageMatchField::Id:
+            return IdTable::GetAllValues(connection);
+        case PackageMatchField::Name:
+            return NameTable::GetAllValues(connection);
+        case PackageMatchField::Moniker:
+            return MonikerTable::GetAllValues(connection);
+        default:
+            return {};
+        }
+    }
+
+    ISQLiteIndex::ManifestVersionsResult Interface::GetAllManifestVersions(const SQLite::Connection& connection) const
+    {
+        return ManifestTable::GetAllValues<IdTable, VersionTable>(connection);
+    }
+
+    ISQLiteIndex::DependenciesResult Interface::GetAllDependencies(const SQLite::Connection&) const
+    {
+        return {};
+    }
+
     std::vector<Utility::VersionAndChannel> Interface::GetVersionKeysById(const SQLite::Connection& connection, SQLite::rowid_t id) const
     {
         auto versionsAndChannels = ManifestTable::GetAllValuesById<IdTable, VersionTable, ChannelTable>(connection, id);
@@ -113,6 +113,39 @@ namespace AppInstaller::Repository::Microsoft::Schema::V1_0
             return result;
         }
 
+        SQLite::Statement ManifestTableGetAllValues_Statement(
+            const SQLite::Connection& connection,
+            std::initializer_list<SQLite::Builder::QualifiedColumn> columns,
+            std::initializer_list<std::string_view> manifestColumnNames)
+        {
+            THROW_HR_IF(E_UNEXPECTED, manifestColumnNames.size() != columns.size());
+
+            using QCol = SQLite::Builder::QualifiedColumn;
+
+            SQLite::Builder::StatementBuilder builder;
+            builder.Select().Column(QCol{ s_ManifestTable_Table_Name, SQLite::RowIDName });
+
+            for (const auto& column : columns)
+            {
+                builder.Column(column);
+            }
+
+            builder.From(s_ManifestTable_Table_Name);
+
+            // join tables
+            auto columnItr = columns.begin();
+            auto manifestColumnNameItr = manifestColumnNames.begin();
+            while (columnItr != columns.end())
+            {
+                builder.Join(columnItr->Table).On(QCol{ s_ManifestTable_Table_Name, *manifestColumnNameItr }, QCol{ columnItr->Table, SQLite::RowIDName });
+
+                columnItr++;
+                manifestColumnNameItr++;
+            }
+
+            return builder.Prepare(connection);
+        }
+
         SQLite::Statement ManifestTableGetAllValuesByIds_Statement(
             const SQLite::Connection& connection,
             std::initializer_list<SQLite::Builder::QualifiedColumn> valueColumns,
@@ -46,6 +46,12 @@ namespace AppInstaller::Repository::Microsoft::Schema::V1_0
             std::initializer_list<SQLite::Builder::QualifiedColumn> columns,
             std::initializer_list<std::string_view> manifestColumnNames);
 
+        // Gets the rowid and the requested values for every manifest.
+        SQLite::Statement ManifestTableGetAllValues_Statement(
+            const SQLite::Connection& connection,
+            std::initializer_list<SQLite::Builder::QualifiedColumn> columns,
+            std::initializer_list<std::string_view> manifestColumnNames);
+
         // Gets all values for rows that match the given ids.
         SQLite::Statement ManifestTableGetAllValuesByIds_Statement(
             const SQLite::Connection& connection,
@@ -144,6 +150,19 @@ namespace AppInstaller::Repository::Microsoft::Schema::V1_0
             return details::ManifestTableGetValuesById_Statement(connection, id, { SQLite::Builder::QualifiedColumn{ Tables::TableName(), Tables::ValueName() }... }, { details::GetManifestTableColumnName<Tables>()... }).GetRow<typename Tables::value_t...>();
         }
 
+        // Gets the rowid and the values requested for every manifest, in a single query.
+        template <typename... Tables>
+        static std::vector<std::tuple<SQLite::rowid_t, typename Tables::value_t...>> GetAllValues(const SQLite::Connection& connection)
+        {
+            auto stmt = details::ManifestTableGetAllValues_Statement(connection, { SQLite::Builder::QualifiedColumn{ Tables::TableName(), Tables::ValueName() }... }, { details::GetManifestTableColumnName<Tables>()... });
+            std::vector<std::tuple<SQLite::rowid_t, typename Tables::value_t...>> result;
+            while (stmt.Step())
+            {
+                result.emplace_back(stmt.GetRow<SQLite::rowid_t, typename Tables::value_t...>());
+            }
+            return result;
+        }
+
         // Gets the values for rows that match the given ids.
         template <typename ValueTable, typename... IdTables>
         static std::vector<typename ValueTable::value_t> GetAllValuesByIds(const SQLite::Connection& connection, std::initializer_list<SQLite::rowid_t> ids)
@@ -113,6 +113,21 @@ namespace AppInstaller::Repository::Microsoft::Schema::V1_0
             return result;
         }
 
+        std::vector<std::string> OneToOneTableGetAllValues(const SQLite::Connection& connection, std::string_view tableName, std::string_view valueName)
+        {
+            SQLite::Builder::StatementBuilder selectBuilder;
+            selectBuilder.Select(valueName).From(tableName).OrderBy(valueName);
+
+            SQLite::Statement select = selectBuilder.Prepare(connection);
+
+            std::vector<std::string> result;
+            while (select.Step())
+            {
+                result.emplace_back(select.GetColumn<std::string>(0));
+            }
+            return result;
+        }
+
         SQLite::rowid_t OneToOneTableEnsureExists(SQLite::Connection& connection, std::string_view tableName, std::string_view valueName, std::string_view value, bool overwriteLikeMatch)
         {
             auto selectResult = OneToOneTableSelectIdByValue(connection, tableName, valueName, value, overwriteLikeMatch);
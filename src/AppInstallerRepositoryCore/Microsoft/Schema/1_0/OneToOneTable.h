@@ -24,6 +24,9 @@ namespace AppInstaller::Repository::Microsoft::Schema::V1_0
         // Gets all row ids from the table.
         std::vector<SQLite::rowid_t> OneToOneTableGetAllRowIds(const SQLite::Connection& connection, std::string_view tableName, std::string_view valueName, size_t limit);
 
+        // Gets all values from the table.
+        std::vector<std::string> OneToOneTableGetAllValues(const SQLite::Connection& connection, std::string_view tableName, std::string_view valueName);
+
         // Ensures that the values exists in the table.
         SQLite::rowid_t OneToOneTableEnsureExists(SQLite::Connection& connection, std::string_view tableName, std::string_view valueName, std::string_view value, bool overwriteLikeMatch = false);
         // Removes data that is no longer needed for an index that is to be published.
@@ -100,6 +103,12 @@ namespace AppInstaller::Repository::Microsoft::Schema::V1_0
             return details::OneToOneTableGetAllRowIds(connection, TableInfo::TableName(), TableInfo::ValueName(), limit);
         }
 
+        // Gets all values from the table.
+        static std::vector<value_t> GetAllValues(const SQLite::Connection& connection)
+        {
+            return details::OneToOneTableGetAllValues(connection, TableInfo::TableName(), TableInfo::ValueName());
+        }
+
         // Ensures that the given value exists in the table, returning the rowid.
         static SQLite::rowid_t EnsureExists(SQLite::Connection& connection, std::string_view value, bool overwriteLikeMatch = false)
         {
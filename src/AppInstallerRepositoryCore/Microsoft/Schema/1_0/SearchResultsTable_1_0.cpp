@@ -105,7 +105,7 @@ namespace AppInstaller::Repository::Microsoft::Schema::V1_0
         SQLite::Statement statement = builder.Prepare(m_connection);
         BindStatementForMatchType(statement, filter, bindIndex);
         statement.Execute();
-        AICLI_LOG(Repo, Verbose, << "Search found " << m_connection.GetChanges() << " rows");
+        AICLI_LOG_FORMAT(Repo, Verbose, "Search found {} rows", m_connection.GetChanges());
     }
 
     void SearchResultsTable::RemoveDuplicateManifestRows()
@@ -128,7 +128,7 @@ namespace AppInstaller::Repository::Microsoft::Schema::V1_0
         EndParenthetical();
 
         builder.Execute(m_connection);
-        AICLI_LOG(Repo, Verbose, << "Removed " << m_connection.GetChanges() << " duplicate rows");
+        AICLI_LOG_FORMAT(Repo, Verbose, "Removed {} duplicate rows", m_connection.GetChanges());
     }
 
     void SearchResultsTable::PrepareToFilter()
@@ -170,7 +170,7 @@ namespace AppInstaller::Repository::Microsoft::Schema::V1_0
         SQLite::Statement statement = builder.Prepare(m_connection);
         BindStatementForMatchType(statement, filter, bindIndex);
         statement.Execute();
-        AICLI_LOG(Repo, Verbose, << "Filter kept " << m_connection.GetChanges() << " rows");
+        AICLI_LOG_FORMAT(Repo, Verbose, "Filter kept {} rows", m_connection.GetChanges());
     }
 
     void SearchResultsTable::CompleteFilter()
@@ -180,7 +180,7 @@ namespace AppInstaller::Repository::Microsoft::Schema::V1_0
         builder.DeleteFrom(GetQualifiedName()).Where(s_SearchResultsTable_Filter).Equals(false);
 
         builder.Execute(m_connection);
-        AICLI_LOG(Repo, Verbose, << "Filter deleted " << m_connection.GetChanges() << " rows");
+        AICLI_LOG_FORMAT(Repo, Verbose, "Filter deleted {} rows", m_connection.GetChanges());
     }
 
     ISQLiteIndex::SearchResult SearchResultsTable::GetSearchResults(size_t limit)
@@ -20,6 +20,8 @@ namespace AppInstaller::Repository::Microsoft::Schema::V1_1
         bool CheckConsistency(const SQLite::Connection& connection, bool log) const override;
         SearchResult Search(const SQLite::Connection& connection, const SearchRequest& request) const override;
         std::vector<std::string> GetMultiPropertyByManifestId(const SQLite::Connection& connection, SQLite::rowid_t manifestId, PackageVersionMultiProperty property) const override;
+        std::optional<SQLite::rowid_t> GetManifestIdByKey(const SQLite::Connection& connection, SQLite::rowid_t id, std::string_view version, std::string_view channel) const override;
+        std::vector<Utility::VersionAndChannel> GetVersionKeysById(const SQLite::Connection& connection, SQLite::rowid_t id) const override;
 
         // Version 1.1
         MetadataResult GetMetadataByManifestId(const SQLite::Connection& connection, SQLite::rowid_t manifestId) const override;
@@ -33,5 +35,15 @@ namespace AppInstaller::Repository::Microsoft::Schema::V1_1
 
         // Gets a property already knowing that the manifest id is valid.
         virtual std::optional<std::string> GetPropertyByManifestIdInternal(const SQLite::Connection& connection, SQLite::rowid_t manifestId, PackageVersionProperty property) const;
+
+        // Removes the version keys table created when packaging, as it is not kept up to date with changes.
+        void DropVersionKeysIfPresent(SQLite::Connection& connection);
+
+        // Determines whether the version keys table exists, only querying the schema the first time.
+        bool VersionKeysExist(const SQLite::Connection& connection) const;
+
+    private:
+        // The interface is only used with the one connection of its index, and only changes the table itself.
+        mutable std::optional<bool> m_versionKeysExist;
     };
 }
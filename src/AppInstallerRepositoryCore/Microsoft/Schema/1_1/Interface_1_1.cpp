@@ -21,6 +21,7 @@
 #include "Microsoft/Schema/1_1/SearchResultsTable.h"
 
 #include "Microsoft/Schema/1_1/ManifestMetadataTable.h"
+#include "Microsoft/Schema/1_1/VersionKeysTable.h"
 
 
 namespace AppInstaller::Repository::Microsoft::Schema::V1_1
@@ -63,6 +64,8 @@ namespace AppInstaller::Repository::Microsoft::Schema::V1_1
     {
         SQLite::Savepoint savepoint = SQLite::Savepoint::Create(connection, "addmanifest_v1_1");
 
+        DropVersionKeysIfPresent(connection);
+
         SQLite::rowid_t manifestId = V1_0::Interface::AddManifest(connection, manifest, relativePath);
 
         // Add the new 1.1 data
@@ -80,6 +83,8 @@ namespace AppInstaller::Repository::Microsoft::Schema::V1_1
     {
         SQLite::Savepoint savepoint = SQLite::Savepoint::Create(connection, "updatemanifest_v1_1");
 
+        DropVersionKeysIfPresent(connection);
+
         auto [indexModified, manifestId] = V1_0::Interface::UpdateManifest(connection, manifest, relativePath);
 
         // Update new 1:N tables as necessary
@@ -95,6 +100,8 @@ namespace AppInstaller::Repository::Microsoft::Schema::V1_1
     {
         SQLite::Savepoint savepoint = SQLite::Savepoint::Create(connection, "RemoveManifestById_v1_1");
 
+        DropVersionKeysIfPresent(connection);
+
         V1_0::Interface::RemoveManifestById(connection, manifestId);
 
         // Remove all of the new 1:N data that is no longer referenced.
@@ -129,6 +136,11 @@ namespace AppInstaller::Repository::Microsoft::Schema::V1_1
             result = ProductCodeTable::CheckConsistency(connection, log) && result;
         }
 
+        if ((result || log) && VersionKeysExist(connection))
+        {
+            result = VersionKeysTable::CheckConsistency(connection, log) && result;
+        }
+
         return result;
     }
 
@@ -151,6 +163,46 @@ namespace AppInstaller::Repository::Microsoft::Schema::V1_1
         }
     }
 
+    std::optional<SQLite::rowid_t> Interface::GetManifestIdByKey(const SQLite::Connection& connection, SQLite::rowid_t id, std::string_view version, std::string_view channel) const
+    {
+        if (!VersionKeysExist(connection))
+        {
+            return V1_0::Interface::GetManifestIdByKey(connection, id, version, channel);
+        }
+
+        // The values are resolved as in the 1.0 lookup: a channel that is not in the index matches nothing,
+        // while an empty one only filters the manifests when some manifest has an empty channel.
+        std::optional<SQLite::rowid_t> channelIdOpt = V1_0::ChannelTable::SelectIdByValue(connection, channel, true);
+        if (!channelIdOpt && !channel.empty())
+        {
+            AICLI_LOG(Repo, Info, << "Did not find a Channel { " << channel << " }");
+            return {};
+        }
+
+        std::optional<SQLite::rowid_t> versionIdOpt;
+        if (!version.empty())
+        {
+            versionIdOpt = V1_0::VersionTable::SelectIdByValue(connection, version, true);
+            if (!versionIdOpt)
+            {
+                AICLI_LOG(Repo, Info, << "Did not find a Version for { " << version << " }");
+                return {};
+            }
+        }
+
+        return VersionKeysTable::GetManifestIdByKey(connection, id, versionIdOpt, channelIdOpt);
+    }
+
+    std::vector<Utility::VersionAndChannel> Interface::GetVersionKeysById(const SQLite::Connection& connection, SQLite::rowid_t id) const
+    {
+        if (!VersionKeysExist(connection))
+        {
+            return V1_0::Interface::GetVersionKeysById(connection, id);
+        }
+
+        return VersionKeysTable::GetVersionKeysById(connection, id);
+    }
+
     ISQLiteIndex::MetadataResult Interface::GetMetadataByManifestId(const SQLite::Connection& connection, SQLite::rowid_t manifestId) const
     {
         ISQLiteIndex::MetadataResult result;
@@ -244,7 +296,11 @@ namespace AppInstaller::Repository::Microsoft::Schema::V1_1
         PackageFamilyNameTable::PrepareForPackaging(connection, true, true);
         ProductCodeTable::PrepareForPackaging(connection, true, true);
 
+        DropVersionKeysIfPresent(connection);
+        VersionKeysTable::Create(connection);
+
         savepoint.Commit();
+        m_versionKeysExist = true;
 
         if (vacuum)
         {
@@ -252,6 +308,28 @@ namespace AppInstaller::Repository::Microsoft::Schema::V1_1
         }
     }
 
+    void Interface::DropVersionKeysIfPresent(SQLite::Connection& connection)
+    {
+        // Lookups return to the 1.0 queries once the table is gone.
+        if (VersionKeysExist(connection))
+        {
+            VersionKeysTable::Drop(connection);
+        }
+
+        // Should the drop be rolled back, the 1.0 queries still return the same results.
+        m_versionKeysExist = false;
+    }
+
+    bool Interface::VersionKeysExist(const SQLite::Connection& connection) const
+    {
+        if (!m_versionKeysExist)
+        {
+            m_versionKeysExist = VersionKeysTable::Exists(connection);
+        }
+
+        return m_versionKeysExist.value();
+    }
+
     std::optional<std::string> Interface::GetPropertyByManifestIdInternal(const SQLite::Connection& connection, SQLite::rowid_t manifestId, PackageVersionProperty property) const
     {
         switch (property)
@@ -0,0 +1,271 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+#include "pch.h"
+#include "VersionKeysTable.h"
+#include "SQLiteStatementBuilder.h"
+#include "Microsoft/Schema/1_0/IdTable.h"
+#include "Microsoft/Schema/1_0/VersionTable.h"
+#include "Microsoft/Schema/1_0/ChannelTable.h"
+#include "Microsoft/Schema/1_0/ManifestTable.h"
+
+#include <numeric>
+
+
+namespace AppInstaller::Repository::Microsoft::Schema::V1_1
+{
+    using namespace SQLite;
+    using namespace V1_0;
+
+    static constexpr std::string_view s_VersionKeysTable_Table_Name = "versionkeys"sv;
+    static constexpr std::string_view s_VersionKeysTable_Id_Column = "id"sv;
+    // The position of the row in the sorted version keys of the package.
+    static constexpr std::string_view s_VersionKeysTable_Sort_Column = "sort"sv;
+    // The position of the version in the versions of the package, highest first.
+    static constexpr std::string_view s_VersionKeysTable_VersionRank_Column = "version_rank"sv;
+    // The version and channel are stored both as the rowid of their value (for filtering) and as the value.
+    static constexpr std::string_view s_VersionKeysTable_Version_Column = "version"sv;
+    static constexpr std::string_view s_VersionKeysTable_Channel_Column = "channel"sv;
+    static constexpr std::string_view s_VersionKeysTable_VersionString_Column = "version_string"sv;
+    static constexpr std::string_view s_VersionKeysTable_ChannelString_Column = "channel_string"sv;
+    static constexpr std::string_view s_VersionKeysTable_Manifest_Column = "manifest"sv;
+
+    namespace
+    {
+        struct VersionKeyRow
+        {
+            rowid_t Manifest;
+            rowid_t Id;
+            rowid_t VersionId;
+            rowid_t ChannelId;
+            Utility::VersionAndChannel Key;
+        };
+
+        // Reads the version keys of all manifests, grouped by package id.
+        std::vector<VersionKeyRow> GetAllVersionKeyRows(const SQLite::Connection& connection)
+        {
+            using QCol = Builder::QualifiedColumn;
+
+            Builder::StatementBuilder builder;
+            builder.Select({
+                    QCol{ ManifestTable::TableName(), RowIDName },
+                    QCol{ ManifestTable::TableName(), IdTable::ValueName() },
+                    QCol{ ManifestTable::TableName(), VersionTable::ValueName() },
+                    QCol{ ManifestTable::TableName(), ChannelTable::ValueName() },
+                    QCol{ VersionTable::TableName(), VersionTable::ValueName() },
+                    QCol{ ChannelTable::TableName(), ChannelTable::ValueName() } }).
+                From(ManifestTable::TableName()).
+                Join(VersionTable::TableName()).On(QCol{ ManifestTable::TableName(), VersionTable::ValueName() }, QCol{ VersionTable::TableName(), RowIDName }).
+                Join(ChannelTable::TableName()).On(QCol{ ManifestTable::TableName(), ChannelTable::ValueName() }, QCol{ ChannelTable::TableName(), RowIDName });
+
+            Statement select = builder.Prepare(connection);
+
+            std::vector<VersionKeyRow> result;
+            while (select.Step())
+            {
+                auto [manifest, id, versionId, channelId, version, channel] = select.GetRow<rowid_t, rowid_t, rowid_t, rowid_t, std::string, std::string>();
+                result.emplace_back(VersionKeyRow{ manifest, id, versionId, channelId,
+                    Utility::VersionAndChannel{ Utility::Version{ std::move(version) }, Utility::Channel{ std::move(channel) } } });
+            }
+
+            std::stable_sort(result.begin(), result.end(), [](const VersionKeyRow& a, const VersionKeyRow& b) { return a.Id < b.Id; });
+
+            return result;
+        }
+    }
+
+    bool VersionKeysTable::Exists(const SQLite::Connection& connection)
+    {
+        Builder::StatementBuilder builder;
+        builder.Select(Builder::RowCount).From(Builder::Schema::MainTable).
+            Where(Builder::Schema::TypeColumn).Equals(Builder::Schema::Type_Table).And(Builder::Schema::NameColumn).Equals(s_VersionKeysTable_Table_Name);
+
+        Statement statement = builder.Prepare(connection);
+        THROW_HR_IF(E_UNEXPECTED, !statement.Step());
+        return statement.GetColumn<int64_t>(0) != 0;
+    }
+
+    void VersionKeysTable::Create(SQLite::Connection& connection)
+    {
+        using namespace Builder;
+
+        SQLite::Savepoint savepoint = SQLite::Savepoint::Create(connection, "createversionkeys_v1_1");
+
+        // The rows are stored in primary key order, so the rows of a package are adjacent and already sorted.
+        StatementBuilder createTableBuilder;
+        createTableBuilder.CreateTable(s_VersionKeysTable_Table_Name).Columns({
+            ColumnBuilder(s_VersionKeysTable_Id_Column, Type::Int64).NotNull(),
+            ColumnBuilder(s_VersionKeysTable_Sort_Column, Type::Int64).NotNull(),
+            ColumnBuilder(s_VersionKeysTable_VersionRank_Column, Type::Int64).NotNull(),
+            ColumnBuilder(s_VersionKeysTable_Version_Column, Type::Int64).NotNull(),
+            ColumnBuilder(s_VersionKeysTable_Channel_Column, Type::Int64).NotNull(),
+            ColumnBuilder(s_VersionKeysTable_VersionString_Column, Type::Text).NotNull(),
+            ColumnBuilder(s_VersionKeysTable_ChannelString_Column, Type::Text).NotNull(),
+            ColumnBuilder(s_VersionKeysTable_Manifest_Column, Type::Int64).NotNull(),
+            PrimaryKeyBuilder({ s_VersionKeysTable_Id_Column, s_VersionKeysTable_Sort_Column })
+            }).WithoutRowID();
+
+        createTableBuilder.Execute(connection);
+
+        StatementBuilder insertBuilder;
+        insertBuilder.InsertInto(s_VersionKeysTable_Table_Name).Columns({
+            s_VersionKeysTable_Id_Column,
+            s_VersionKeysTable_Sort_Column,
+            s_VersionKeysTable_VersionRank_Column,
+            s_VersionKeysTable_Version_Column,
+            s_VersionKeysTable_Channel_Column,
+            s_VersionKeysTable_VersionString_Column,
+            s_VersionKeysTable_ChannelString_Column,
+            s_VersionKeysTable_Manifest_Column }).Values(Unbound, Unbound, Unbound, Unbound, Unbound, Unbound, Unbound, Unbound);
+
+        Statement insert = insertBuilder.Prepare(connection);
+
+        std::vector<VersionKeyRow> rows = GetAllVersionKeyRows(connection);
+        std::vector<size_t> byKey;
+        std::vector<size_t> byVersion;
+
+        for (auto groupBegin = rows.begin(); groupBegin != rows.end();)
+        {
+            auto groupEnd = std::find_if(groupBegin, rows.end(), [&](const VersionKeyRow& row) { return row.Id != groupBegin->Id; });
+            size_t groupSize = static_cast<size_t>(groupEnd - groupBegin);
+
+            byKey.resize(groupSize);
+            std::iota(byKey.begin(), byKey.end(), 0);
+            std::sort(byKey.begin(), byKey.end(), [&](size_t a, size_t b) { return groupBegin[a].Key < groupBegin[b].Key; });
+
+            byVersion.resize(groupSize);
+            std::iota(byVersion.begin(), byVersion.end(), 0);
+            std::sort(byVersion.begin(), byVersion.end(), [&](size_t a, size_t b) { return groupBegin[b].Key.GetVersion() < groupBegin[a].Key.GetVersion(); });
+
+            std::vector<size_t> versionRanks(groupSize);
+            for (size_t i = 0; i < groupSize; ++i)
+            {
+                versionRanks[byVersion[i]] = i;
+            }
+
+            for (size_t i = 0; i < groupSize; ++i)
+            {
+                const VersionKeyRow& row = groupBegin[byKey[i]];
+
+                insert.Reset();
+                insert.Bind(1, row.Id);
+                insert.Bind(2, static_cast<int64_t>(i));
+                insert.Bind(3, static_cast<int64_t>(versionRanks[byKey[i]]));
+                insert.Bind(4, row.VersionId);
+                insert.Bind(5, row.ChannelId);
+                insert.Bind(6, row.Key.GetVersion().ToString());
+                insert.Bind(7, row.Key.GetChannel().ToString());
+                insert.Bind(8, row.Manifest);
+                insert.Execute();
+            }
+
+            groupBegin = groupEnd;
+        }
+
+        savepoint.Commit();
+    }
+
+    void VersionKeysTable::Drop(SQLite::Connection& connection)
+    {
+        Builder::StatementBuilder dropTableBuilder;
+        dropTableBuilder.DropTable(s_VersionKeysTable_Table_Name);
+        dropTableBuilder.Execute(connection);
+    }
+
+    std::vector<Utility::VersionAndChannel> VersionKeysTable::GetVersionKeysById(const SQLite::Connection& connection, SQLite::rowid_t id)
+    {
+        Builder::StatementBuilder builder;
+        builder.Select({ s_VersionKeysTable_VersionString_Column, s_VersionKeysTable_ChannelString_Column }).From(s_VersionKeysTable_Table_Name).
+            Where(s_VersionKeysTable_Id_Column).Equals(id).OrderBy(s_VersionKeysTable_Sort_Column);
+
+        Statement select = builder.Prepare(connection);
+
+        std::vector<Utility::VersionAndChannel> result;
+        while (select.Step())
+        {
+            auto [version, channel] = select.GetRow<std::string, std::string>();
+            result.emplace_back(Utility::Version{ std::move(version) }, Utility::Channel{ std::move(channel) });
+        }
+
+        return result;
+    }
+
+    std::optional<SQLite::rowid_t> VersionKeysTable::GetManifestIdByKey(const SQLite::Connection& connection, SQLite::rowid_t id, std::optional<SQLite::rowid_t> versionId, std::optional<SQLite::rowid_t> channelId)
+    {
+        Builder::StatementBuilder builder;
+        builder.Select(s_VersionKeysTable_Manifest_Column).From(s_VersionKeysTable_Table_Name).Where(s_VersionKeysTable_Id_Column).Equals(id);
+
+        if (versionId)
+        {
+            builder.And(s_VersionKeysTable_Version_Column).Equals(versionId.value());
+        }
+
+        if (channelId)
+        {
+            builder.And(s_VersionKeysTable_Channel_Column).Equals(channelId.value());
+        }
+
+        builder.OrderBy(s_VersionKeysTable_VersionRank_Column).Limit(1);
+
+        Statement select = builder.Prepare(connection);
+
+        if (select.Step())
+        {
+            return select.GetColumn<rowid_t>(0);
+        }
+        else
+        {
+            return {};
+        }
+    }
+
+    bool VersionKeysTable::CheckConsistency(const SQLite::Connection& connection, bool log)
+    {
+        using QCol = Builder::QualifiedColumn;
+
+        bool result = true;
+
+        // Find rows that refer to a manifest that does not exist.
+        Builder::StatementBuilder builder;
+        builder.Select(QCol{ s_VersionKeysTable_Table_Name, s_VersionKeysTable_Manifest_Column }).From(s_VersionKeysTable_Table_Name).
+            LeftOuterJoin(ManifestTable::TableName()).On(QCol{ s_VersionKeysTable_Table_Name, s_VersionKeysTable_Manifest_Column }, QCol{ ManifestTable::TableName(), RowIDName }).
+            Where(QCol{ ManifestTable::TableName(), RowIDName }).IsNull();
+
+        Statement select = builder.Prepare(connection);
+
+        while (select.Step())
+        {
+            result = false;
+
+            if (!log)
+            {
+                break;
+            }
+
+            AICLI_LOG(Repo, Info, << "  [INVALID] " << s_VersionKeysTable_Table_Name << " refers to manifest [" << select.GetColumn<rowid_t>(0) << "]");
+        }
+
+        // Every manifest must have a row.
+        Builder::StatementBuilder versionKeysCountBuilder;
+        versionKeysCountBuilder.Select(Builder::RowCount).From(s_VersionKeysTable_Table_Name);
+        Statement versionKeysCount = versionKeysCountBuilder.Prepare(connection);
+        THROW_HR_IF(E_UNEXPECTED, !versionKeysCount.Step());
+
+        Builder::StatementBuilder manifestCountBuilder;
+        manifestCountBuilder.Select(Builder::RowCount).From(ManifestTable::TableName());
+        Statement manifestCount = manifestCountBuilder.Prepare(connection);
+        THROW_HR_IF(E_UNEXPECTED, !manifestCount.Step());
+
+        if (versionKeysCount.GetColumn<int64_t>(0) != manifestCount.GetColumn<int64_t>(0))
+        {
+            result = false;
+
+            if (log)
+            {
+                AICLI_LOG(Repo, Info, << "  [INVALID] " << s_VersionKeysTable_Table_Name << " has " << versionKeysCount.GetColumn<int64_t>(0) <<
+                    " rows for " << manifestCount.GetColumn<int64_t>(0) << " manifests");
+            }
+        }
+
+        return result;
+    }
+}
@@ -0,0 +1,41 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+#pragma once
+#include "SQLiteWrapper.h"
+#include <AppInstallerVersions.h>
+
+#include <optional>
+#include <vector>
+
+
+namespace AppInstaller::Repository::Microsoft::Schema::V1_1
+{
+    // A read optimized copy of the version, channel, and manifest of every package, keyed by package id.
+    // It is only created when preparing an index for packaging, where it turns the version lookups for a package
+    // into a range scan of its primary key rather than joins from the manifest table to the value tables.
+    // The table is optional; it is removed if the index is modified after being packaged.
+    struct VersionKeysTable
+    {
+        // Determine if the table currently exists in the database.
+        static bool Exists(const SQLite::Connection& connection);
+
+        // Creates the table in the database and fills it from the manifest table.
+        static void Create(SQLite::Connection& connection);
+
+        // Removes the table from the database.
+        static void Drop(SQLite::Connection& connection);
+
+        // Gets the versions and channels of the given package, sorted.
+        // The table must exist.
+        static std::vector<Utility::VersionAndChannel> GetVersionKeysById(const SQLite::Connection& connection, SQLite::rowid_t id);
+
+        // Gets the manifest for the given version and channel (as rowids of their values) of the package.
+        // When no version is given, the latest version is selected; when no channel is given, the manifest can be from any channel.
+        // The table must exist.
+        static std::optional<SQLite::rowid_t> GetManifestIdByKey(const SQLite::Connection& connection, SQLite::rowid_t id, std::optional<SQLite::rowid_t> versionId, std::optional<SQLite::rowid_t> channelId);
+
+        // Checks that the table has a row for every manifest.
+        // The table must exist.
+        static bool CheckConsistency(const SQLite::Connection& connection, bool log);
+    };
+}
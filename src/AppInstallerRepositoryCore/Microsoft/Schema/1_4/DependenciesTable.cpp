@@ -363,6 +363,50 @@ namespace AppInstaller::Repository::Microsoft::Schema::V1_4
         return resultSet;
     }
 
+    std::vector<std::tuple<SQLite::rowid_t, std::string, std::string>> DependenciesTable::GetAllDependencies(const SQLite::Connection& connection)
+    {
+        if (!Exists(connection))
+        {
+            return {};
+        }
+
+        constexpr std::string_view depTableAlias = "dep";
+        constexpr std::string_view minVersionAlias = "minV";
+        constexpr std::string_view packageIdAlias = "pId";
+
+        StatementBuilder builder;
+        // Use outer join for joining version table as min_version may be NULL.
+        // SELECT [dep].[manifest], [pId].[id], [minV].[version] FROM [dependencies] AS [dep] 
+        // LEFT OUTER JOIN [versions] AS [minV] ON [dep].[min_version] = [minV].[rowid] 
+        // JOIN [ids] AS [pId] ON [pId].[rowid] = [dep].[package_id]
+        builder.Select()
+            .Column(QCol(depTableAlias, s_DependenciesTable_Manifest_Column_Name))
+            .Column(QCol(packageIdAlias, IdTable::ValueName()))
+            .Column(QCol(minVersionAlias, VersionTable::ValueName()))
+            .From({ s_DependenciesTable_Table_Name }).As(depTableAlias)
+            .LeftOuterJoin({ VersionTable::TableName() }).As(minVersionAlias)
+            .On(QCol(depTableAlias, s_DependenciesTable_MinVersion_Column_Name), QCol(minVersionAlias, SQLite::RowIDName))
+            .Join({ IdTable::TableName() }).As(packageIdAlias)
+            .On(QCol(packageIdAlias, SQLite::RowIDName), QCol(depTableAlias, s_DependenciesTable_PackageId_Column_Name));
+
+        SQLite::Statement select = builder.Prepare(connection);
+
+        std::vector<std::tuple<SQLite::rowid_t, std::string, std::string>> result;
+
+        while (select.Step())
+        {
+            std::string version;
+            if (!select.GetColumnIsNull(2))
+            {
+                version = select.GetColumn<std::string>(2);
+            }
+
+            result.emplace_back(select.GetColumn<SQLite::rowid_t>(0), select.GetColumn<std::string>(1), std::move(version));
+        }
+
+        return result;
+    }
+
     std::set<std::pair<SQLite::rowid_t, Utility::NormalizedString>> DependenciesTable::GetDependenciesByManifestRowId(const SQLite::Connection& connection, SQLite::rowid_t manifestRowId)
     {
         SQLite::Builder::StatementBuilder builder;
@@ -40,6 +40,10 @@ namespace AppInstaller::Repository::Microsoft::Schema::V1_4
         // Get dependencies by package id.
         static std::vector<std::pair<SQLite::rowid_t, Utility::NormalizedString>> GetDependentsById(const SQLite::Connection& connection, AppInstaller::Manifest::string_t packageId);
 
+        // Get every row of the dependencies table in a single query. Returning a list of <ManifestRowId, PackageId, MinVersion> tuples;
+        // the min version is empty when not specified.
+        static std::vector<std::tuple<SQLite::rowid_t, std::string, std::string>> GetAllDependencies(const SQLite::Connection& connection);
+
         // Check dependencies table consistency.
         static bool CheckConsistency(const SQLite::Connection& connection, bool log);
 
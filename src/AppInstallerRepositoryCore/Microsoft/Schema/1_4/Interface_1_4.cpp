@@ -134,6 +134,11 @@ namespace AppInstaller::Repository::Microsoft::Schema::V1_4
         return DependenciesTable::GetDependentsById(connection, packageId);
     }
 
+    ISQLiteIndex::DependenciesResult Interface::GetAllDependencies(const SQLite::Connection& connection) const
+    {
+        return DependenciesTable::GetAllDependencies(connection);
+    }
+
     bool Interface::ValidateDependenciesWithMinVersions(const SQLite::Connection& connection, bool log) const
     {
         try
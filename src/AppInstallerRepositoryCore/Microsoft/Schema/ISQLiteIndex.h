@@ -33,6 +33,13 @@ namespace AppInstaller::Repository::Microsoft::Schema
         // The non-version specific return value of GetMetadataByManifestId.
         using MetadataResult = std::vector<std::pair<PackageVersionMetadata, std::string>>;
 
+        // The non-version specific return value of GetAllManifestVersions; <manifest rowid, package id, version>.
+        using ManifestVersionsResult = std::vector<std::tuple<SQLite::rowid_t, std::string, std::string>>;
+
+        // The non-version specific return value of GetAllDependencies; <manifest rowid, dependency package id, min version>.
+        // The min version is empty when the dependency does not specify one.
+        using DependenciesResult = std::vector<std::tuple<SQLite::rowid_t, std::string, std::string>>;
+
         // Version 1.0
 
         // Gets the schema version that this index interface is built for.
@@ -110,6 +117,16 @@ namespace AppInstaller::Repository::Microsoft::Schema
         virtual std::set<std::pair<SQLite::rowid_t, Utility::NormalizedString>> GetDependenciesByManifestRowId(const SQLite::Connection& connection, SQLite::rowid_t manifestRowId) const = 0;
 
         virtual std::vector<std::pair<SQLite::rowid_t, Utility::NormalizedString>> GetDependentsById(const SQLite::Connection& connection, AppInstaller::Manifest::string_t packageId) const = 0;
+
+        // Gets all of the distinct values stored for the given field.
+        // Only the single valued fields (Id, Name, Moniker) are supported; others return an empty result.
+        virtual std::vector<std::string> GetAllValuesByField(const SQLite::Connection& connection, PackageMatchField field) const = 0;
+
+        // Gets the package id and version of every manifest in the index.
+        virtual ManifestVersionsResult GetAllManifestVersions(const SQLite::Connection& connection) const = 0;
+
+        // Gets the package dependencies of every manifest in the index.
+        virtual DependenciesResult GetAllDependencies(const SQLite::Connection& connection) const = 0;
     };
 
     DEFINE_ENUM_FLAG_OPERATORS(ISQLiteIndex::CreateOptions);
@@ -0,0 +1,243 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+#include "pch.h"
+#include "winget/OpenedSourceCache.h"
+#include "winget/SourceUpdateScheduler.h"
+#include "Microsoft/PredefinedInstalledSourceFactory.h"
+#include "SourceList.h"
+
+#include <wil/registry.h>
+
+using namespace std::chrono_literals;
+using namespace std::string_view_literals;
+
+namespace AppInstaller::Repository
+{
+    namespace
+    {
+        // Entries that have not been requested for this long are dropped, releasing the index if no one else holds it.
+        constexpr auto s_IdleTimeout = 30min;
+
+        // Changes to MSIX packages are not watched, so installed sources are also refreshed periodically.
+        constexpr auto s_InstalledMaxAge = 5min;
+
+        // The registry locations that ARP entries are read from.
+        const std::pair<HKEY, std::wstring_view> s_UninstallKeys[] =
+        {
+            { HKEY_LOCAL_MACHINE, L"Software\\Microsoft\\Windows\\CurrentVersion\\Uninstall"sv },
+            { HKEY_LOCAL_MACHINE, L"Software\\WOW6432Node\\Microsoft\\Windows\\CurrentVersion\\Uninstall"sv },
+            { HKEY_CURRENT_USER, L"Software\\Microsoft\\Windows\\CurrentVersion\\Uninstall"sv },
+        };
+
+        bool IsInstalledSource(const SourceDetails& details)
+        {
+            return details.Type == Microsoft::PredefinedInstalledSourceFactory::Type();
+        }
+
+        // Sources are only shared between opens with the same options, as those are sent with every request to the source.
+        std::string GetCacheKey(const SourceDetails& details, std::string_view caller)
+        {
+            std::string result;
+            result.append(details.Type).append(1, '\n');
+            result.append(details.Name).append(1, '\n');
+            result.append(details.Arg).append(1, '\n');
+            result.append(details.AlternateArg).append(1, '\n');
+            result.append(details.Identifier).append(1, '\n');
+            result.append(caller).append(1, '\n');
+
+            // Distinguish an empty custom header from none at all.
+            if (details.CustomHeader)
+            {
+                result.append(1, '+').append(details.CustomHeader.value());
+            }
+
+            return result;
+        }
+    }
+
+    struct OpenedSourceCache::Entry
+    {
+        // Held while opening so that concurrent callers wait for, and then share, a single open.
+        std::mutex OpenLock;
+        std::optional<Source> Opened;
+        bool IsInstalled = false;
+        uint64_t InstalledGeneration = 0;
+        std::chrono::steady_clock::time_point OpenedAt;
+
+        // Protected by the cache lock rather than the open lock.
+        std::string Identifier;
+        std::chrono::steady_clock::time_point LastUsed;
+    };
+
+    struct OpenedSourceCache::InstalledWatchers
+    {
+        std::vector<wil::unique_registry_watcher_nothrow> Watchers;
+    };
+
+    OpenedSourceCache::OpenedSourceCache() = default;
+
+    OpenedSourceCache::~OpenedSourceCache() = default;
+
+    OpenedSourceCache& OpenedSourceCache::Instance()
+    {
+        static OpenedSourceCache s_instance;
+        return s_instance;
+    }
+
+    Source OpenedSourceCache::Open(const Source& source, std::string_view caller, IProgressCallback& progress)
+    {
+        THROW_HR_IF(E_INVALIDARG, !source || source.IsComposite());
+
+        SourceDetails details = source.GetDetails();
+        bool isInstalled = IsInstalledSource(details);
+        if (isInstalled)
+        {
+            EnsureInstalledWatchers();
+        }
+
+        std::string key = GetCacheKey(details, caller);
+        std::shared_ptr<Entry> entry;
+
+        {
+            std::lock_guard<std::mutex> lock{ m_lock };
+            auto now = std::chrono::steady_clock::now();
+
+            for (auto itr = m_entries.begin(); itr != m_entries.end();)
+            {
+                if (itr->first != key && now - itr->second->LastUsed > s_IdleTimeout)
+                {
+                    itr = m_entries.erase(itr);
+                }
+                else
+                {
+                    ++itr;
+                }
+            }
+
+            auto& cached = m_entries[key];
+            if (!cached)
+            {
+                cached = std::make_shared<Entry>();
+                cached->Identifier = details.Identifier;
+            }
+
+            cached->LastUsed = now;
+            entry = cached;
+        }
+
+        std::lock_guard<std::mutex> openLock{ entry->OpenLock };
+
+        if (entry->Opened && IsCurrent(*entry, source))
+        {
+            AICLI_LOG(Repo, Verbose, << "Using cached opened source: " << details.Name);
+            return entry->Opened.value();
+        }
+
+        // Capture the generation before opening so that a change during the open invalidates the result.
+        uint64_t installedGeneration = m_installedGeneration.load();
+
+        Source result = source;
+        result.SetCaller(std::string{ caller });
+        result.Open(progress);
+
+        entry->Opened = result;
+        entry->IsInstalled = isInstalled;
+        entry->InstalledGeneration = installedGeneration;
+        entry->OpenedAt = std::chrono::steady_clock::now();
+
+        return result;
+    }
+
+    void OpenedSourceCache::Invalidate(std::string_view identifier)
+    {
+        std::lock_guard<std::mutex> lock{ m_lock };
+
+        for (auto itr = m_entries.begin(); itr != m_entries.end();)
+        {
+            if (itr->second->Identifier == identifier)
+            {
+                itr = m_entries.erase(itr);
+            }
+            else
+            {
+                ++itr;
+            }
+        }
+    }
+
+    void OpenedSourceCache::InvalidateInstalled()
+    {
+        ++m_installedGeneration;
+    }
+
+    void OpenedSourceCache::Clear()
+    {
+        std::lock_guard<std::mutex> lock{ m_lock };
+        m_entries.clear();
+    }
+
+    bool OpenedSourceCache::IsCurrent(const Entry& entry, const Source& source) const
+    {
+        if (entry.IsInstalled)
+        {
+            return entry.InstalledGeneration == m_installedGeneration.load() &&
+                std::chrono::steady_clock::now() - entry.OpenedAt < s_InstalledMaxAge;
+        }
+
+        const SourceDetails& cachedDetails = entry.Opened->GetDetails();
+
+        // The caller's details are read from the source list, so a newer update time means that the source
+        // was updated (possibly by another process) after the cached instance was opened.
+        if (source.GetDetails().LastUpdateTime > cachedDetails.LastUpdateTime)
+        {
+            AICLI_LOG(Repo, Info, << "Cached opened source is older than the last update: " << cachedDetails.Name);
+            return false;
+        }
+
+        if (!ShouldUpdateBeforeOpen(cachedDetails))
+        {
+            return true;
+        }
+
+        // When the update is deferred, opening again would not produce a newer index; the cached instance
+        // is invalidated when the scheduled update completes.
+        if (SourceUpdateScheduler::Instance().ShouldDeferUpdate(cachedDetails))
+        {
+            SourceUpdateScheduler::Instance().Schedule(cachedDetails);
+            return true;
+        }
+
+        // Reopen rather than serve a stale index when the source would be updated by opening it.
+        return false;
+    }
+
+    void OpenedSourceCache::EnsureInstalledWatchers()
+    {
+        std::lock_guard<std::mutex> lock{ m_lock };
+
+        if (m_installedWatchers)
+        {
+            return;
+        }
+
+        m_installedWatchers = std::make_unique<InstalledWatchers>();
+
+        for (const auto& [root, subKey] : s_UninstallKeys)
+        {
+            auto watcher = wil::make_registry_watcher_nothrow(root, subKey.data(), true, [this](wil::RegistryChangeKind)
+                {
+                    ++m_installedGeneration;
+                });
+
+            if (watcher)
+            {
+                m_installedWatchers->Watchers.emplace_back(std::move(watcher));
+            }
+            else
+            {
+                // Without a watcher, the max age still bounds how stale the installed source can be.
+                AICLI_LOG(Repo, Warning, << "Failed to watch uninstall registry key: " << Utility::ConvertToUTF8(subKey));
+            }
+        }
+    }
+}
@@ -100,6 +100,202 @@ namespace AppInstaller::Repository
                 Manifest::ManifestException(
                     std::move(validationErrors), APPINSTALLER_CLI_ERROR_DEPENDENCIES_VALIDATION_FAILED));
         }
+
+        // An in memory copy of the package dependency graph of an index, with a batch of manifests applied on top of it.
+        // Each package is a node whose edges are the dependencies of its latest version, so the whole graph is read
+        // from the index with two queries rather than several queries per node.
+        struct IndexDependencyGraph
+        {
+            static constexpr size_t s_MissingNode = std::numeric_limits<size_t>::max();
+
+            struct Edge
+            {
+                std::string Id;
+                std::optional<Utility::Version> MinVersion;
+                size_t Target = s_MissingNode;
+            };
+
+            struct Node
+            {
+                std::string Id;
+                Utility::Version LatestVersion;
+                std::vector<Edge> Edges;
+            };
+
+            IndexDependencyGraph(SQLiteIndex* index, const std::vector<Manifest::Manifest>& manifests)
+            {
+                // Find the latest version of every package; versions are compared semantically, so this is done here rather than in the query.
+                std::unordered_map<SQLite::rowid_t, size_t> latestManifestToNode;
+                std::vector<SQLite::rowid_t> nodeLatestManifest;
+
+                for (auto& [manifestRowId, id, version] : index->GetAllManifestVersions())
+                {
+                    Utility::Version current{ std::move(version) };
+                    auto [itr, inserted] = m_nodesById.emplace(Utility::FoldCase(id), m_nodes.size());
+
+                    if (inserted)
+                    {
+                        m_nodes.emplace_back(Node{ std::move(id), std::move(current) });
+                        nodeLatestManifest.emplace_back(manifestRowId);
+                    }
+                    else if (current > m_nodes[itr->second].LatestVersion)
+                    {
+                        m_nodes[itr->second].LatestVersion = std::move(current);
+                        nodeLatestManifest[itr->second] = manifestRowId;
+                    }
+                }
+
+                for (size_t i = 0; i < nodeLatestManifest.size(); ++i)
+                {
+                    latestManifestToNode.emplace(nodeLatestManifest[i], i);
+                }
+
+                // Apply the batch; every manifest has a node of its own so that its dependencies are validated, and dependents
+                // resolve to the latest version of the package, which replaces the dependencies from the index if it is in the batch.
+                size_t indexNodeCount = m_nodes.size();
+                std::vector<bool> replaced(indexNodeCount, false);
+
+                for (const auto& manifest : manifests)
+                {
+                    Utility::Version version{ manifest.Version };
+                    size_t nodeIndex = m_nodes.size();
+                    m_nodes.emplace_back(Node{ manifest.Id, version });
+                    m_roots.emplace_back(nodeIndex);
+
+                    auto [itr, inserted] = m_nodesById.emplace(Utility::FoldCase(manifest.Id), nodeIndex);
+                    if (!inserted && version >= m_nodes[itr->second].LatestVersion)
+                    {
+                        if (itr->second < indexNodeCount)
+                        {
+                            replaced[itr->second] = true;
+                        }
+
+                        itr->second = nodeIndex;
+                    }
+
+                    GetDependencies(manifest, Manifest::DependencyType::Package).ApplyToAll([&](const Manifest::Dependency& dependency)
+                        {
+                            m_nodes[nodeIndex].Edges.emplace_back(Edge{ dependency.Id(), dependency.MinVersion });
+                        });
+                }
+
+                for (auto& [manifestRowId, id, minVersion] : index->GetAllDependencies())
+                {
+                    auto itr = latestManifestToNode.find(manifestRowId);
+                    if (itr == latestManifestToNode.end() || replaced[itr->second])
+                    {
+                        continue;
+                    }
+
+                    std::optional<Utility::Version> edgeMinVersion;
+                    if (!minVersion.empty())
+                    {
+                        edgeMinVersion.emplace(std::move(minVersion));
+                    }
+
+                    m_nodes[itr->second].Edges.emplace_back(Edge{ std::move(id), std::move(edgeMinVersion) });
+                }
+
+                for (auto& node : m_nodes)
+                {
+                    for (auto& edge : node.Edges)
+                    {
+                        auto itr = m_nodesById.find(Utility::FoldCase(edge.Id));
+                        if (itr != m_nodesById.end())
+                        {
+                            edge.Target = itr->second;
+                        }
+                    }
+                }
+            }
+
+            // Walks everything reachable from the manifests in the batch once, collecting unsatisfied dependencies and loops.
+            void Validate(std::vector<Manifest::ValidationError>& dependencyErrors, std::vector<Manifest::ValidationError>& loopErrors) const
+            {
+                enum class State : uint8_t
+                {
+                    NotVisited,
+                    InProgress,
+                    Done,
+                };
+
+                std::vector<State> states(m_nodes.size(), State::NotVisited);
+                std::set<std::string> missing;
+                std::set<std::string> unsatisfied;
+                std::set<size_t> loops;
+
+                // The node being walked and the index of its next edge.
+                std::vector<std::pair<size_t, size_t>> stack;
+
+                for (size_t root : m_roots)
+                {
+                    if (states[root] != State::NotVisited)
+                    {
+                        continue;
+                    }
+
+                    states[root] = State::InProgress;
+                    stack.emplace_back(root, 0);
+
+                    while (!stack.empty())
+                    {
+                        auto& [current, nextEdge] = stack.back();
+                        const auto& edges = m_nodes[current].Edges;
+
+                        if (nextEdge == edges.size())
+                        {
+                            states[current] = State::Done;
+                            stack.pop_back();
+                            continue;
+                        }
+
+                        const Edge& edge = edges[nextEdge++];
+
+                        if (edge.Target == s_MissingNode)
+                        {
+                            if (missing.emplace(Utility::FoldCase(edge.Id)).second)
+                            {
+                                dependencyErrors.emplace_back(Manifest::ManifestError::MissingManifestDependenciesNode, "PackageIdentifier", edge.Id);
+                            }
+                            continue;
+                        }
+
+                        const Node& target = m_nodes[edge.Target];
+
+                        if (edge.MinVersion && edge.MinVersion.value() > target.LatestVersion)
+                        {
+                            if (unsatisfied.emplace(Utility::FoldCase(edge.Id)).second)
+                            {
+                                dependencyErrors.emplace_back(Manifest::ManifestError::NoSuitableMinVersionDependency, "PackageIdentifier", edge.Id);
+                            }
+                            continue;
+                        }
+
+                        switch (states[edge.Target])
+                        {
+                        case State::NotVisited:
+                            states[edge.Target] = State::InProgress;
+                            stack.emplace_back(edge.Target, 0);
+                            break;
+                        case State::InProgress:
+                            // The target is still being walked, so this edge closes a loop.
+                            if (loops.emplace(edge.Target).second)
+                            {
+                                loopErrors.emplace_back(Manifest::ManifestError::FoundDependencyLoop, "PackageIdentifier", target.Id);
+                            }
+                            break;
+                        default:
+                            break;
+                        }
+                    }
+                }
+            }
+
+        private:
+            std::vector<Node> m_nodes;
+            std::unordered_map<std::string, size_t> m_nodesById;
+            std::vector<size_t> m_roots;
+        };
     };
 
     bool PackageDependenciesValidation::ValidateManifestDependencies(SQLiteIndex* index, const Manifest::Manifest& manifest)
@@ -169,6 +365,27 @@ namespace AppInstaller::Repository
         return true;
     }
 
+    bool PackageDependenciesValidation::ValidateManifestsDependencies(SQLiteIndex* index, const std::vector<Manifest::Manifest>& manifests)
+    {
+        IndexDependencyGraph graph{ index, manifests };
+
+        std::vector<Manifest::ValidationError> dependencyErrors;
+        std::vector<Manifest::ValidationError> loopErrors;
+        graph.Validate(dependencyErrors, loopErrors);
+
+        if (!dependencyErrors.empty())
+        {
+            THROW_EXCEPTION(Manifest::ManifestException(std::move(dependencyErrors), APPINSTALLER_CLI_ERROR_DEPENDENCIES_VALIDATION_FAILED));
+        }
+
+        if (!loopErrors.empty())
+        {
+            THROW_EXCEPTION(Manifest::ManifestException(std::move(loopErrors), APPINSTALLER_CLI_ERROR_DEPENDENCIES_VALIDATION_FAILED));
+        }
+
+        return true;
+    }
+
     bool PackageDependenciesValidation::VerifyDependenciesStructureForManifestDelete(SQLiteIndex* index, const Manifest::Manifest& manifest)
     {
         auto dependentsSet = index->GetDependentsById(manifest.Id);
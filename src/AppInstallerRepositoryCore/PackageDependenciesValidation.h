@@ -13,6 +13,10 @@ namespace AppInstaller::Repository
         // Validate the dependencies of the given manifest.
         static bool ValidateManifestDependencies(SQLiteIndex* index, const Manifest::Manifest& manifest);
 
+        // Validate the dependencies of a batch of manifests, as if all of them were added to the index.
+        // The dependency data of the whole index is read once, so this is preferred when validating many manifests.
+        static bool ValidateManifestsDependencies(SQLiteIndex* index, const std::vector<Manifest::Manifest>& manifests);
+
         static bool VerifyDependenciesStructureForManifestDelete(SQLiteIndex* index, const Manifest::Manifest& manifest);
     };
 }
@@ -2,7 +2,9 @@
 // Licensed under the MIT License.
 #include "pch.h"
 #include "Public/winget/RepositorySearch.h"
+#include <winget/FileHashCache.h>
 #include <winget/Filesystem.h>
+#include <unordered_map>
 
 using namespace AppInstaller::Settings;
 using namespace std::chrono_literals;
@@ -27,25 +29,76 @@ namespace AppInstaller::Repository
             return installLocationStatus;
         }
 
-        // Map to cache already calculated file hashes.
-        struct FilePathComparator
+        // Gets the key identifying a file path; paths are case insensitive.
+        std::string GetFileKey(const std::filesystem::path& filePath)
         {
-            bool operator()(const std::filesystem::path& a, const std::filesystem::path& b) const
+            return Utility::FoldCase(std::string_view{ filePath.lexically_normal().u8string() });
+        }
+
+        // Computes the hashes of the files needed by one installed status check.
+        // Each file is hashed at most once, and the process wide cache is used so that unchanged files are not hashed again.
+        struct InstalledFileHasher
+        {
+            void Add(const std::filesystem::path& filePath)
+            {
+                m_files.try_emplace(GetFileKey(filePath), filePath);
+            }
+
+            void ComputeHashes()
             {
-                if (std::filesystem::equivalent(a, b))
+                std::vector<std::filesystem::path> paths;
+                for (const auto& file : m_files)
+                {
+                    paths.emplace_back(file.second.Path);
+                }
+
+                std::vector<Utility::FileHashCache::FileHash> hashes = Utility::FileHashCache::Instance().GetHashes(paths);
+
+                size_t i = 0;
+                for (auto& file : m_files)
                 {
-                    return false;
+                    if (SUCCEEDED(hashes[i].Error))
+                    {
+                        file.second.Hash = std::move(hashes[i].Hash);
+                    }
+
+                    ++i;
                 }
+            }
 
-                return a < b;
+            // Gets the hash of a file added previously, or nothing if it could not be computed.
+            const std::optional<Utility::SHA256::HashBuffer>& GetHash(const std::filesystem::path& filePath) const
+            {
+                return m_files.at(GetFileKey(filePath)).Hash;
             }
+
+        private:
+            struct FileHash
+            {
+                FileHash(const std::filesystem::path& path) : Path(path) {}
+
+                std::filesystem::path Path;
+                std::optional<Utility::SHA256::HashBuffer> Hash;
+            };
+
+            std::unordered_map<std::string, FileHash> m_files;
         };
-        using FileHashMap = std::map<std::filesystem::path, Utility::SHA256::HashBuffer, FilePathComparator>;
 
+        // A file status that is waiting for the hash of the file.
+        struct PendingFileHashCheck
+        {
+            size_t InstallerIndex;
+            size_t StatusIndex;
+            std::filesystem::path FilePath;
+            Utility::SHA256::HashBuffer ExpectedHash;
+        };
+
+        // Checks whether the file is present. If the hash should also be checked, the file is added to the hasher
+        // and the returned status is replaced once the hash is available.
         HRESULT CheckInstalledFileStatus(
             const std::filesystem::path& filePath,
-            const Utility::SHA256::HashBuffer& expectedHash,
-            FileHashMap& fileHashes)
+            bool checkHash,
+            InstalledFileHasher& fileHasher)
         {
             HRESULT fileStatus = WINGET_INSTALLED_STATUS_FILE_NOT_FOUND;
             try
@@ -53,18 +106,9 @@ namespace AppInstaller::Repository
                 if (std::filesystem::exists(filePath) && std::filesystem::is_regular_file(filePath))
                 {
                     fileStatus = WINGET_INSTALLED_STATUS_FILE_FOUND_WITHOUT_HASH_CHECK;
-                    if (!expectedHash.empty())
+                    if (checkHash)
                     {
-                        auto itr = fileHashes.find(filePath);
-                        if (itr == fileHashes.end())
-                        {
-                            // If not found in cache, compute the hash.
-                            std::ifstream in{ filePath, std::ifstream::binary };
-                            itr = fileHashes.emplace(filePath, Utility::SHA256::ComputeHash(in)).first;
-                        }
-
-                        fileStatus = Utility::SHA256::AreEqual(expectedHash, itr->second) ?
-                            WINGET_INSTALLED_STATUS_FILE_HASH_MATCH : WINGET_INSTALLED_STATUS_FILE_HASH_MISMATCH;
+                        fileHasher.Add(filePath);
                     }
                 }
             }
@@ -76,6 +120,19 @@ namespace AppInstaller::Repository
             return fileStatus;
         }
 
+        HRESULT GetInstalledFileHashStatus(
+            const std::optional<Utility::SHA256::HashBuffer>& fileHash,
+            const Utility::SHA256::HashBuffer& expectedHash)
+        {
+            if (!fileHash)
+            {
+                return WINGET_INSTALLED_STATUS_FILE_ACCESS_ERROR;
+            }
+
+            return Utility::SHA256::AreEqual(expectedHash, fileHash.value()) ?
+                WINGET_INSTALLED_STATUS_FILE_HASH_MATCH : WINGET_INSTALLED_STATUS_FILE_HASH_MISMATCH;
+        }
+
         std::vector<InstallerInstalledStatus> CheckInstalledStatusInternal(
             const std::shared_ptr<IPackage>& package,
             InstalledStatusType checkTypes)
@@ -86,7 +143,8 @@ namespace AppInstaller::Repository
             bool checkFileHash = false;
             std::shared_ptr<IPackageVersion> installedVersion = package->GetInstalledVersion();
             std::shared_ptr<IPackageVersion> availableVersion;
-            FileHashMap fileHashes;
+            InstalledFileHasher fileHasher;
+            std::vector<PendingFileHashCheck> pendingFileHashChecks;
 
             // Variables for metadata from installed version.
             InstallerTypeEnum installedType = InstallerTypeEnum::Unknown;
@@ -144,7 +202,7 @@ namespace AppInstaller::Repository
             }
 
             auto manifest = availableVersion->GetManifest();
-            for (auto const& installer : manifest.Installers)
+            for (auto const& installer : manifest->Installers)
             {
                 InstallerInstalledStatus installerStatus;
                 installerStatus.Installer = installer;
@@ -185,7 +243,13 @@ namespace AppInstaller::Repository
                         for (auto const& file : installer.InstallationMetadata.Files)
                         {
                             std::filesystem::path filePath = installedLocation / Utility::ConvertToUTF16(file.RelativeFilePath);
-                            auto fileStatus = CheckInstalledFileStatus(filePath, checkFileHash ? file.FileSha256 : Utility::SHA256::HashBuffer{}, fileHashes);
+                            bool checkHash = checkFileHash && !file.FileSha256.empty();
+                            auto fileStatus = CheckInstalledFileStatus(filePath, checkHash, fileHasher);
+
+                            if (checkHash && fileStatus == WINGET_INSTALLED_STATUS_FILE_FOUND_WITHOUT_HASH_CHECK)
+                            {
+                                pendingFileHashChecks.emplace_back(PendingFileHashCheck{ result.size(), installerStatus.Status.size(), filePath, file.FileSha256 });
+                            }
 
                             installerStatus.Status.emplace_back(
                                 InstalledStatusType::AppsAndFeaturesEntryInstallLocationFile,
@@ -217,7 +281,13 @@ namespace AppInstaller::Repository
                         for (auto const& file : installer.InstallationMetadata.Files)
                         {
                             std::filesystem::path filePath = defaultInstalledLocation / Utility::ConvertToUTF16(file.RelativeFilePath);
-                            auto fileStatus = CheckInstalledFileStatus(filePath, checkFileHash ? file.FileSha256 : Utility::SHA256::HashBuffer{}, fileHashes);
+                            bool checkHash = checkFileHash && !file.FileSha256.empty();
+                            auto fileStatus = CheckInstalledFileStatus(filePath, checkHash, fileHasher);
+
+                            if (checkHash && fileStatus == WINGET_INSTALLED_STATUS_FILE_FOUND_WITHOUT_HASH_CHECK)
+                            {
+                                pendingFileHashChecks.emplace_back(PendingFileHashCheck{ result.size(), installerStatus.Status.size(), filePath, file.FileSha256 });
+                            }
 
                             installerStatus.Status.emplace_back(
                                 InstalledStatusType::DefaultInstallLocationFile,
@@ -233,6 +303,18 @@ namespace AppInstaller::Repository
                 }
             }
 
+            // Hash all of the found files together, then complete their statuses.
+            if (!pendingFileHashChecks.empty())
+            {
+                fileHasher.ComputeHashes();
+
+                for (const auto& pending : pendingFileHashChecks)
+                {
+                    result[pending.InstallerIndex].Status[pending.StatusIndex].Status =
+                        GetInstalledFileHashStatus(fileHasher.GetHash(pending.FilePath), pending.ExpectedHash);
+                }
+            }
+
             return result;
         }
     }
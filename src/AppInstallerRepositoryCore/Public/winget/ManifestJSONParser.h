@@ -10,6 +10,19 @@
 
 namespace AppInstaller::Repository::JSON
 {
+    // A single version from a REST manifest response, found without deserializing its manifest.
+    struct ManifestVersionJson
+    {
+        std::string PackageIdentifier;
+        std::string Version;
+        std::string Channel;
+        std::string PackageName;
+        std::string Publisher;
+
+        // The JSON for the whole version; refers into the response that it was found in.
+        std::string_view Json;
+    };
+
     // Exposes functions for parsing JSON REST responses to manifest requests.
     struct ManifestJSONParser
     {
@@ -27,6 +40,16 @@ namespace AppInstaller::Repository::JSON
         // May potentially contain multiple versions of the same package.
         std::vector<Manifest::Manifest> Deserialize(const web::json::value& response) const;
 
+        // Deserializes the manifests from the UTF-8 JSON body of a REST response.
+        // May potentially contain multiple versions of the same package.
+        std::vector<Manifest::Manifest> Deserialize(std::string_view response) const;
+
+        // Finds the versions in the UTF-8 JSON body of a REST response, reading only the values needed to identify them.
+        static std::vector<ManifestVersionJson> FindVersions(std::string_view response);
+
+        // Deserializes the manifest for a version found in a response.
+        Manifest::Manifest DeserializeVersion(const ManifestVersionJson& version) const;
+
         // Deserializes the manifests from the Data field of the REST response object.
         // May potentially contain multiple versions of the same package.
         std::vector<Manifest::Manifest> DeserializeData(const web::json::value& data) const;
@@ -0,0 +1,63 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+#pragma once
+#include <winget/RepositorySource.h>
+
+#include <atomic>
+#include <chrono>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+
+
+namespace AppInstaller::Repository
+{
+    // A process wide cache of opened sources, allowing a long running host to share one opened
+    // instance of a source (and its index) between all of its callers rather than opening it for each.
+    // Callers receive copies of the cached Source that share the underlying opened source; invalidating
+    // an entry only releases the cache's reference, so sources already handed out keep working.
+    struct OpenedSourceCache
+    {
+        OpenedSourceCache();
+        ~OpenedSourceCache();
+
+        OpenedSourceCache(const OpenedSourceCache&) = delete;
+        OpenedSourceCache& operator=(const OpenedSourceCache&) = delete;
+
+        OpenedSourceCache(OpenedSourceCache&&) = delete;
+        OpenedSourceCache& operator=(OpenedSourceCache&&) = delete;
+
+        // Gets the cache for the process.
+        static OpenedSourceCache& Instance();
+
+        // Opens the source for the given caller, or returns the cached instance if it is still current.
+        // The source must be a single, unopened source.
+        // An available source is reopened when the given source has been updated more recently than
+        // the cached instance, or when it is due for an automatic update.
+        // An installed source is reopened when the installed inventory may have changed.
+        Source Open(const Source& source, std::string_view caller, IProgressCallback& progress);
+
+        // Drops the cached instances of the source with the given identifier.
+        void Invalidate(std::string_view identifier);
+
+        // Drops the cached instances of installed sources; call after any change to the installed packages.
+        void InvalidateInstalled();
+
+        // Drops all cached instances.
+        void Clear();
+
+    private:
+        struct Entry;
+        struct InstalledWatchers;
+
+        bool IsCurrent(const Entry& entry, const Source& source) const;
+        void EnsureInstalledWatchers();
+
+        std::mutex m_lock;
+        std::map<std::string, std::shared_ptr<Entry>> m_entries;
+        std::atomic<uint64_t> m_installedGeneration{ 0 };
+        std::unique_ptr<InstalledWatchers> m_installedWatchers;
+    };
+}
@@ -222,7 +222,8 @@ namespace AppInstaller::Repository
         virtual std::vector<Utility::LocIndString> GetMultiProperty(PackageVersionMultiProperty property) const = 0;
 
         // Gets the manifest of this package version.
-        virtual Manifest::Manifest GetManifest() = 0;
+        // The manifest may be shared with the source and other callers; use Edit to modify it.
+        virtual Manifest::SharedManifest GetManifest() = 0;
 
         // Gets the source where this package version is from.
         virtual Source GetSource() const = 0;
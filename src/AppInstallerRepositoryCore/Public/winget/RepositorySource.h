@@ -125,6 +125,16 @@ namespace AppInstaller::Repository
         // This value is used as an alternative to the `Arg` value if it is failing to function properly.
         // The alternate location must point to identical data or inconsistencies may arise.
         std::string AlternateArg;
+
+        // Source information cached by the source type to avoid retrieving it on every open, and when it was cached.
+        // Stored with the source metadata; the contents are specific to the source type.
+        std::string InformationCache;
+        std::chrono::system_clock::time_point InformationCacheTime = {};
+
+        // The custom header and caller that the source is opened with, for source types that support them.
+        // These are not stored with the source metadata.
+        std::optional<std::string> CustomHeader;
+        std::string Caller;
     };
 
     // Individual source agreement entry. Label will be highlighted in the display as the key of the agreement entry.
@@ -171,6 +181,9 @@ namespace AppInstaller::Repository
         // Constructor to get a named source, passing empty string will get all available sources.
         Source(std::string_view name);
 
+        // Constructor to get the given named sources, combined in the same way as all available sources are.
+        explicit Source(const std::vector<std::string>& names);
+
         // Constructor to get a PredefinedSource. Like installed source, etc.
         Source(PredefinedSource source);
 
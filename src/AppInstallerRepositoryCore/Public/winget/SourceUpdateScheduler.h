@@ -0,0 +1,92 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+#pragma once
+#include <winget/RepositorySource.h>
+#include <wil/resource.h>
+
+#include <atomic>
+#include <chrono>
+#include <deque>
+#include <mutex>
+#include <vector>
+
+
+namespace AppInstaller::Repository
+{
+    // Updates sources that are past their auto update time outside of the operation that found them to be out of date,
+    // so that opening a source does not wait on downloading it.
+    // While updates are deferred, opening an out of date source uses the current copy and schedules the update here.
+    // A short lived process hands the scheduled updates to other processes once it has completed its work; a long lived
+    // one runs them as they are scheduled and also checks for out of date sources periodically.
+    struct SourceUpdateScheduler
+    {
+        SourceUpdateScheduler();
+        ~SourceUpdateScheduler();
+
+        SourceUpdateScheduler(const SourceUpdateScheduler&) = delete;
+        SourceUpdateScheduler& operator=(const SourceUpdateScheduler&) = delete;
+
+        SourceUpdateScheduler(SourceUpdateScheduler&&) = delete;
+        SourceUpdateScheduler& operator=(SourceUpdateScheduler&&) = delete;
+
+        // Gets the scheduler for the process.
+        static SourceUpdateScheduler& Instance();
+
+        // Defers updates for the rest of the process, unless disabled by settings.
+        void EnableDeferredUpdates();
+
+        // Returns to updating sources before they are opened.
+        void DisableDeferredUpdates();
+
+        // Determines whether the update of the given out of date source should be deferred.
+        // A source that has never been updated is not, as there may be no copy to use in the meantime.
+        bool ShouldDeferUpdate(const SourceDetails& details) const;
+
+        // Schedules an update of the source; a source that is already scheduled is not added again.
+        void Schedule(const SourceDetails& details);
+
+        // Runs the scheduled updates on the calling thread.
+        void RunPending();
+
+        // Removes and returns the scheduled updates, so that they can be run elsewhere.
+        std::vector<SourceDetails> TakePending();
+
+        // Defers updates, runs them on the thread pool as they are scheduled, and periodically schedules
+        // updates for all out of date sources. Intended for long running processes.
+        void EnablePeriodicUpdates();
+
+        // Cancels any update in progress, stops scheduling updates and waits for the thread pool callbacks to complete.
+        // Long running processes must call this before exiting; it cannot be done from the destructor, as waiting
+        // on the thread pool is not safe while the loader lock is held.
+        void Shutdown();
+
+        // Extends the interval by a random amount of up to a quarter of it, so that many machines
+        // (or processes) started together do not all update at the same time.
+        static std::chrono::milliseconds AddJitter(std::chrono::milliseconds interval);
+
+    private:
+        static void CALLBACK RunPendingCallback(PTP_CALLBACK_INSTANCE, PVOID context, PTP_WORK);
+        static void CALLBACK TimerCallback(PTP_CALLBACK_INSTANCE, PVOID context, PTP_TIMER);
+
+        void RunUpdate(const SourceDetails& details);
+        void ScheduleOutOfDateSources();
+        void SetTimer();
+
+        std::atomic_bool m_deferUpdates{ false };
+        std::atomic_bool m_runOnThreadPool{ false };
+
+        std::mutex m_lock;
+        std::deque<SourceDetails> m_pending;
+        wil::unique_threadpool_timer_nowait m_timer;
+        wil::unique_threadpool_work_nowait m_work;
+
+        // Set under m_lock when the scheduler is shut down; no new work is started once it is.
+        bool m_stopping = false;
+
+        // The progress of the update being run, if any, so that it can be cancelled. Guarded by m_lock.
+        ProgressCallback* m_runningProgress = nullptr;
+
+        // Held while running updates, so that only one thread runs them at a time.
+        std::mutex m_runLock;
+    };
+}
@@ -11,12 +11,15 @@
 #include "Microsoft/PreIndexedPackageSourceFactory.h"
 #include "Rest/RestSourceFactory.h"
 #include "PackageTrackingCatalogSourceFactory.h"
+#include "winget/OpenedSourceCache.h"
+#include "winget/SourceUpdateScheduler.h"
 
 #ifndef AICLI_DISABLE_TEST_HOOKS
 #include "Microsoft/ConfigurableTestSourceFactory.h"
 #endif
 
 #include <winget/GroupPolicy.h>
+#include <winget/Tracing.h>
 
 using namespace AppInstaller::Settings;
 using namespace std::chrono_literals;
@@ -74,11 +77,6 @@ namespace AppInstaller::Repository
             return AddOrUpdateFromDetails(details, &ISourceFactory::Update, progress);
         }
 
-        bool BackgroundUpdateSourceFromDetails(SourceDetails& details, IProgressCallback& progress)
-        {
-            return AddOrUpdateFromDetails(details, &ISourceFactory::BackgroundUpdate, progress);
-        }
-
         bool RemoveSourceFromDetails(const SourceDetails& details, IProgressCallback& progress)
         {
             auto factory = ISourceFactory::GetForType(details.Type);
@@ -91,34 +89,6 @@ namespace AppInstaller::Repository
             return (origin == SourceOrigin::Default || origin == SourceOrigin::GroupPolicy || origin == SourceOrigin::User);
         }
 
-        // Determines whether (and logs why) a source should be updated before it is opened.
-        bool ShouldUpdateBeforeOpen(const SourceDetails& details)
-        {
-            if (!ContainsAvailablePackagesInternal(details.Origin))
-            {
-                return false;
-            }
-
-            constexpr static auto s_ZeroMins = 0min;
-            auto autoUpdateTime = User().Get<Setting::AutoUpdateTimeInMinutes>();
-
-            // A value of zero means no auto update, to get update the source run `winget update`
-            if (autoUpdateTime != s_ZeroMins)
-            {
-                auto autoUpdateTimeMins = std::chrono::minutes(autoUpdateTime);
-                auto timeSinceLastUpdate = std::chrono::system_clock::now() - details.LastUpdateTime;
-                if (timeSinceLastUpdate > autoUpdateTimeMins)
-                {
-                    AICLI_LOG(Repo, Info, << "Source past auto update time [" <<
-                        std::chrono::duration_cast<std::chrono::minutes>(autoUpdateTimeMins).count() << " mins]; it has been at least " <<
-                        std::chrono::duration_cast<std::chrono::minutes>(timeSinceLastUpdate).count() << " mins");
-                    return true;
-                }
-            }
-
-            return false;
-        }
-
         SourceDetails GetPredefinedSourceDetails(PredefinedSource source)
         {
             SourceDetails details;
@@ -180,6 +150,38 @@ namespace AppInstaller::Repository
         };
     }
 
+    bool BackgroundUpdateSourceFromDetails(SourceDetails& details, IProgressCallback& progress)
+    {
+        return AddOrUpdateFromDetails(details, &ISourceFactory::BackgroundUpdate, progress);
+    }
+
+    bool ShouldUpdateBeforeOpen(const SourceDetails& details)
+    {
+        if (!ContainsAvailablePackagesInternal(details.Origin))
+        {
+            return false;
+        }
+
+        constexpr static auto s_ZeroMins = 0min;
+        auto autoUpdateTime = User().Get<Setting::AutoUpdateTimeInMinutes>();
+
+        // A value of zero means no auto update, to get update the source run `winget update`
+        if (autoUpdateTime != s_ZeroMins)
+        {
+            auto autoUpdateTimeMins = std::chrono::minutes(autoUpdateTime);
+            auto timeSinceLastUpdate = std::chrono::system_clock::now() - details.LastUpdateTime;
+            if (timeSinceLastUpdate > autoUpdateTimeMins)
+            {
+                AICLI_LOG(Repo, Info, << "Source past auto update time [" <<
+                    std::chrono::duration_cast<std::chrono::minutes>(autoUpdateTimeMins).count() << " mins]; it has been at least " <<
+                    std::chrono::duration_cast<std::chrono::minutes>(timeSinceLastUpdate).count() << " mins");
+                return true;
+            }
+        }
+
+        return false;
+    }
+
     std::unique_ptr<ISourceFactory> ISourceFactory::GetForType(std::string_view type)
     {
 #ifndef AICLI_DISABLE_TEST_HOOKS
@@ -251,6 +253,16 @@ namespace AppInstaller::Repository
         InitializeSourceReference(name);
     }
 
+    Source::Source(const std::vector<std::string>& names)
+    {
+        for (const auto& name : names)
+        {
+            InitializeSourceReference(name);
+        }
+
+        m_isComposite = m_sourceReferences.size() > 1;
+    }
+
     Source::Source(PredefinedSource source)
     {
         SourceDetails details = GetPredefinedSourceDetails(source);
@@ -426,7 +438,15 @@ namespace AppInstaller::Repository
     bool Source::SetCustomHeader(std::optional<std::string> header)
     {
         THROW_HR_IF(HRESULT_FROM_WIN32(ERROR_INVALID_STATE), m_sourceReferences.size() != 1);
-        return m_sourceReferences[0]->SetCustomHeader(header);
+
+        if (!m_sourceReferences[0]->SetCustomHeader(header))
+        {
+            return false;
+        }
+
+        // Keep the header with the details, so that those sharing opened sources can tell which header they were opened with.
+        m_sourceReferences[0]->GetDetails().CustomHeader = std::move(header);
+        return true;
     }
 
     void Source::SetCaller(std::string caller)
@@ -512,6 +532,17 @@ namespace AppInstaller::Repository
     {
         THROW_HR_IF(HRESULT_FROM_WIN32(ERROR_INVALID_STATE), m_isSourceToBeAdded || m_sourceReferences.empty());
 
+        Logging::TraceSpan span{ Logging::Channel::Repo, "Source::Open" };
+        if (span)
+        {
+            std::string names;
+            for (const auto& sourceReference : m_sourceReferences)
+            {
+                names += (names.empty() ? "" : ", ") + sourceReference->GetDetails().Name;
+            }
+            span.AddArgument("sources", names);
+        }
+
         std::vector<SourceDetails> result;
 
         if (!m_source)
@@ -524,6 +555,13 @@ namespace AppInstaller::Repository
                 auto& details = sourceReference->GetDetails();
                 if (ShouldUpdateBeforeOpen(details))
                 {
+                    if (SourceUpdateScheduler::Instance().ShouldDeferUpdate(details))
+                    {
+                        // Use the current copy rather than wait on the update.
+                        SourceUpdateScheduler::Instance().Schedule(details);
+                        continue;
+                    }
+
                     try
                     {
                         // TODO: Consider adding a context callback to indicate we are doing the same action
@@ -668,6 +706,7 @@ namespace AppInstaller::Repository
                     auto detailsInternal = sourceList.GetSource(details.Name);
                     detailsInternal->LastUpdateTime = details.LastUpdateTime;
                     sourceList.SaveMetadata(*detailsInternal);
+                    OpenedSourceCache::Instance().Invalidate(details.Identifier);
                 }
                 else
                 {
@@ -700,6 +739,7 @@ namespace AppInstaller::Repository
         {
             SourceList sourceList;
             sourceList.RemoveSource(details);
+            OpenedSourceCache::Instance().Invalidate(details.Identifier);
         }
 
         return result;
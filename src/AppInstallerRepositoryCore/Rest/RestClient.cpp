@@ -93,6 +93,19 @@ namespace AppInstaller::Repository::Rest
         return information;
     }
 
+    web::json::value RestClient::GetInformationResponse(const std::string& restApi, std::optional<std::string> customHeader, std::string_view caller, const HttpClientHelper& helper)
+    {
+        utility::string_t restEndpoint = RestHelper::GetRestAPIBaseUri(restApi);
+        THROW_HR_IF(APPINSTALLER_CLI_ERROR_RESTSOURCE_INVALID_URL, !RestHelper::IsValidUri(restEndpoint));
+
+        utility::string_t endpoint = RestHelper::AppendPathToUri(restEndpoint, JSON::GetUtilityString(InformationGetEndpoint));
+        std::optional<web::json::value> response = helper.HandleGet(endpoint, GetHeaders(customHeader, caller));
+
+        THROW_HR_IF(APPINSTALLER_CLI_ERROR_UNSUPPORTED_RESTSOURCE, !response);
+
+        return std::move(response).value();
+    }
+
     std::optional<Version> RestClient::GetLatestCommonVersion(
         const std::vector<std::string>& serverSupportedVersions,
         const std::set<Version>& wingetSupportedVersions)
@@ -164,6 +177,19 @@ namespace AppInstaller::Repository::Rest
         auto headers = GetHeaders(customHeader, caller);
 
         IRestClient::Information information = GetInformation(restEndpoint, headers, helper);
+        return CreateInternal(restEndpoint, headers, information);
+    }
+
+    RestClient RestClient::CreateFromInformation(const std::string& restApi, const IRestClient::Information& information, std::optional<std::string> customHeader, std::string_view caller)
+    {
+        utility::string_t restEndpoint = RestHelper::GetRestAPIBaseUri(restApi);
+        THROW_HR_IF(APPINSTALLER_CLI_ERROR_RESTSOURCE_INVALID_URL, !RestHelper::IsValidUri(restEndpoint));
+
+        return CreateInternal(restEndpoint, GetHeaders(customHeader, caller), information);
+    }
+
+    RestClient RestClient::CreateInternal(const utility::string_t& restEndpoint, const std::unordered_map<utility::string_t, utility::string_t>& headers, const IRestClient::Information& information)
+    {
         std::optional<Version> latestCommonVersion = GetLatestCommonVersion(information.ServerSupportedVersions, WingetSupportedContracts);
         THROW_HR_IF(APPINSTALLER_CLI_ERROR_UNSUPPORTED_RESTSOURCE, !latestCommonVersion);
 
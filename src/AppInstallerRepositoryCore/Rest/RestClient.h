@@ -31,12 +31,20 @@ namespace AppInstaller::Repository::Rest
 
         static Schema::IRestClient::Information GetInformation(const utility::string_t& restApi, const std::unordered_map<utility::string_t, utility::string_t>& additionalHeaders, const Schema::HttpClientHelper& httpClientHelper);
 
+        // Gets the unparsed response of the information endpoint, so that it can be cached.
+        static web::json::value GetInformationResponse(const std::string& restApi, std::optional<std::string> customHeader, std::string_view caller, const Schema::HttpClientHelper& httpClientHelper = {});
+
         static std::unique_ptr<Schema::IRestClient> GetSupportedInterface(const std::string& restApi, const std::unordered_map<utility::string_t, utility::string_t>& additionalHeaders, const Schema::IRestClient::Information& information, const AppInstaller::Utility::Version& version);
 
         static RestClient Create(const std::string& restApi, std::optional<std::string> customHeader, std::string_view caller, const Schema::HttpClientHelper& helper = {});
+
+        // Creates a client from previously retrieved information, without calling the information endpoint.
+        static RestClient CreateFromInformation(const std::string& restApi, const Schema::IRestClient::Information& information, std::optional<std::string> customHeader, std::string_view caller);
     private:
         RestClient(std::unique_ptr<Schema::IRestClient> supportedInterface, std::string sourceIdentifier);
 
+        static RestClient CreateInternal(const utility::string_t& restEndpoint, const std::unordered_map<utility::string_t, utility::string_t>& headers, const Schema::IRestClient::Information& information);
+
         std::unique_ptr<Schema::IRestClient> m_interface;
         std::string m_sourceIdentifier;
     };
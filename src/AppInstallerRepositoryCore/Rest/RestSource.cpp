@@ -2,6 +2,7 @@
 // Licensed under the MIT License.
 #include "pch.h"
 #include "RestSource.h"
+#include "RestSourceFactory.h"
 
 using namespace AppInstaller::Utility;
 
@@ -119,7 +120,7 @@ namespace AppInstaller::Repository::Rest
                         SearchRequest request;
                         request.Filters.emplace_back(PackageMatchField::Id, MatchType::CaseInsensitive, m_package.PackageInformation.PackageIdentifier);
 
-                        IRestClient::SearchResult result = GetReferenceSource()->GetRestClient().Search(request);
+                        IRestClient::SearchResult result = GetReferenceSource()->CallRestClient([&](const RestClient& client) { return client.Search(request); });
 
                         if (result.Matches.size() == 1)
                         {
@@ -210,7 +211,7 @@ namespace AppInstaller::Repository::Rest
                     }
                     else if (m_versionInfo.Manifest)
                     {
-                        auto arpVersionRange = m_versionInfo.Manifest->GetArpVersionRange();
+                        auto arpVersionRange = m_versionInfo.Manifest->Get().GetArpVersionRange();
                         return arpVersionRange.IsEmpty() ? Utility::LocIndString{} : Utility::LocIndString{ arpVersionRange.GetMinVersion().ToString() };
                     }
                     else
@@ -224,7 +225,7 @@ namespace AppInstaller::Repository::Rest
                     }
                     else if (m_versionInfo.Manifest)
                     {
-                        auto arpVersionRange = m_versionInfo.Manifest->GetArpVersionRange();
+                        auto arpVersionRange = m_versionInfo.Manifest->Get().GetArpVersionRange();
                         return arpVersionRange.IsEmpty() ? Utility::LocIndString{} : Utility::LocIndString{ arpVersionRange.GetMaxVersion().ToString() };
                     }
                     else
@@ -242,27 +243,57 @@ namespace AppInstaller::Repository::Rest
                 switch (property)
                 {
                 case PackageVersionMultiProperty::PackageFamilyName:
-                    for (std::string pfn : m_versionInfo.PackageFamilyNames)
+                    if (!m_versionInfo.PackageFamilyNames.empty())
                     {
-                        result.emplace_back(Utility::LocIndString{ pfn });
+                        for (std::string pfn : m_versionInfo.PackageFamilyNames)
+                        {
+                            result.emplace_back(Utility::LocIndString{ pfn });
+                        }
+                    }
+                    else if (m_versionInfo.Manifest)
+                    {
+                        for (auto pfn : m_versionInfo.Manifest->Get().GetPackageFamilyNames())
+                        {
+                            result.emplace_back(std::move(pfn));
+                        }
                     }
                     break;
                 case PackageVersionMultiProperty::ProductCode:
-                    for (std::string productCode : m_versionInfo.ProductCodes)
+                    if (!m_versionInfo.ProductCodes.empty())
+                    {
+                        for (std::string productCode : m_versionInfo.ProductCodes)
+                        {
+                            result.emplace_back(Utility::LocIndString{ productCode });
+                        }
+                    }
+                    else if (m_versionInfo.Manifest)
                     {
-                        result.emplace_back(Utility::LocIndString{ productCode });
+                        for (auto productCode : m_versionInfo.Manifest->Get().GetProductCodes())
+                        {
+                            result.emplace_back(std::move(productCode));
+                        }
                     }
                     break;
                 case PackageVersionMultiProperty::UpgradeCode:
-                    for (std::string upgradeCode : m_versionInfo.UpgradeCodes)
+                    if (!m_versionInfo.UpgradeCodes.empty())
                     {
-                        result.emplace_back(Utility::LocIndString{ upgradeCode });
+                        for (std::string upgradeCode : m_versionInfo.UpgradeCodes)
+                        {
+                            result.emplace_back(Utility::LocIndString{ upgradeCode });
+                        }
+                    }
+                    else if (m_versionInfo.Manifest)
+                    {
+                        for (auto upgradeCode : m_versionInfo.Manifest->Get().GetUpgradeCodes())
+                        {
+                            result.emplace_back(std::move(upgradeCode));
+                        }
                     }
                     break;
                 case PackageVersionMultiProperty::Name:
                     if (m_versionInfo.Manifest)
                     {
-                        for (auto name : m_versionInfo.Manifest->GetPackageNames())
+                        for (auto name : m_versionInfo.Manifest->Get().GetPackageNames())
                         {
                             result.emplace_back(std::move(name));
                         }
@@ -275,7 +306,7 @@ namespace AppInstaller::Repository::Rest
                 case PackageVersionMultiProperty::Publisher:
                     if (m_versionInfo.Manifest)
                     {
-                        for (auto publisher : m_versionInfo.Manifest->GetPublishers())
+                        for (auto publisher : m_versionInfo.Manifest->Get().GetPublishers())
                         {
                             result.emplace_back(std::move(publisher));
                         }
@@ -288,8 +319,9 @@ namespace AppInstaller::Repository::Rest
                 case PackageVersionMultiProperty::Locale:
                     if (m_versionInfo.Manifest)
                     {
-                        result.emplace_back(m_versionInfo.Manifest->DefaultLocalization.Locale);
-                        for (const auto& loc : m_versionInfo.Manifest->Localizations)
+                        const Manifest::Manifest& manifest = m_versionInfo.Manifest->Get();
+                        result.emplace_back(manifest.DefaultLocalization.Locale);
+                        for (const auto& loc : manifest.Localizations)
                         {
                             result.emplace_back(loc.Locale);
                         }
@@ -300,23 +332,26 @@ namespace AppInstaller::Repository::Rest
                 return result;
             }
 
-            Manifest::Manifest GetManifest() override
+            Manifest::SharedManifest GetManifest() override
             {
                 AICLI_LOG(Repo, Verbose, << "Getting manifest");
 
                 if (m_versionInfo.Manifest)
                 {
-                    return m_versionInfo.Manifest.value();
+                    return m_versionInfo.Manifest->GetShared();
                 }
 
                 if (m_package->HandleSingleUnknownVersion(m_versionInfo) &&
                     m_versionInfo.Manifest)
                 {
-                    return m_versionInfo.Manifest.value();
+                    return m_versionInfo.Manifest->GetShared();
                 }
 
-                std::optional<Manifest::Manifest> manifest = GetReferenceSource()->GetRestClient().GetManifestByVersion(
-                    m_package->PackageInfo().PackageIdentifier, m_versionInfo.VersionAndChannel.GetVersion().ToString(), m_versionInfo.VersionAndChannel.GetChannel().ToString());
+                std::optional<Manifest::Manifest> manifest = GetReferenceSource()->CallRestClient([&](const RestClient& client)
+                    {
+                        return client.GetManifestByVersion(
+                            m_package->PackageInfo().PackageIdentifier, m_versionInfo.VersionAndChannel.GetVersion().ToString(), m_versionInfo.VersionAndChannel.GetChannel().ToString());
+                    });
 
                 if (!manifest)
                 {
@@ -324,8 +359,8 @@ namespace AppInstaller::Repository::Rest
                     return {};
                 }
                 
-                m_versionInfo.Manifest = std::move(manifest.value());
-                return m_versionInfo.Manifest.value();
+                m_versionInfo.Manifest = std::make_shared<const IRestClient::LazyManifest>(std::move(manifest.value()));
+                return m_versionInfo.Manifest->GetShared();
             }
 
             Source GetSource() const override
@@ -404,8 +439,8 @@ namespace AppInstaller::Repository::Rest
         }
     }
 
-    RestSource::RestSource(const SourceDetails& details, SourceInformation information, RestClient&& restClient)
-        : m_details(details), m_information(std::move(information)), m_restClient(std::move(restClient))
+    RestSource::RestSource(const SourceDetails& details, SourceInformation information, RestClient&& restClient, bool informationFromCache)
+        : m_details(details), m_information(std::move(information)), m_restClient(std::move(restClient)), m_informationFromCache(informationFromCache)
     {
     }
 
@@ -426,7 +461,7 @@ namespace AppInstaller::Repository::Rest
 
     SearchResult RestSource::Search(const SearchRequest& request) const
     {
-        IRestClient::SearchResult results = m_restClient.Search(request);
+        IRestClient::SearchResult results = CallRestClient([&](const RestClient& client) { return client.Search(request); });
         SearchResult searchResult;
 
         std::shared_ptr<RestSource> sharedThis = NonConstSharedFromThis();
@@ -450,6 +485,27 @@ namespace AppInstaller::Repository::Rest
         return m_restClient;
     }
 
+    void RestSource::HandleRestClientFailure(HRESULT hr) const
+    {
+        if (!m_informationFromCache)
+        {
+            return;
+        }
+
+        switch (hr)
+        {
+        case APPINSTALLER_CLI_ERROR_UNSUPPORTED_RESTSOURCE:
+        case APPINSTALLER_CLI_ERROR_RESTSOURCE_INVALID_VERSION:
+        case APPINSTALLER_CLI_ERROR_RESTSOURCE_ENDPOINT_NOT_FOUND:
+        case APPINSTALLER_CLI_ERROR_RESTSOURCE_INTERNAL_ERROR:
+        case APPINSTALLER_CLI_ERROR_RESTSOURCE_UNSUPPORTED_MIME_TYPE:
+            // The server may no longer support the contract negotiated from the cached information.
+            AICLI_LOG(Repo, Info, << "Request rejected using cached information, clearing it for source: " << m_details.Name);
+            ClearInformationCache(m_details);
+            break;
+        }
+    }
+
     bool RestSource::IsSame(const RestSource* other) const
     {
         return (other && GetIdentifier() == other->GetIdentifier());
@@ -9,7 +9,7 @@ namespace AppInstaller::Repository::Rest
     // A source that holds a RestSource.
     struct RestSource : public std::enable_shared_from_this<RestSource>, public ISource
     {
-        RestSource(const SourceDetails& details, SourceInformation information, RestClient&& restClient);
+        RestSource(const SourceDetails& details, SourceInformation information, RestClient&& restClient, bool informationFromCache = false);
 
         RestSource(const RestSource&) = delete;
         RestSource& operator=(const RestSource&) = delete;
@@ -35,14 +35,32 @@ namespace AppInstaller::Repository::Rest
         // Gets the rest client.
         const RestClient& GetRestClient() const;
 
+        // Calls the rest client, discarding the cached information if the server rejects the contract it negotiated.
+        template <typename Func>
+        auto CallRestClient(Func&& func) const
+        {
+            try
+            {
+                return func(m_restClient);
+            }
+            catch (const wil::ResultException& re)
+            {
+                HandleRestClientFailure(re.GetErrorCode());
+                throw;
+            }
+        }
+
         // Determines if the other source refers to the same as this.
         bool IsSame(const RestSource* other) const;
 
     private:
         std::shared_ptr<RestSource> NonConstSharedFromThis() const;
 
+        void HandleRestClientFailure(HRESULT hr) const;
+
         SourceDetails m_details;
         SourceInformation m_information;
         RestClient m_restClient;
+        bool m_informationFromCache = false;
     };
 }
@@ -4,14 +4,78 @@
 #include "RestSourceFactory.h"
 #include "RestClient.h"
 #include "RestSource.h"
+#include "Rest/Schema/InformationResponseDeserializer.h"
+#include "SourceList.h"
 
 using namespace std::string_literals;
 using namespace std::string_view_literals;
+using namespace std::chrono_literals;
 
 namespace AppInstaller::Repository::Rest
 {
     namespace
     {
+        // How long a cached information response is used before it is retrieved again.
+        // Updating the source also refreshes it.
+        constexpr auto s_InformationCacheLifetime = 24h;
+
+        // Gets the information from the cached response, if it is present and has not expired.
+        std::optional<Schema::IRestClient::Information> TryGetCachedInformation(const SourceDetails& details)
+        {
+            if (details.InformationCache.empty())
+            {
+                return {};
+            }
+
+            auto age = std::chrono::system_clock::now() - details.InformationCacheTime;
+            if (age < 0s || age > s_InformationCacheLifetime)
+            {
+                AICLI_LOG(Repo, Verbose, << "Cached information for source has expired: " << details.Name);
+                return {};
+            }
+
+            try
+            {
+                web::json::value response = web::json::value::parse(utility::conversions::to_string_t(details.InformationCache));
+                return Schema::InformationResponseDeserializer{}.Deserialize(response);
+            }
+            catch (...)
+            {
+                LOG_CAUGHT_EXCEPTION_MSG("Failed to read cached information for source: %hs", details.Name.c_str());
+            }
+
+            return {};
+        }
+
+        // Stores the information response with the source metadata.
+        void SaveInformationCache(const SourceDetails& details) try
+        {
+            SourceList sourceList;
+            auto detailsInternal = sourceList.GetSource(details.Name);
+
+            // Only store it for the source that it was retrieved from.
+            if (detailsInternal && Utility::CaseInsensitiveEquals(detailsInternal->Type, details.Type) && detailsInternal->Arg == details.Arg)
+            {
+                detailsInternal->InformationCache = details.InformationCache;
+                detailsInternal->InformationCacheTime = details.InformationCacheTime;
+                sourceList.SaveMetadata(*detailsInternal);
+            }
+        }
+        CATCH_LOG();
+
+        // Retrieves the information response, updating the cache in the details.
+        Schema::IRestClient::Information RetrieveInformation(SourceDetails& details, std::optional<std::string> customHeader, std::string_view caller, const Schema::HttpClientHelper& httpClientHelper)
+        {
+            web::json::value response = RestClient::GetInformationResponse(details.Arg, std::move(customHeader), caller, httpClientHelper);
+            Schema::IRestClient::Information result = Schema::InformationResponseDeserializer{}.Deserialize(response);
+
+            details.InformationCache = utility::conversions::to_utf8string(response.serialize());
+            details.InformationCacheTime = std::chrono::system_clock::now();
+            SaveInformationCache(details);
+
+            return result;
+        }
+
         struct RestSourceReference : public ISourceReference
         {
             RestSourceReference(const SourceDetails& details) : m_details(details) {}
@@ -31,54 +95,105 @@ namespace AppInstaller::Repository::Rest
             }
 
             // Set custom header. Returns false if custom header is not supported.
+            // The header is kept with the details so that updating the source also sends it.
             bool SetCustomHeader(std::optional<std::string> header) override
             {
-                m_customHeader = header;
+                m_details.CustomHeader = header;
                 return true;
             }
 
             void SetCaller(std::string caller) override
             {
-                m_caller = std::move(caller);
+                m_details.Caller = std::move(caller);
             }
 
             std::shared_ptr<ISource> Open(IProgressCallback&) override
             {
                 Initialize();
-                RestClient restClient = RestClient::Create(m_details.Arg, m_customHeader, m_caller, m_httpClientHelper);
-                return std::make_shared<RestSource>(m_details, m_information, std::move(restClient));
+
+                std::optional<RestClient> restClient;
+
+                try
+                {
+                    restClient.emplace(CreateRestClient());
+                }
+                catch (...)
+                {
+                    if (!m_isRestInformationFromCache)
+                    {
+                        throw;
+                    }
+
+                    // The server may have changed its supported contracts since the information was cached.
+                    LOG_CAUGHT_EXCEPTION_MSG("Cached information was not usable; retrieving it again");
+                    SetRestInformation(RetrieveInformation(m_details, m_details.CustomHeader, m_details.Caller, m_httpClientHelper), false);
+                    restClient.emplace(CreateRestClient());
+                }
+
+                return std::make_shared<RestSource>(m_details, m_information, std::move(restClient).value(), m_isRestInformationFromCache);
             }
 
         private:
+            RestClient CreateRestClient()
+            {
+                try
+                {
+                    return RestClient::CreateFromInformation(m_details.Arg, m_restInformation, m_details.CustomHeader, m_details.Caller);
+                }
+                catch (...)
+                {
+                    // Information that does not negotiate a supported contract must not be reused from the cache.
+                    ClearInformationCache(m_details);
+                    throw;
+                }
+            }
+
             void Initialize()
             {
                 std::call_once(m_initializeFlag,
                     [&]()
                     {
                         m_httpClientHelper.SetPinningConfiguration(m_details.CertificatePinningConfiguration);
-                        RestClient restClient = RestClient::Create(m_details.Arg, m_customHeader, m_caller, m_httpClientHelper);
-
-                        m_details.Identifier = restClient.GetSourceIdentifier();
-
-                        const auto& sourceInformation = restClient.GetSourceInformation();
-                        m_information.UnsupportedPackageMatchFields = sourceInformation.UnsupportedPackageMatchFields;
-                        m_information.RequiredPackageMatchFields = sourceInformation.RequiredPackageMatchFields;
-                        m_information.UnsupportedQueryParameters = sourceInformation.UnsupportedQueryParameters;
-                        m_information.RequiredQueryParameters = sourceInformation.RequiredQueryParameters;
 
-                        m_information.SourceAgreementsIdentifier = sourceInformation.SourceAgreementsIdentifier;
-                        for (auto const& agreement : sourceInformation.SourceAgreements)
+                        // Reuse the previously negotiated information when possible, saving a request to the server.
+                        auto cachedInformation = TryGetCachedInformation(m_details);
+                        if (cachedInformation)
                         {
-                            m_information.SourceAgreements.emplace_back(agreement.Label, agreement.Text, agreement.Url);
+                            AICLI_LOG(Repo, Verbose, << "Using cached information for source: " << m_details.Name);
+                            SetRestInformation(std::move(cachedInformation).value(), true);
+                        }
+                        else
+                        {
+                            SetRestInformation(RetrieveInformation(m_details, m_details.CustomHeader, m_details.Caller, m_httpClientHelper), false);
                         }
                     });
             }
 
+            void SetRestInformation(Schema::IRestClient::Information&& sourceInformation, bool fromCache)
+            {
+                m_restInformation = std::move(sourceInformation);
+                m_isRestInformationFromCache = fromCache;
+
+                m_details.Identifier = m_restInformation.SourceIdentifier;
+
+                m_information = {};
+                m_information.UnsupportedPackageMatchFields = m_restInformation.UnsupportedPackageMatchFields;
+                m_information.RequiredPackageMatchFields = m_restInformation.RequiredPackageMatchFields;
+                m_information.UnsupportedQueryParameters = m_restInformation.UnsupportedQueryParameters;
+                m_information.RequiredQueryParameters = m_restInformation.RequiredQueryParameters;
+
+                m_information.SourceAgreementsIdentifier = m_restInformation.SourceAgreementsIdentifier;
+                for (auto const& agreement : m_restInformation.SourceAgreements)
+                {
+                    m_information.SourceAgreements.emplace_back(agreement.Label, agreement.Text, agreement.Url);
+                }
+            }
+
             SourceDetails m_details;
             Schema::HttpClientHelper m_httpClientHelper;
+            Schema::IRestClient::Information m_restInformation;
+            bool m_isRestInformationFromCache = false;
             SourceInformation m_information;
-            std::optional<std::string> m_customHeader;
-            std::string m_caller;
             std::once_flag m_initializeFlag;
         };
 
@@ -118,6 +233,18 @@ namespace AppInstaller::Repository::Rest
             bool Update(const SourceDetails& details, IProgressCallback&) override final
             {
                 THROW_HR_IF(E_INVALIDARG, !Utility::CaseInsensitiveEquals(details.Type, RestSourceFactory::Type()));
+
+                // Refresh the cached information; a failure here is not fatal as it will be retrieved on open if needed.
+                // The details carry the custom header and caller when the update happens as the source is opened.
+                try
+                {
+                    SourceDetails updatedDetails = details;
+                    Schema::HttpClientHelper httpClientHelper;
+                    httpClientHelper.SetPinningConfiguration(details.CertificatePinningConfiguration);
+                    RetrieveInformation(updatedDetails, details.CustomHeader, details.Caller, httpClientHelper);
+                }
+                CATCH_LOG();
+
                 return true;
             }
 
@@ -133,4 +260,12 @@ namespace AppInstaller::Repository::Rest
     {
         return std::make_unique<RestSourceFactoryImpl>();
     }
+
+    void ClearInformationCache(const SourceDetails& details)
+    {
+        SourceDetails cleared = details;
+        cleared.InformationCache.clear();
+        cleared.InformationCacheTime = {};
+        SaveInformationCache(cleared);
+    }
 }
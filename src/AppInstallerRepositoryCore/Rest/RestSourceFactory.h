@@ -24,4 +24,7 @@ namespace AppInstaller::Repository::Rest
         // Creates a source factory for this type.
         static std::unique_ptr<ISourceFactory> Create();
     };
+
+    // Removes the cached information response of the source, so that it is retrieved again on the next open.
+    void ClearInformationCache(const SourceDetails& details);
 }
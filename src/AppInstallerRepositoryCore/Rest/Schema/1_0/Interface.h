@@ -29,14 +29,21 @@ namespace AppInstaller::Repository::Rest::Schema::V1_0
         IRestClient::SearchResult OptimizedSearch(const SearchRequest& request) const;
         IRestClient::SearchResult SearchInternal(const SearchRequest& request) const;
 
+        // Gets the UTF-8 body of the manifests response for the package; no value if the source returned no content.
+        std::optional<std::string> GetManifestsResponse(const std::string& packageId, const std::map<std::string_view, std::string>& params) const;
+
+        // Gets the package from the manifests response without deserializing any manifests; each version deserializes its manifest on first use.
+        std::optional<Package> GetPackageFromManifests(const std::string& packageId, const std::map<std::string_view, std::string>& params = {}) const;
+
         // Check query params against source information and update if necessary.
         virtual std::map<std::string_view, std::string> GetValidatedQueryParams(const std::map<std::string_view, std::string>& params) const;
 
         // Check search request against source information and get json search body.
         virtual web::json::value GetValidatedSearchBody(const SearchRequest& searchRequest) const;
 
-        virtual SearchResult GetSearchResult(const web::json::value& searchResponseObject) const;
-        virtual std::vector<Manifest::Manifest> GetParsedManifests(const web::json::value& manifestsResponseObject) const;
+        // Parse the UTF-8 response bodies.
+        virtual SearchResponse GetSearchResponse(std::string_view searchResponse) const;
+        virtual std::vector<Manifest::Manifest> GetParsedManifests(std::string_view manifestsResponse) const;
 
         std::unordered_map<utility::string_t, utility::string_t> m_requiredRestApiHeaders;
 
@@ -4,12 +4,20 @@
 #include <winget/Manifest.h>
 #include <cpprest/json.h>
 #include <winget/JsonUtil.h>
+#include <winget/JsonStreamingReader.h>
 
 namespace AppInstaller::Repository::Rest::Schema::V1_0::Json
 {
     // Manifest Deserializer.
+    // The response is read as a stream of UTF-8 JSON; the functions taking cpprest values serialize them and read the result.
     struct ManifestDeserializer
     {
+        // Gets the manifest from the given UTF-8 JSON response body received from a REST request
+        std::vector<Manifest::Manifest> Deserialize(std::string_view response) const;
+
+        // Gets the manifest from the UTF-8 JSON of a single item in the Versions array of a REST response
+        Manifest::Manifest DeserializeVersion(std::string_view versionJson, const std::string& packageId) const;
+
         // Gets the manifest from the given json object received from a REST request
         std::vector<Manifest::Manifest> Deserialize(const web::json::value& responseJsonObject) const;
 
@@ -17,33 +25,57 @@ namespace AppInstaller::Repository::Rest::Schema::V1_0::Json
         std::vector<Manifest::Manifest> DeserializeData(const web::json::value& dataJsonObject) const;
 
         // Deserializes the AppsAndFeaturesEntries node, returning the set of values below it.
-        virtual std::vector<Manifest::AppsAndFeaturesEntry> DeserializeAppsAndFeaturesEntries(const web::json::array& entries) const;
+        std::vector<Manifest::AppsAndFeaturesEntry> DeserializeAppsAndFeaturesEntries(const web::json::array& entries) const;
 
         // Deserializes the locale; requires that the PackageLocale be set to return an object.
-        virtual std::optional<Manifest::ManifestLocalization> DeserializeLocale(const web::json::value& localeJsonObject) const;
+        std::optional<Manifest::ManifestLocalization> DeserializeLocale(const web::json::value& localeJsonObject) const;
 
-        // Deserializes the locale; requires that the PackageLocale be set to return an object.
-        virtual std::optional<Manifest::InstallationMetadataInfo> DeserializeInstallationMetadata(const web::json::value& installationMetadataJsonObject) const;
+        // Deserializes the InstallationMetadata node; returning an object if a proper InstallationMetadata was found.
+        std::optional<Manifest::InstallationMetadataInfo> DeserializeInstallationMetadata(const web::json::value& installationMetadataJsonObject) const;
 
     protected:
+        // The functions below read the value that the reader is positioned at.
+        std::vector<Manifest::Manifest> DeserializeData(AppInstaller::JSON::StreamingReader& reader) const;
+
+        Manifest::Manifest DeserializeVersion(AppInstaller::JSON::StreamingReader& reader, const std::string& packageId) const;
+
+        // If provided, the moniker is read from the locale as well.
+        std::optional<Manifest::ManifestLocalization> DeserializeLocale(AppInstaller::JSON::StreamingReader& reader, std::string* moniker = nullptr) const;
+
+        std::optional<Manifest::ManifestInstaller> DeserializeInstaller(AppInstaller::JSON::StreamingReader& reader) const;
+
+        std::optional<Manifest::DependencyList> DeserializeDependency(AppInstaller::JSON::StreamingReader& reader) const;
+
+        virtual std::vector<Manifest::AppsAndFeaturesEntry> DeserializeAppsAndFeaturesEntries(AppInstaller::JSON::StreamingReader& reader) const;
+
+        virtual std::optional<Manifest::InstallationMetadataInfo> DeserializeInstallationMetadata(AppInstaller::JSON::StreamingReader& reader) const;
+
+        // Reads a field of a locale, other than the PackageLocale, into the localization.
+        virtual void DeserializeLocaleField(AppInstaller::JSON::StreamingReader& reader, std::string_view name, Manifest::ManifestLocalization& manifestLocale) const;
+
+        // Reads a field of an installer, other than the Architecture and InstallerType, into the installer.
+        // Returns false if the value makes the installer invalid.
+        virtual bool DeserializeInstallerField(AppInstaller::JSON::StreamingReader& reader, std::string_view name, Manifest::ManifestInstaller& installer) const;
+
+        // Fills in the installer values that depend on other fields, once all of them have been read.
+        virtual void CompleteInstaller(Manifest::ManifestInstaller& installer) const;
 
         template <Manifest::Localization L>
-        inline void TryParseStringLocaleField(Manifest::ManifestLocalization& manifestLocale, const web::json::value& localeJsonObject, std::string_view localeJsonFieldName) const
+        inline void DeserializeStringLocaleField(Manifest::ManifestLocalization& manifestLocale, AppInstaller::JSON::StreamingReader& reader) const
         {
-            auto value = AppInstaller::JSON::GetRawStringValueFromJsonNode(localeJsonObject, AppInstaller::JSON::GetUtilityString(localeJsonFieldName));
+            auto value = reader.ReadString();
 
             if (AppInstaller::JSON::IsValidNonEmptyStringValue(value))
             {
-                manifestLocale.Add<L>(value.value());
+                manifestLocale.Add<L>(std::move(value).value());
             }
         }
 
-        virtual std::optional<Manifest::ManifestInstaller> DeserializeInstaller(const web::json::value& installerJsonObject) const;
-
-        std::optional<Manifest::DependencyList> DeserializeDependency(const web::json::value& dependenciesJsonObject) const;
-
         virtual Manifest::InstallerTypeEnum ConvertToInstallerType(std::string_view in) const;
 
         std::vector<Manifest::string_t> ConvertToManifestStringArray(const std::vector<std::string>& values) const;
+
+        // Reads an installer return code, which may be written as either a signed or an unsigned 32 bit value.
+        std::optional<int> ReadReturnCode(AppInstaller::JSON::StreamingReader& reader) const;
     };
 }
@@ -83,393 +83,777 @@ namespace AppInstaller::Repository::Rest::Schema::V1_0::Json
         constexpr std::string_view Capabilities = "Capabilities"sv;
         constexpr std::string_view RestrictedCapabilities = "RestrictedCapabilities"sv;
 
-        void TryParseInstallerSwitchField(
+        std::optional<InstallerSwitchType> GetInstallerSwitchType(std::string_view name)
+        {
+            if (name == Silent)
+            {
+                return InstallerSwitchType::Silent;
+            }
+            else if (name == SilentWithProgress)
+            {
+                return InstallerSwitchType::SilentWithProgress;
+            }
+            else if (name == Interactive)
+            {
+                return InstallerSwitchType::Interactive;
+            }
+            else if (name == InstallLocation)
+            {
+                return InstallerSwitchType::InstallLocation;
+            }
+            else if (name == Log)
+            {
+                return InstallerSwitchType::Log;
+            }
+            else if (name == Upgrade)
+            {
+                return InstallerSwitchType::Update;
+            }
+            else if (name == Custom)
+            {
+                return InstallerSwitchType::Custom;
+            }
+
+            return {};
+        }
+
+        void ReadInstallerSwitches(
             std::map<InstallerSwitchType, Utility::NormalizedString>& installerSwitches,
-            InstallerSwitchType switchType,
-            const web::json::value& switchesJsonObject,
-            std::string_view switchJsonFieldName)
+            JSON::StreamingReader& reader)
         {
-            auto value = JSON::GetRawStringValueFromJsonNode(switchesJsonObject, JSON::GetUtilityString(switchJsonFieldName));
+            if (!reader.BeginObject())
+            {
+                return;
+            }
 
-            if (JSON::IsValidNonEmptyStringValue(value))
+            while (auto name = reader.NextMember())
             {
-                installerSwitches[switchType] = value.value();
+                std::optional<InstallerSwitchType> switchType = GetInstallerSwitchType(*name);
+                if (!switchType)
+                {
+                    reader.SkipValue();
+                    continue;
+                }
+
+                auto value = reader.ReadString();
+                if (JSON::IsValidNonEmptyStringValue(value))
+                {
+                    installerSwitches[switchType.value()] = value.value();
+                }
             }
         }
-    }
 
-    std::vector<Manifest::Manifest> ManifestDeserializer::Deserialize(const web::json::value& responseJsonObject) const
-    {
-        if (responseJsonObject.is_null())
+        // Converts any non-result exception from the deserialization into our standard error.
+        template <typename Function>
+        auto ConvertDeserializationErrors(Function&& function)
         {
-            AICLI_LOG(Repo, Error, << "Missing json object.");
+            try
+            {
+                return function();
+            }
+            catch (const wil::ResultException&)
+            {
+                throw;
+            }
+            catch (const std::exception& e)
+            {
+                AICLI_LOG(Repo, Error, << "Error encountered while deserializing manifest. Reason: " << e.what());
+            }
+            catch (...)
+            {
+                AICLI_LOG(Repo, Error, << "Error encountered while deserializing manifest...");
+            }
+
+            // If we make it here, there was an exception above that we didn't throw.
+            // This will convert it into our standard error.
             THROW_HR(APPINSTALLER_CLI_ERROR_RESTSOURCE_INVALID_DATA);
         }
 
-        try
+        // Serializes a cpprest value so that it can be read by the streaming implementation.
+        std::string SerializeJsonValue(const web::json::value& value)
+        {
+            return Utility::ConvertToUTF8(value.serialize());
+        }
+    }
+
+    std::vector<Manifest::Manifest> ManifestDeserializer::Deserialize(std::string_view response) const
+    {
+        return ConvertDeserializationErrors([&]()
         {
-            std::optional<std::reference_wrapper<const web::json::value>> manifestObject =
-                JSON::GetJsonValueFromNode(responseJsonObject, JSON::GetUtilityString(Data));
+            JSON::StreamingReader reader{ response };
+
+            if (reader.IsAtEnd() || reader.PeekType() != JSON::ValueType::Object)
+            {
+                AICLI_LOG(Repo, Error, << "Missing json object.");
+                THROW_HR(APPINSTALLER_CLI_ERROR_RESTSOURCE_INVALID_DATA);
+            }
+
+            std::vector<Manifest::Manifest> result;
+            bool foundData = false;
+            reader.BeginObject();
+
+            while (auto name = reader.NextMember())
+            {
+                if (*name == Data && reader.PeekType() != JSON::ValueType::Null)
+                {
+                    result = DeserializeData(reader);
+                    foundData = true;
+                }
+                else
+                {
+                    reader.SkipValue();
+                }
+            }
 
-            if (!manifestObject || manifestObject.value().get().is_null())
+            reader.EndDocument();
+
+            if (!foundData)
             {
                 AICLI_LOG(Repo, Verbose, << "No manifest results returned.");
-                return {};
             }
 
-            return DeserializeData(manifestObject.value());
-        }
-        catch (const wil::ResultException&)
-        {
-            throw;
-        }
-        catch (const std::exception& e)
+            return result;
+        });
+    }
+
+    Manifest::Manifest ManifestDeserializer::DeserializeVersion(std::string_view versionJson, const std::string& packageId) const
+    {
+        return ConvertDeserializationErrors([&]()
         {
-            AICLI_LOG(Repo, Error, << "Error encountered while deserializing manifest. Reason: " << e.what());
-        }
-        catch (...)
+            JSON::StreamingReader reader{ versionJson };
+            Manifest::Manifest result = DeserializeVersion(reader, packageId);
+            reader.EndDocument();
+            return result;
+        });
+    }
+
+    std::vector<Manifest::Manifest> ManifestDeserializer::Deserialize(const web::json::value& responseJsonObject) const
+    {
+        if (responseJsonObject.is_null())
         {
-            AICLI_LOG(Repo, Error, << "Error encountered while deserializing manifest...");
+            AICLI_LOG(Repo, Error, << "Missing json object.");
+            THROW_HR(APPINSTALLER_CLI_ERROR_RESTSOURCE_INVALID_DATA);
         }
 
-        // If we make it here, there was an exception above that we didn't throw.
-        // This will convert it into our standard error.
-        THROW_HR(APPINSTALLER_CLI_ERROR_RESTSOURCE_INVALID_DATA);
+        return Deserialize(SerializeJsonValue(responseJsonObject));
     }
 
     std::vector<Manifest::Manifest> ManifestDeserializer::DeserializeData(const web::json::value& dataJsonObject) const
     {
         THROW_HR_IF(E_INVALIDARG, dataJsonObject.is_null());
 
-        std::vector<Manifest::Manifest> manifests;
+        std::string data = SerializeJsonValue(dataJsonObject);
+        JSON::StreamingReader reader{ data };
+        auto result = DeserializeData(reader);
+        reader.EndDocument();
+        return result;
+    }
 
-        std::optional<std::string> id = JSON::GetRawStringValueFromJsonNode(dataJsonObject, JSON::GetUtilityString(PackageIdentifier));
-        if (!JSON::IsValidNonEmptyStringValue(id))
+    std::vector<Manifest::AppsAndFeaturesEntry> ManifestDeserializer::DeserializeAppsAndFeaturesEntries(const web::json::array& entries) const
+    {
+        std::string data = SerializeJsonValue(web::json::value::array(std::vector<web::json::value>{ entries.begin(), entries.end() }));
+        JSON::StreamingReader reader{ data };
+        auto result = DeserializeAppsAndFeaturesEntries(reader);
+        reader.EndDocument();
+        return result;
+    }
+
+    std::optional<Manifest::ManifestLocalization> ManifestDeserializer::DeserializeLocale(const web::json::value& localeJsonObject) const
+    {
+        if (localeJsonObject.is_null())
         {
-            AICLI_LOG(Repo, Error, << "Missing package identifier.");
-            THROW_HR(APPINSTALLER_CLI_ERROR_RESTSOURCE_INVALID_DATA);
+            return {};
         }
 
-        std::optional<std::reference_wrapper<const web::json::array>> versions = JSON::GetRawJsonArrayFromJsonNode(dataJsonObject, JSON::GetUtilityString(Versions));
-        if (!versions || versions.value().get().size() == 0)
+        std::string data = SerializeJsonValue(localeJsonObject);
+        JSON::StreamingReader reader{ data };
+        auto result = DeserializeLocale(reader);
+        reader.EndDocument();
+        return result;
+    }
+
+    std::optional<Manifest::InstallationMetadataInfo> ManifestDeserializer::DeserializeInstallationMetadata(const web::json::value& installationMetadataJsonObject) const
+    {
+        std::string data = SerializeJsonValue(installationMetadataJsonObject);
+        JSON::StreamingReader reader{ data };
+        auto result = DeserializeInstallationMetadata(reader);
+        reader.EndDocument();
+        return result;
+    }
+
+    std::vector<Manifest::Manifest> ManifestDeserializer::DeserializeData(JSON::StreamingReader& reader) const
+    {
+        if (!reader.BeginObject())
         {
-            AICLI_LOG(Repo, Error, << "Missing versions in package: " << id.value());
+            AICLI_LOG(Repo, Error, << "Missing package identifier.");
             THROW_HR(APPINSTALLER_CLI_ERROR_RESTSOURCE_INVALID_DATA);
         }
 
-        for (auto& versionItem : versions.value().get())
-        {
-            Manifest::Manifest manifest;
-            manifest.Id = id.value();
+        std::optional<std::string> id;
+        std::string_view deferredVersions;
+        std::vector<Manifest::Manifest> manifests;
 
-            std::optional<std::string> packageVersion = JSON::GetRawStringValueFromJsonNode(versionItem, JSON::GetUtilityString(PackageVersion));
-            if (!JSON::IsValidNonEmptyStringValue(packageVersion))
+        auto readVersions = [&](JSON::StreamingReader& versionsReader)
+        {
+            if (versionsReader.BeginArray())
             {
-                AICLI_LOG(Repo, Error, << "Missing package version in package: " << manifest.Id);
-                THROW_HR(APPINSTALLER_CLI_ERROR_RESTSOURCE_INVALID_DATA);
+                while (versionsReader.NextElement())
+                {
+                    manifests.emplace_back(DeserializeVersion(versionsReader, id.value()));
+                }
             }
-            manifest.Version = std::move(packageVersion.value());
-
-            manifest.Channel = JSON::GetRawStringValueFromJsonNode(versionItem, JSON::GetUtilityString(Channel)).value_or("");
+        };
 
-            // Default locale
-            std::optional<std::reference_wrapper<const web::json::value>> defaultLocale =
-                JSON::GetJsonValueFromNode(versionItem, JSON::GetUtilityString(DefaultLocale));
-            if (!defaultLocale)
+        while (auto name = reader.NextMember())
+        {
+            if (*name == PackageIdentifier)
             {
-                AICLI_LOG(Repo, Error, << "Missing default locale in package: " << manifest.Id);
-                THROW_HR(APPINSTALLER_CLI_ERROR_RESTSOURCE_INVALID_DATA);
+                id = reader.ReadString();
+                if (!JSON::IsValidNonEmptyStringValue(id))
+                {
+                    AICLI_LOG(Repo, Error, << "Missing package identifier.");
+                    THROW_HR(APPINSTALLER_CLI_ERROR_RESTSOURCE_INVALID_DATA);
+                }
             }
-            else
+            else if (*name == Versions)
             {
-                std::optional<Manifest::ManifestLocalization> defaultLocaleObject = DeserializeLocale(defaultLocale.value().get());
-                if (!defaultLocaleObject)
+                if (id)
                 {
-                    AICLI_LOG(Repo, Error, << "Missing default locale in package: " << manifest.Id);
-                    THROW_HR(APPINSTALLER_CLI_ERROR_RESTSOURCE_INVALID_DATA);
+                    readVersions(reader);
                 }
-
-                if (!defaultLocaleObject.value().Contains(Manifest::Localization::PackageName) ||
-                    !defaultLocaleObject.value().Contains(Manifest::Localization::Publisher) ||
-                    !defaultLocaleObject.value().Contains(Manifest::Localization::ShortDescription))
+                else
                 {
-                    AICLI_LOG(Repo, Error, << "Missing PackageName, Publisher or ShortDescription in default locale: " << manifest.Id);
-                    THROW_HR(APPINSTALLER_CLI_ERROR_RESTSOURCE_INVALID_DATA);
+                    // The versions are read once the identifier is known, as their errors are reported against it.
+                    deferredVersions = reader.SkipValue();
                 }
-
-                manifest.DefaultLocalization = std::move(defaultLocaleObject.value());
-
-                // Moniker is in Default locale
-                manifest.Moniker = JSON::GetRawStringValueFromJsonNode(defaultLocale.value().get(), JSON::GetUtilityString(Moniker)).value_or("");
             }
-
-            // Installers
-            std::optional<std::reference_wrapper<const web::json::array>> installers = JSON::GetRawJsonArrayFromJsonNode(versionItem, JSON::GetUtilityString(Installers));
-            if (!installers || installers.value().get().size() == 0)
+            else
             {
-                AICLI_LOG(Repo, Error, << "Missing installers in package: " << manifest.Id);
-                THROW_HR(APPINSTALLER_CLI_ERROR_RESTSOURCE_INVALID_DATA);
+                reader.SkipValue();
             }
+        }
+
+        if (!JSON::IsValidNonEmptyStringValue(id))
+        {
+            AICLI_LOG(Repo, Error, << "Missing package identifier.");
+            THROW_HR(APPINSTALLER_CLI_ERROR_RESTSOURCE_INVALID_DATA);
+        }
+
+        if (!deferredVersions.empty())
+        {
+            JSON::StreamingReader versionsReader{ deferredVersions };
+            readVersions(versionsReader);
+        }
 
-            for (auto& installer : installers.value().get())
+        if (manifests.empty())
+        {
+            AICLI_LOG(Repo, Error, << "Missing versions in package: " << id.value());
+            THROW_HR(APPINSTALLER_CLI_ERROR_RESTSOURCE_INVALID_DATA);
+        }
+
+        return manifests;
+    }
+
+    Manifest::Manifest ManifestDeserializer::DeserializeVersion(JSON::StreamingReader& reader, const std::string& packageId) const
+    {
+        Manifest::Manifest manifest;
+        manifest.Id = packageId;
+
+        bool foundDefaultLocale = false;
+        bool foundInstallers = false;
+
+        if (reader.BeginObject())
+        {
+            while (auto name = reader.NextMember())
             {
-                std::optional<Manifest::ManifestInstaller> installerObject = DeserializeInstaller(installer);
-                if (installerObject)
+                if (*name == PackageVersion)
                 {
-                    manifest.Installers.emplace_back(std::move(installerObject.value()));
+                    manifest.Version = reader.ReadString().value_or("");
                 }
-            }
+                else if (*name == Channel)
+                {
+                    manifest.Channel = reader.ReadString().value_or("");
+                }
+                else if (*name == DefaultLocale)
+                {
+                    // Moniker is in Default locale
+                    std::optional<Manifest::ManifestLocalization> defaultLocaleObject = DeserializeLocale(reader, &manifest.Moniker);
+                    if (!defaultLocaleObject)
+                    {
+                        AICLI_LOG(Repo, Error, << "Missing default locale in package: " << manifest.Id);
+                        THROW_HR(APPINSTALLER_CLI_ERROR_RESTSOURCE_INVALID_DATA);
+                    }
 
-            if (manifest.Installers.size() == 0)
-            {
-                AICLI_LOG(Repo, Error, << "Missing valid installers in package: " << manifest.Id);
-                THROW_HR(APPINSTALLER_CLI_ERROR_RESTSOURCE_INVALID_DATA);
-            }
+                    if (!defaultLocaleObject.value().Contains(Manifest::Localization::PackageName) ||
+                        !defaultLocaleObject.value().Contains(Manifest::Localization::Publisher) ||
+                        !defaultLocaleObject.value().Contains(Manifest::Localization::ShortDescription))
+                    {
+                        AICLI_LOG(Repo, Error, << "Missing PackageName, Publisher or ShortDescription in default locale: " << manifest.Id);
+                        THROW_HR(APPINSTALLER_CLI_ERROR_RESTSOURCE_INVALID_DATA);
+                    }
 
-            // Other locales
-            std::optional<std::reference_wrapper<const web::json::array>> locales = JSON::GetRawJsonArrayFromJsonNode(versionItem, JSON::GetUtilityString(Locales));
-            if (locales)
-            {
-                for (auto& locale : locales.value().get())
+                    manifest.DefaultLocalization = std::move(defaultLocaleObject.value());
+                    foundDefaultLocale = true;
+                }
+                else if (*name == Installers)
                 {
-                    std::optional<Manifest::ManifestLocalization> localeObject = DeserializeLocale(locale);
-                    if (localeObject)
+                    foundInstallers = reader.BeginArray();
+                    if (foundInstallers)
                     {
-                        manifest.Localizations.emplace_back(std::move(localeObject.value()));
+                        while (reader.NextElement())
+                        {
+                            std::optional<Manifest::ManifestInstaller> installerObject = DeserializeInstaller(reader);
+                            if (installerObject)
+                            {
+                                manifest.Installers.emplace_back(std::move(installerObject.value()));
+                            }
+                        }
                     }
                 }
+                else if (*name == Locales)
+                {
+                    if (reader.BeginArray())
+                    {
+                        while (reader.NextElement())
+                        {
+                            std::optional<Manifest::ManifestLocalization> localeObject = DeserializeLocale(reader);
+                            if (localeObject)
+                            {
+                                manifest.Localizations.emplace_back(std::move(localeObject.value()));
+                            }
+                        }
+                    }
+                }
+                else
+                {
+                    reader.SkipValue();
+                }
             }
+        }
 
-            manifests.emplace_back(std::move(manifest));
+        if (manifest.Version.empty())
+        {
+            AICLI_LOG(Repo, Error, << "Missing package version in package: " << manifest.Id);
+            THROW_HR(APPINSTALLER_CLI_ERROR_RESTSOURCE_INVALID_DATA);
         }
 
-        return manifests;
+        if (!foundDefaultLocale)
+        {
+            AICLI_LOG(Repo, Error, << "Missing default locale in package: " << manifest.Id);
+            THROW_HR(APPINSTALLER_CLI_ERROR_RESTSOURCE_INVALID_DATA);
+        }
+
+        if (!foundInstallers)
+        {
+            AICLI_LOG(Repo, Error, << "Missing installers in package: " << manifest.Id);
+            THROW_HR(APPINSTALLER_CLI_ERROR_RESTSOURCE_INVALID_DATA);
+        }
+
+        if (manifest.Installers.size() == 0)
+        {
+            AICLI_LOG(Repo, Error, << "Missing valid installers in package: " << manifest.Id);
+            THROW_HR(APPINSTALLER_CLI_ERROR_RESTSOURCE_INVALID_DATA);
+        }
+
+        return manifest;
     }
 
-    std::vector<Manifest::AppsAndFeaturesEntry> ManifestDeserializer::DeserializeAppsAndFeaturesEntries(const web::json::array&) const
+    std::vector<Manifest::AppsAndFeaturesEntry> ManifestDeserializer::DeserializeAppsAndFeaturesEntries(JSON::StreamingReader& reader) const
     {
+        reader.SkipValue();
         return {};
     }
 
-    std::optional<Manifest::InstallationMetadataInfo> ManifestDeserializer::DeserializeInstallationMetadata(const web::json::value&) const
+    std::optional<Manifest::InstallationMetadataInfo> ManifestDeserializer::DeserializeInstallationMetadata(JSON::StreamingReader& reader) const
     {
+        reader.SkipValue();
         return {};
     }
 
-    std::optional<Manifest::ManifestLocalization> ManifestDeserializer::DeserializeLocale(const web::json::value& localeJsonObject) const
+    std::optional<Manifest::ManifestLocalization> ManifestDeserializer::DeserializeLocale(JSON::StreamingReader& reader, std::string* moniker) const
     {
-        if (localeJsonObject.is_null())
+        if (!reader.BeginObject())
         {
             return {};
         }
 
         Manifest::ManifestLocalization locale;
-        std::optional<std::string> packageLocale = JSON::GetRawStringValueFromJsonNode(localeJsonObject, JSON::GetUtilityString(PackageLocale));
-        if (!JSON::IsValidNonEmptyStringValue(packageLocale))
+
+        while (auto name = reader.NextMember())
+        {
+            if (*name == PackageLocale)
+            {
+                locale.Locale = reader.ReadString().value_or("");
+            }
+            else if (moniker && *name == Moniker)
+            {
+                *moniker = reader.ReadString().value_or("");
+            }
+            else
+            {
+                DeserializeLocaleField(reader, *name, locale);
+            }
+        }
+
+        if (locale.Locale.empty())
         {
             AICLI_LOG(Repo, Error, << "Missing package locale.");
             return {};
         }
-        locale.Locale = std::move(packageLocale.value());
 
-        TryParseStringLocaleField<Manifest::Localization::PackageName>(locale, localeJsonObject, PackageName);
-        TryParseStringLocaleField<Manifest::Localization::Publisher>(locale, localeJsonObject, Publisher);
-        TryParseStringLocaleField<Manifest::Localization::ShortDescription>(locale, localeJsonObject, ShortDescription);
-        TryParseStringLocaleField<Manifest::Localization::PublisherUrl>(locale, localeJsonObject, PublisherUrl);
-        TryParseStringLocaleField<Manifest::Localization::PublisherSupportUrl>(locale, localeJsonObject, PublisherSupportUrl);
-        TryParseStringLocaleField<Manifest::Localization::PrivacyUrl>(locale, localeJsonObject, PrivacyUrl);
-        TryParseStringLocaleField<Manifest::Localization::Author>(locale, localeJsonObject, Author);
-        TryParseStringLocaleField<Manifest::Localization::PackageUrl>(locale, localeJsonObject, PackageUrl);
-        TryParseStringLocaleField<Manifest::Localization::License>(locale, localeJsonObject, License);
-        TryParseStringLocaleField<Manifest::Localization::LicenseUrl>(locale, localeJsonObject, LicenseUrl);
-        TryParseStringLocaleField<Manifest::Localization::Copyright>(locale, localeJsonObject, Copyright);
-        TryParseStringLocaleField<Manifest::Localization::CopyrightUrl>(locale, localeJsonObject, CopyrightUrl);
-        TryParseStringLocaleField<Manifest::Localization::Description>(locale, localeJsonObject, Description);
+        return locale;
+    }
 
-        auto tags = ConvertToManifestStringArray(JSON::GetRawStringArrayFromJsonNode(localeJsonObject, JSON::GetUtilityString(Tags)));
-        if (!tags.empty())
+    void ManifestDeserializer::DeserializeLocaleField(JSON::StreamingReader& reader, std::string_view name, Manifest::ManifestLocalization& locale) const
+    {
+        if (name == PackageName)
         {
-            locale.Add<AppInstaller::Manifest::Localization::Tags>(tags);
+            DeserializeStringLocaleField<Manifest::Localization::PackageName>(locale, reader);
+        }
+        else if (name == Publisher)
+        {
+            DeserializeStringLocaleField<Manifest::Localization::Publisher>(locale, reader);
+        }
+        else if (name == ShortDescription)
+        {
+            DeserializeStringLocaleField<Manifest::Localization::ShortDescription>(locale, reader);
+        }
+        else if (name == PublisherUrl)
+        {
+            DeserializeStringLocaleField<Manifest::Localization::PublisherUrl>(locale, reader);
+        }
+        else if (name == PublisherSupportUrl)
+        {
+            DeserializeStringLocaleField<Manifest::Localization::PublisherSupportUrl>(locale, reader);
+        }
+        else if (name == PrivacyUrl)
+        {
+            DeserializeStringLocaleField<Manifest::Localization::PrivacyUrl>(locale, reader);
+        }
+        else if (name == Author)
+        {
+            DeserializeStringLocaleField<Manifest::Localization::Author>(locale, reader);
+        }
+        else if (name == PackageUrl)
+        {
+            DeserializeStringLocaleField<Manifest::Localization::PackageUrl>(locale, reader);
+        }
+        else if (name == License)
+        {
+            DeserializeStringLocaleField<Manifest::Localization::License>(locale, reader);
+        }
+        else if (name == LicenseUrl)
+        {
+            DeserializeStringLocaleField<Manifest::Localization::LicenseUrl>(locale, reader);
+        }
+        else if (name == Copyright)
+        {
+            DeserializeStringLocaleField<Manifest::Localization::Copyright>(locale, reader);
+        }
+        else if (name == CopyrightUrl)
+        {
+            DeserializeStringLocaleField<Manifest::Localization::CopyrightUrl>(locale, reader);
+        }
+        else if (name == Description)
+        {
+            DeserializeStringLocaleField<Manifest::Localization::Description>(locale, reader);
+        }
+        else if (name == Tags)
+        {
+            auto tags = ConvertToManifestStringArray(reader.ReadStringArray());
+            if (!tags.empty())
+            {
+                locale.Add<AppInstaller::Manifest::Localization::Tags>(std::move(tags));
+            }
+        }
+        else
+        {
+            reader.SkipValue();
         }
-
-        return locale;
     }
 
-    std::optional<Manifest::ManifestInstaller> ManifestDeserializer::DeserializeInstaller(const web::json::value& installerJsonObject) const
+    std::optional<Manifest::ManifestInstaller> ManifestDeserializer::DeserializeInstaller(JSON::StreamingReader& reader) const
     {
-        if (installerJsonObject.is_null())
+        if (!reader.BeginObject())
         {
             return {};
         }
 
         Manifest::ManifestInstaller installer;
+        bool foundArchitecture = false;
+        bool foundInstallerType = false;
+        bool isValid = true;
 
-        installer.Url = JSON::GetRawStringValueFromJsonNode(installerJsonObject, JSON::GetUtilityString(InstallerUrl)).value_or("");
-
-        std::optional<std::string> sha256 = JSON::GetRawStringValueFromJsonNode(installerJsonObject, JSON::GetUtilityString(InstallerSha256));
-        if (JSON::IsValidNonEmptyStringValue(sha256))
+        // All members are consumed even once the installer is known to be invalid, leaving the reader after the object.
+        while (auto name = reader.NextMember())
         {
-            installer.Sha256 = Utility::SHA256::ConvertToBytes(sha256.value());
+            if (*name == Architecture)
+            {
+                std::optional<std::string> arch = reader.ReadString();
+                foundArchitecture = JSON::IsValidNonEmptyStringValue(arch);
+                if (foundArchitecture)
+                {
+                    installer.Arch = Utility::ConvertToArchitectureEnum(arch.value());
+                }
+            }
+            else if (*name == InstallerType)
+            {
+                std::optional<std::string> installerType = reader.ReadString();
+                foundInstallerType = JSON::IsValidNonEmptyStringValue(installerType);
+                if (foundInstallerType)
+                {
+                    installer.BaseInstallerType = ConvertToInstallerType(installerType.value());
+                }
+            }
+            else if (isValid)
+            {
+                isValid = DeserializeInstallerField(reader, *name, installer);
+            }
+            else
+            {
+                reader.SkipValue();
+            }
         }
 
-        std::optional<std::string> arch = JSON::GetRawStringValueFromJsonNode(installerJsonObject, JSON::GetUtilityString(Architecture));
-        if (!JSON::IsValidNonEmptyStringValue(arch))
+        if (!foundArchitecture)
         {
             AICLI_LOG(Repo, Error, << "Missing installer architecture.");
             return {};
         }
-        installer.Arch = Utility::ConvertToArchitectureEnum(arch.value());
 
-        std::optional<std::string> installerType = JSON::GetRawStringValueFromJsonNode(installerJsonObject, JSON::GetUtilityString(InstallerType));
-        if (!JSON::IsValidNonEmptyStringValue(installerType))
+        if (!foundInstallerType)
         {
             AICLI_LOG(Repo, Error, << "Missing installer type.");
             return {};
         }
-        installer.BaseInstallerType = ConvertToInstallerType(installerType.value());
-        installer.Locale = JSON::GetRawStringValueFromJsonNode(installerJsonObject, JSON::GetUtilityString(InstallerLocale)).value_or("");
 
-        // platform
-        std::optional<std::reference_wrapper<const web::json::array>> platforms = JSON::GetRawJsonArrayFromJsonNode(installerJsonObject, JSON::GetUtilityString(Platform));
-        if (platforms)
+        if (!isValid)
         {
-            for (auto& platform : platforms.value().get())
+            return {};
+        }
+
+        CompleteInstaller(installer);
+        return installer;
+    }
+
+    bool ManifestDeserializer::DeserializeInstallerField(JSON::StreamingReader& reader, std::string_view name, Manifest::ManifestInstaller& installer) const
+    {
+        if (name == InstallerUrl)
+        {
+            installer.Url = reader.ReadString().value_or("");
+        }
+        else if (name == InstallerSha256)
+        {
+            std::optional<std::string> sha256 = reader.ReadString();
+            if (JSON::IsValidNonEmptyStringValue(sha256))
             {
-                std::optional<std::string> platformValue = JSON::GetRawStringValueFromJsonValue(platform);
-                if (platformValue)
-                {
-                    installer.Platform.emplace_back(Manifest::ConvertToPlatformEnum(platformValue.value()));
-                }
+                installer.Sha256 = Utility::SHA256::ConvertToBytes(sha256.value());
             }
         }
-
-        installer.MinOSVersion = JSON::GetRawStringValueFromJsonNode(installerJsonObject, JSON::GetUtilityString(MinimumOSVersion)).value_or("");
-        std::optional<std::string> scope = JSON::GetRawStringValueFromJsonNode(installerJsonObject, JSON::GetUtilityString(Scope));
-        if (scope)
+        else if (name == InstallerLocale)
         {
-            installer.Scope = Manifest::ConvertToScopeEnum(scope.value());
+            installer.Locale = reader.ReadString().value_or("");
         }
-
-        std::optional<std::string> signatureSha256 = JSON::GetRawStringValueFromJsonNode(installerJsonObject, JSON::GetUtilityString(SignatureSha256));
-        if (signatureSha256)
+        else if (name == Platform)
         {
-            installer.SignatureSha256 = Utility::SHA256::ConvertToBytes(signatureSha256.value());
+            for (const auto& platform : reader.ReadStringArray())
+            {
+                installer.Platform.emplace_back(Manifest::ConvertToPlatformEnum(platform));
+            }
         }
-
-        // Install modes
-        std::optional<std::reference_wrapper<const web::json::array>> installModes = JSON::GetRawJsonArrayFromJsonNode(installerJsonObject, JSON::GetUtilityString(InstallModes));
-        if (installModes)
+        else if (name == MinimumOSVersion)
+        {
+            installer.MinOSVersion = reader.ReadString().value_or("");
+        }
+        else if (name == Scope)
         {
-            for (auto& mode : installModes.value().get())
+            std::optional<std::string> scope = reader.ReadString();
+            if (scope)
             {
-                std::optional<std::string> modeObject = JSON::GetRawStringValueFromJsonValue(mode);
-                if (modeObject)
-                {
-                    installer.InstallModes.emplace_back(Manifest::ConvertToInstallModeEnum(modeObject.value()));
-                }
+                installer.Scope = Manifest::ConvertToScopeEnum(scope.value());
             }
         }
-
-        // Installer Switches
-        installer.Switches = Manifest::GetDefaultKnownSwitches(installer.EffectiveInstallerType());
-        std::optional<std::reference_wrapper<const web::json::value>> switches =
-            JSON::GetJsonValueFromNode(installerJsonObject, JSON::GetUtilityString(InstallerSwitches));
-        if (switches)
+        else if (name == SignatureSha256)
         {
-            const auto& installerSwitches = switches.value().get();
-            TryParseInstallerSwitchField(installer.Switches, InstallerSwitchType::Silent, installerSwitches, Silent);
-            TryParseInstallerSwitchField(installer.Switches, InstallerSwitchType::SilentWithProgress, installerSwitches, SilentWithProgress);
-            TryParseInstallerSwitchField(installer.Switches, InstallerSwitchType::Interactive, installerSwitches, Interactive);
-            TryParseInstallerSwitchField(installer.Switches, InstallerSwitchType::InstallLocation, installerSwitches, InstallLocation);
-            TryParseInstallerSwitchField(installer.Switches, InstallerSwitchType::Log, installerSwitches, Log);
-            TryParseInstallerSwitchField(installer.Switches, InstallerSwitchType::Update, installerSwitches, Upgrade);
-            TryParseInstallerSwitchField(installer.Switches, InstallerSwitchType::Custom, installerSwitches, Custom);
+            std::optional<std::string> signatureSha256 = reader.ReadString();
+            if (signatureSha256)
+            {
+                installer.SignatureSha256 = Utility::SHA256::ConvertToBytes(signatureSha256.value());
+            }
         }
-
-        // Installer SuccessCodes
-        std::optional<std::reference_wrapper<const web::json::array>> installSuccessCodes = JSON::GetRawJsonArrayFromJsonNode(installerJsonObject, JSON::GetUtilityString(InstallerSuccessCodes));
-        if (installSuccessCodes)
+        else if (name == InstallModes)
+        {
+            for (const auto& mode : reader.ReadStringArray())
+            {
+                installer.InstallModes.emplace_back(Manifest::ConvertToInstallModeEnum(mode));
+            }
+        }
+        else if (name == InstallerSwitches)
+        {
+            ReadInstallerSwitches(installer.Switches, reader);
+        }
+        else if (name == InstallerSuccessCodes)
         {
-            for (auto& code : installSuccessCodes.value().get())
+            if (reader.BeginArray())
             {
-                std::optional<int> codeValue = JSON::GetRawIntValueFromJsonValue(code);
-                if (codeValue)
+                while (reader.NextElement())
                 {
-                    installer.InstallerSuccessCodes.emplace_back(std::move(codeValue.value()));
+                    std::optional<int> codeValue = ReadReturnCode(reader);
+                    if (codeValue)
+                    {
+                        installer.InstallerSuccessCodes.emplace_back(codeValue.value());
+                    }
                 }
             }
         }
-
-        std::optional<std::string> updateBehavior = JSON::GetRawStringValueFromJsonNode(installerJsonObject, JSON::GetUtilityString(UpgradeBehavior));
-        if (updateBehavior)
+        else if (name == UpgradeBehavior)
         {
-            installer.UpdateBehavior = Manifest::ConvertToUpdateBehaviorEnum(updateBehavior.value());
+            std::optional<std::string> updateBehavior = reader.ReadString();
+            if (updateBehavior)
+            {
+                installer.UpdateBehavior = Manifest::ConvertToUpdateBehaviorEnum(updateBehavior.value());
+            }
         }
-
-        installer.Commands = ConvertToManifestStringArray(JSON::GetRawStringArrayFromJsonNode(installerJsonObject, JSON::GetUtilityString(Commands)));
-        installer.Protocols = ConvertToManifestStringArray(JSON::GetRawStringArrayFromJsonNode(installerJsonObject, JSON::GetUtilityString(Protocols)));
-        installer.FileExtensions = ConvertToManifestStringArray(JSON::GetRawStringArrayFromJsonNode(installerJsonObject, JSON::GetUtilityString(FileExtensions)));
-
-        // Dependencies
-        std::optional<std::reference_wrapper<const web::json::value>> dependenciesObject =
-            JSON::GetJsonValueFromNode(installerJsonObject, JSON::GetUtilityString(Dependencies));
-        if (dependenciesObject)
+        else if (name == Commands)
+        {
+            installer.Commands = ConvertToManifestStringArray(reader.ReadStringArray());
+        }
+        else if (name == Protocols)
         {
-            std::optional<Manifest::DependencyList> dependencyList = DeserializeDependency(dependenciesObject.value().get());
+            installer.Protocols = ConvertToManifestStringArray(reader.ReadStringArray());
+        }
+        else if (name == FileExtensions)
+        {
+            installer.FileExtensions = ConvertToManifestStringArray(reader.ReadStringArray());
+        }
+        else if (name == Dependencies)
+        {
+            std::optional<Manifest::DependencyList> dependencyList = DeserializeDependency(reader);
             if (dependencyList)
             {
                 installer.Dependencies = std::move(dependencyList.value());
             }
         }
+        else if (name == PackageFamilyName)
+        {
+            installer.PackageFamilyName = reader.ReadString().value_or("");
+        }
+        else if (name == ProductCode)
+        {
+            installer.ProductCode = reader.ReadString().value_or("");
+        }
+        else if (name == Capabilities)
+        {
+            installer.Capabilities = ConvertToManifestStringArray(reader.ReadStringArray());
+        }
+        else if (name == RestrictedCapabilities)
+        {
+            installer.RestrictedCapabilities = ConvertToManifestStringArray(reader.ReadStringArray());
+        }
+        else
+        {
+            reader.SkipValue();
+        }
 
-        installer.PackageFamilyName = JSON::GetRawStringValueFromJsonNode(installerJsonObject, JSON::GetUtilityString(PackageFamilyName)).value_or("");
-        installer.ProductCode = JSON::GetRawStringValueFromJsonNode(installerJsonObject, JSON::GetUtilityString(ProductCode)).value_or("");
-        installer.Capabilities = ConvertToManifestStringArray(JSON::GetRawStringArrayFromJsonNode(installerJsonObject, JSON::GetUtilityString(Capabilities)));
-        installer.RestrictedCapabilities = ConvertToManifestStringArray(JSON::GetRawStringArrayFromJsonNode(installerJsonObject, JSON::GetUtilityString(RestrictedCapabilities)));
+        return true;
+    }
 
-        return installer;
+    void ManifestDeserializer::CompleteInstaller(Manifest::ManifestInstaller& installer) const
+    {
+        // Installer switches that were not provided use the known defaults for the installer type
+        for (auto&& defaultSwitch : Manifest::GetDefaultKnownSwitches(installer.EffectiveInstallerType()))
+        {
+            installer.Switches.try_emplace(defaultSwitch.first, std::move(defaultSwitch.second));
+        }
     }
 
-    std::optional<Manifest::DependencyList> ManifestDeserializer::DeserializeDependency(const web::json::value& dependenciesObject) const
+    std::optional<Manifest::DependencyList> ManifestDeserializer::DeserializeDependency(JSON::StreamingReader& reader) const
     {
-        if (dependenciesObject.is_null())
+        if (!reader.BeginObject())
         {
             return {};
         }
 
+        std::vector<std::string> wfIds;
+        std::vector<std::string> wlIds;
+        std::vector<std::string> extIds;
+        std::vector<Dependency> packageDependencies;
+
+        while (auto name = reader.NextMember())
+        {
+            if (*name == WindowsFeatures)
+            {
+                wfIds = reader.ReadStringArray();
+            }
+            else if (*name == WindowsLibraries)
+            {
+                wlIds = reader.ReadStringArray();
+            }
+            else if (*name == ExternalDependencies)
+            {
+                extIds = reader.ReadStringArray();
+            }
+            else if (*name == PackageDependencies && reader.BeginArray())
+            {
+                while (reader.NextElement())
+                {
+                    if (!reader.BeginObject())
+                    {
+                        continue;
+                    }
+
+                    std::optional<std::string> id;
+                    std::string minimumVersion;
+
+                    while (auto dependencyName = reader.NextMember())
+                    {
+                        if (*dependencyName == PackageIdentifier)
+                        {
+                            id = reader.ReadString();
+                        }
+                        else if (*dependencyName == MinimumVersion)
+                        {
+                            minimumVersion = reader.ReadString().value_or("");
+                        }
+                        else
+                        {
+                            reader.SkipValue();
+                        }
+                    }
+
+                    if (id)
+                    {
+                        packageDependencies.emplace_back(DependencyType::Package, std::move(id.value()), std::move(minimumVersion));
+                    }
+                }
+            }
+            else if (*name != PackageDependencies)
+            {
+                reader.SkipValue();
+            }
+        }
+
+        // Dependencies are added by type, regardless of the order that they appear in the response.
         Manifest::DependencyList dependencyList;
 
-        auto wfIds = ConvertToManifestStringArray(JSON::GetRawStringArrayFromJsonNode(dependenciesObject, JSON::GetUtilityString(WindowsFeatures)));
         for (auto&& id : wfIds)
         {
             dependencyList.Add(Dependency(DependencyType::WindowsFeature, std::move(id)));
-        };
+        }
 
-        const auto& wlIds = ConvertToManifestStringArray(JSON::GetRawStringArrayFromJsonNode(dependenciesObject, JSON::GetUtilityString(WindowsLibraries)));
-        for (auto id : wlIds)
+        for (auto&& id : wlIds)
         {
-            dependencyList.Add(Dependency(DependencyType::WindowsLibrary, id));
-        };
+            dependencyList.Add(Dependency(DependencyType::WindowsLibrary, std::move(id)));
+        }
 
-        const auto& extIds = ConvertToManifestStringArray(JSON::GetRawStringArrayFromJsonNode(dependenciesObject, JSON::GetUtilityString(ExternalDependencies)));
-        for (auto id : extIds)
+        for (auto&& id : extIds)
         {
-            dependencyList.Add(Dependency(DependencyType::External, id));
-        };
+            dependencyList.Add(Dependency(DependencyType::External, std::move(id)));
+        }
 
-        // Package Dependencies
-        std::optional<std::reference_wrapper<const web::json::array>> packageDependencies = JSON::GetRawJsonArrayFromJsonNode(dependenciesObject, JSON::GetUtilityString(PackageDependencies));
-        if (packageDependencies)
+        for (auto&& packageDependency : packageDependencies)
         {
-            for (auto& packageDependency : packageDependencies.value().get())
-            {
-                std::optional<std::string> id = JSON::GetRawStringValueFromJsonNode(packageDependency, JSON::GetUtilityString(PackageIdentifier));
-                if (id)
-                {
-                    Dependency pkg{ DependencyType::Package, std::move(id.value()) ,  JSON::GetRawStringValueFromJsonNode(packageDependency, JSON::GetUtilityString(MinimumVersion)).value_or("") };
-                    dependencyList.Add(std::move(pkg));
-                }
-            }
+            dependencyList.Add(std::move(packageDependency));
         }
 
         return dependencyList;
@@ -525,4 +909,19 @@ namespace AppInstaller::Repository::Rest::Schema::V1_0::Json
 
         return result;
     }
+
+    std::optional<int> ManifestDeserializer::ReadReturnCode(JSON::StreamingReader& reader) const
+    {
+        std::optional<int64_t> value = reader.ReadInt64();
+        if (!value)
+        {
+            return {};
+        }
+
+        THROW_HR_IF_MSG(APPINSTALLER_CLI_ERROR_RESTSOURCE_INVALID_DATA,
+            *value < std::numeric_limits<int32_t>::min() || *value > std::numeric_limits<uint32_t>::max(),
+            "Installer return code out of range: %lld", *value);
+
+        return static_cast<int>(static_cast<uint32_t>(*value));
+    }
 }
@@ -1,7 +1,7 @@
 // Copyright (c) Microsoft Corporation.
 // Licensed under the MIT License.
 #pragma once
-#include <cpprest/json.h>
+#include <winget/JsonStreamingReader.h>
 #include "Rest/Schema/IRestClient.h"
 
 namespace AppInstaller::Repository::Rest::Schema::V1_0::Json
@@ -9,11 +9,14 @@ namespace AppInstaller::Repository::Rest::Schema::V1_0::Json
     // Search Result Deserializer.
     struct SearchResponseDeserializer
     {
-        // Gets the search result for given version
-        IRestClient::SearchResult Deserialize(const web::json::value& searchResultJsonObject) const;
+        // Gets the search response from the UTF-8 JSON response body.
+        IRestClient::SearchResponse Deserialize(std::string_view searchResponse) const;
 
     protected:
-        virtual std::optional<IRestClient::SearchResult> DeserializeSearchResult(const web::json::value& searchResultJsonObject) const;
-        virtual std::optional<IRestClient::VersionInfo> DeserializeVersionInfo(const web::json::value& versionInfoJsonObject) const;
+        std::optional<IRestClient::Package> DeserializePackage(AppInstaller::JSON::StreamingReader& reader) const;
+        std::optional<IRestClient::VersionInfo> DeserializeVersionInfo(AppInstaller::JSON::StreamingReader& reader) const;
+
+        // Reads a field of a version object, other than the version and channel, into the version info.
+        virtual void DeserializeVersionInfoField(AppInstaller::JSON::StreamingReader& reader, std::string_view name, IRestClient::VersionInfo& versionInfo) const;
     };
 }
@@ -20,109 +20,187 @@ namespace AppInstaller::Repository::Rest::Schema::V1_0::Json
         constexpr std::string_view Versions = "Versions"sv;
         constexpr std::string_view PackageVersion = "PackageVersion"sv;
         constexpr std::string_view Channel = "Channel"sv;
+        constexpr std::string_view UnsupportedPackageMatchFields = "UnsupportedPackageMatchFields"sv;
+        constexpr std::string_view RequiredPackageMatchFields = "RequiredPackageMatchFields"sv;
     }
 
-    IRestClient::SearchResult SearchResponseDeserializer::Deserialize(const web::json::value& searchResponseObject) const
+    IRestClient::SearchResponse SearchResponseDeserializer::Deserialize(std::string_view searchResponse) const
     {
-        std::optional<IRestClient::SearchResult> response = DeserializeSearchResult(searchResponseObject);
+        JSON::StreamingReader reader{ searchResponse };
 
-        THROW_HR_IF(APPINSTALLER_CLI_ERROR_RESTSOURCE_INVALID_DATA, !response);
-
-        return response.value();
-    }
-
-    std::optional<IRestClient::SearchResult> SearchResponseDeserializer::DeserializeSearchResult(const web::json::value& searchResponseObject) const
-    {
-        // Make search result from json output.
-        if (searchResponseObject.is_null())
+        if (reader.IsAtEnd() || reader.PeekType() != JSON::ValueType::Object)
         {
             AICLI_LOG(Repo, Error, << "Missing json object.");
-            return {};
+            THROW_HR(APPINSTALLER_CLI_ERROR_RESTSOURCE_INVALID_DATA);
         }
 
-        IRestClient::SearchResult result;
-        try
+        IRestClient::SearchResponse response;
+        reader.BeginObject();
+
+        while (auto name = reader.NextMember())
         {
-            std::optional<std::reference_wrapper<const web::json::array>> dataArray = JSON::GetRawJsonArrayFromJsonNode(searchResponseObject, JSON::GetUtilityString(Data));
-            if (!dataArray || dataArray.value().get().size() == 0)
+            if (*name == Data)
             {
-                AICLI_LOG(Repo, Verbose, << "No search results returned.");
-                return result;
+                if (reader.BeginArray())
+                {
+                    while (reader.NextElement())
+                    {
+                        std::optional<IRestClient::Package> package = DeserializePackage(reader);
+                        THROW_HR_IF(APPINSTALLER_CLI_ERROR_RESTSOURCE_INVALID_DATA, !package);
+                        response.Result.Matches.emplace_back(std::move(package).value());
+                    }
+                }
             }
-
-            for (auto& manifestItem : dataArray.value().get())
+            else if (*name == ContinuationToken)
+            {
+                response.ContinuationToken = reader.ReadString().value_or("");
+            }
+            else if (*name == UnsupportedPackageMatchFields)
+            {
+                response.UnsupportedPackageMatchFields = reader.ReadStringArray();
+            }
+            else if (*name == RequiredPackageMatchFields)
+            {
+                response.RequiredPackageMatchFields = reader.ReadStringArray();
+            }
+            else
             {
-                std::optional<std::string> packageId = JSON::GetRawStringValueFromJsonNode(manifestItem, JSON::GetUtilityString(PackageIdentifier));
-                std::optional<std::string> packageName = JSON::GetRawStringValueFromJsonNode(manifestItem, JSON::GetUtilityString(PackageName));
-                std::optional<std::string> publisher = JSON::GetRawStringValueFromJsonNode(manifestItem, JSON::GetUtilityString(Publisher));
+                reader.SkipValue();
+            }
+        }
 
-                if (!JSON::IsValidNonEmptyStringValue(packageId) || !JSON::IsValidNonEmptyStringValue(packageName) || !JSON::IsValidNonEmptyStringValue(publisher))
-                {
-                    AICLI_LOG(Repo, Error, << "Missing required package fields in manifest search results.");
-                    return {};
-                }
+        reader.EndDocument();
+
+        if (response.Result.Matches.empty())
+        {
+            AICLI_LOG(Repo, Verbose, << "No search results returned.");
+        }
+
+        return response;
+    }
 
-                std::optional<std::reference_wrapper<const web::json::array>> versionValue = JSON::GetRawJsonArrayFromJsonNode(manifestItem, JSON::GetUtilityString(Versions));
-                std::vector<IRestClient::VersionInfo> versionList;
+    std::optional<IRestClient::Package> SearchResponseDeserializer::DeserializePackage(JSON::StreamingReader& reader) const
+    {
+        std::optional<std::string> packageId;
+        std::optional<std::string> packageName;
+        std::optional<std::string> publisher;
+        std::vector<IRestClient::VersionInfo> versionList;
+        bool hasInvalidVersion = false;
 
-                if (versionValue)
+        if (reader.BeginObject())
+        {
+            while (auto name = reader.NextMember())
+            {
+                if (*name == PackageIdentifier)
+                {
+                    packageId = reader.ReadString();
+                }
+                else if (*name == PackageName)
+                {
+                    packageName = reader.ReadString();
+                }
+                else if (*name == Publisher)
                 {
-                    for (auto& versionItem : versionValue.value().get())
+                    publisher = reader.ReadString();
+                }
+                else if (*name == Versions)
+                {
+                    versionList.clear();
+
+                    if (reader.BeginArray())
                     {
-                        auto versionInfo = DeserializeVersionInfo(versionItem);
-                        if (!versionInfo.has_value())
+                        while (reader.NextElement())
                         {
-                            AICLI_LOG(Repo, Error, << "Received incomplete package version in package: " << packageId.value());
-                            return {};
+                            auto versionInfo = DeserializeVersionInfo(reader);
+                            if (versionInfo)
+                            {
+                                versionList.emplace_back(std::move(versionInfo).value());
+                            }
+                            else
+                            {
+                                hasInvalidVersion = true;
+                            }
                         }
-
-                        versionList.emplace_back(std::move(*versionInfo));
                     }
                 }
-
-                if (versionList.size() == 0)
+                else
                 {
-                    AICLI_LOG(Repo, Error, << "Received no versions in package: " << packageId.value());
-                    return {};
+                    reader.SkipValue();
                 }
-
-                IRestClient::PackageInfo packageInfo{
-                        std::move(packageId.value()), std::move(packageName.value()), std::move(publisher.value()) };
-                IRestClient::Package package{ std::move(packageInfo), std::move(versionList) };
-                result.Matches.emplace_back(std::move(package));
             }
+        }
 
-            return result;
+        if (!JSON::IsValidNonEmptyStringValue(packageId) || !JSON::IsValidNonEmptyStringValue(packageName) || !JSON::IsValidNonEmptyStringValue(publisher))
+        {
+            AICLI_LOG(Repo, Error, << "Missing required package fields in manifest search results.");
+            return {};
         }
-        catch (const std::exception& e)
+
+        if (hasInvalidVersion)
         {
-            AICLI_LOG(Repo, Error, << "Error encountered while deserializing search result. Reason: " << e.what());
+            AICLI_LOG(Repo, Error, << "Received incomplete package version in package: " << packageId.value());
+            return {};
         }
-        catch (...)
+
+        if (versionList.size() == 0)
         {
-            AICLI_LOG(Repo, Error, << "Error encountered while deserializing search result...");
+            AICLI_LOG(Repo, Error, << "Received no versions in package: " << packageId.value());
+            return {};
         }
 
-        return {};
+        IRestClient::PackageInfo packageInfo{
+                std::move(packageId.value()), std::move(packageName.value()), std::move(publisher.value()) };
+        return IRestClient::Package{ std::move(packageInfo), std::move(versionList) };
     }
 
-    std::optional<IRestClient::VersionInfo> SearchResponseDeserializer::DeserializeVersionInfo(const web::json::value& versionInfoJsonObject) const
+    std::optional<IRestClient::VersionInfo> SearchResponseDeserializer::DeserializeVersionInfo(JSON::StreamingReader& reader) const
     {
-        std::optional<std::string> version = JSON::GetRawStringValueFromJsonNode(versionInfoJsonObject, JSON::GetUtilityString(PackageVersion));
+        std::optional<std::string> version;
+        std::string channel;
+        IRestClient::VersionInfo versionInfo{ {}, {} };
+
+        if (reader.BeginObject())
+        {
+            while (auto name = reader.NextMember())
+            {
+                if (*name == PackageVersion)
+                {
+                    version = reader.ReadString();
+                }
+                else if (*name == Channel)
+                {
+                    channel = reader.ReadString().value_or("");
+                }
+                else
+                {
+                    DeserializeVersionInfoField(reader, *name, versionInfo);
+                }
+            }
+        }
+
         if (!JSON::IsValidNonEmptyStringValue(version))
         {
             AICLI_LOG(Repo, Error, << "Received incomplete package version");
             return {};
         }
 
-        std::string channel = JSON::GetRawStringValueFromJsonNode(versionInfoJsonObject, JSON::GetUtilityString(Channel)).value_or("");
-        std::vector<std::string> packageFamilyNames = RestHelper::GetUniqueItems(JSON::GetRawStringArrayFromJsonNode(versionInfoJsonObject, JSON::GetUtilityString(PackageFamilyNames)));
-        std::vector<std::string> productCodes = RestHelper::GetUniqueItems(JSON::GetRawStringArrayFromJsonNode(versionInfoJsonObject, JSON::GetUtilityString(ProductCodes)));
+        versionInfo.VersionAndChannel = AppInstaller::Utility::VersionAndChannel{ std::move(version.value()), std::move(channel) };
+        return versionInfo;
+    }
 
-        return IRestClient::VersionInfo{
-            AppInstaller::Utility::VersionAndChannel{std::move(version.value()), std::move(channel)},
-            {},
-            std::move(packageFamilyNames),
-            std::move(productCodes) };
+    void SearchResponseDeserializer::DeserializeVersionInfoField(JSON::StreamingReader& reader, std::string_view name, IRestClient::VersionInfo& versionInfo) const
+    {
+        if (name == PackageFamilyNames)
+        {
+            versionInfo.PackageFamilyNames = RestHelper::GetUniqueItems(reader.ReadStringArray());
+        }
+        else if (name == ProductCodes)
+        {
+            versionInfo.ProductCodes = RestHelper::GetUniqueItems(reader.ReadStringArray());
+        }
+        else
+        {
+            reader.SkipValue();
+        }
     }
 }
@@ -38,6 +38,24 @@ namespace AppInstaller::Repository::Rest::Schema::V1_0
             // Create the endpoint with query parameters
             return RestHelper::AppendQueryParamsToUri(getManifestWithPackageIdPath, queryParameters);
         }
+
+        void ValidateReceivedManifest(const Manifest::Manifest& manifest)
+        {
+            std::vector<AppInstaller::Manifest::ValidationError> validationErrors =
+                AppInstaller::Manifest::ValidateManifest(manifest, false);
+
+            int errors = 0;
+            for (auto& error : validationErrors)
+            {
+                if (error.ErrorLevel == Manifest::ValidationError::Level::Error)
+                {
+                    AICLI_LOG(Repo, Error, << "Received manifest contains validation error: " << error.GetErrorMessage());
+                    errors++;
+                }
+            }
+
+            THROW_HR_IF(APPINSTALLER_CLI_ERROR_RESTSOURCE_INVALID_DATA, errors > 0);
+        }
     }
 
     Interface::Interface(const std::string& restApi, const HttpClientHelper& httpClientHelper) : m_restApiUri(restApi), m_httpClientHelper(httpClientHelper)
@@ -82,12 +100,13 @@ namespace AppInstaller::Repository::Rest::Schema::V1_0
                 searchHeaders.insert_or_assign(AppInstaller::JSON::GetUtilityString(ContinuationToken), continuationToken);
             }
 
-            std::optional<web::json::value> jsonObject = m_httpClientHelper.HandlePost(m_searchEndpoint, GetValidatedSearchBody(request), searchHeaders);
+            std::optional<std::string> response = m_httpClientHelper.HandlePostUtf8(m_searchEndpoint, GetValidatedSearchBody(request), searchHeaders);
 
             utility::string_t ct;
-            if (jsonObject)
+            if (response)
             {
-                SearchResult currentResult = GetSearchResult(jsonObject.value());
+                SearchResponse currentResponse = GetSearchResponse(response.value());
+                SearchResult& currentResult = currentResponse.Result;
 
                 size_t insertElements = !request.MaximumResults ? currentResult.Matches.size() :
                     std::min(currentResult.Matches.size(), request.MaximumResults - results.Matches.size());
@@ -98,7 +117,7 @@ namespace AppInstaller::Repository::Rest::Schema::V1_0
                 }
 
                 std::move(currentResult.Matches.begin(), std::next(currentResult.Matches.begin(), insertElements), std::inserter(results.Matches, results.Matches.end()));
-                ct = RestHelper::GetContinuationToken(jsonObject.value()).value_or(L"");
+                ct = AppInstaller::JSON::GetUtilityString(currentResponse.ContinuationToken);
             }
 
             continuationToken = ct;
@@ -131,16 +150,17 @@ namespace AppInstaller::Repository::Rest::Schema::V1_0
             queryParams.emplace(ChannelQueryParam, channel);
         }
 
-        std::vector<Manifest::Manifest> manifests = GetManifests(packageId, queryParams);
+        // Only the requested version has its manifest deserialized
+        std::optional<Package> package = GetPackageFromManifests(packageId, queryParams);
 
-        if (!manifests.empty())
+        if (package)
         {
-            for (Manifest::Manifest manifest : manifests)
+            for (const auto& versionInfo : package->Versions)
             {
-                if (Utility::CaseInsensitiveEquals(manifest.Version, version) &&
-                    Utility::CaseInsensitiveEquals(manifest.Channel, channel))
+                if (Utility::CaseInsensitiveEquals(versionInfo.VersionAndChannel.GetVersion().ToString(), version) &&
+                    Utility::CaseInsensitiveEquals(versionInfo.VersionAndChannel.GetChannel().ToString(), channel))
                 {
-                    return manifest;
+                    return versionInfo.Manifest->Get();
                 }
             }
         }
@@ -166,37 +186,11 @@ namespace AppInstaller::Repository::Rest::Schema::V1_0
     IRestClient::SearchResult Interface::OptimizedSearch(const SearchRequest& request) const
     {
         SearchResult searchResult;
-        std::vector<Manifest::Manifest> manifests = GetManifests(request.Filters[0].Value);
+        std::optional<Package> package = GetPackageFromManifests(request.Filters[0].Value);
 
-        if (!manifests.empty())
+        if (package)
         {
-            auto& manifest = manifests.at(0);
-            PackageInfo packageInfo = PackageInfo{
-                manifest.Id,
-                manifest.DefaultLocalization.Get<AppInstaller::Manifest::Localization::PackageName>(),
-                manifest.DefaultLocalization.Get<AppInstaller::Manifest::Localization::Publisher>() };
-
-            // Add all the versions to the package info object
-            std::vector<VersionInfo> versions;
-            for (auto& manifestVersion : manifests)
-            {
-                auto packageFamilyNames = manifestVersion.GetPackageFamilyNames();
-                auto productCodes = manifestVersion.GetProductCodes();
-                auto arpVersionRange = manifestVersion.GetArpVersionRange();
-                auto upgradeCodes = manifestVersion.GetUpgradeCodes();
-
-                versions.emplace_back(
-                    VersionInfo{
-                        AppInstaller::Utility::VersionAndChannel {manifestVersion.Version, manifestVersion.Channel},
-                        manifestVersion,
-                        std::vector<std::string>{ packageFamilyNames.begin(), packageFamilyNames.end()},
-                        std::vector<std::string>{ productCodes.begin(), productCodes.end()},
-                        arpVersionRange.IsEmpty() ? std::vector<Utility::Version>{} : std::vector<Utility::Version>{ arpVersionRange.GetMinVersion(), arpVersionRange.GetMaxVersion() },
-                        std::vector<std::string>{ upgradeCodes.begin(), upgradeCodes.end()} });
-            }
-
-            Package package = Package{ std::move(packageInfo), std::move(versions) };
-            searchResult.Matches.emplace_back(std::move(package));
+            searchResult.Matches.emplace_back(std::move(package).value());
         }
 
         return searchResult;
@@ -204,44 +198,79 @@ namespace AppInstaller::Repository::Rest::Schema::V1_0
 
     std::vector<Manifest::Manifest> Interface::GetManifests(const std::string& packageId, const std::map<std::string_view, std::string>& params) const
     {
-        auto validatedParams = GetValidatedQueryParams(params);
-
-        std::vector<Manifest::Manifest> results;
-        utility::string_t continuationToken;
-        std::unordered_map<utility::string_t, utility::string_t> searchHeaders = m_requiredRestApiHeaders;
-        std::optional<web::json::value> jsonObject = m_httpClientHelper.HandleGet(GetManifestByVersionEndpoint(m_restApiUri, packageId, validatedParams), m_requiredRestApiHeaders);
+        std::optional<std::string> response = GetManifestsResponse(packageId, params);
 
-        if (!jsonObject)
+        if (!response)
         {
-            AICLI_LOG(Repo, Verbose, << "No results were returned by the rest source for package id: " << packageId);
-            return results;
+            return {};
         }
 
         // Parse json and return Manifests
-        std::vector<Manifest::Manifest> manifests = GetParsedManifests(jsonObject.value());
+        std::vector<Manifest::Manifest> manifests = GetParsedManifests(response.value());
 
         // Manifest validation
-        for (auto& manifestItem : manifests)
+        for (const auto& manifestItem : manifests)
         {
-            std::vector<AppInstaller::Manifest::ValidationError> validationErrors =
-                AppInstaller::Manifest::ValidateManifest(manifestItem, false);
+            ValidateReceivedManifest(manifestItem);
+        }
 
-            int errors = 0;
-            for (auto& error : validationErrors)
-            {
-                if (error.ErrorLevel == Manifest::ValidationError::Level::Error)
-                {
-                    AICLI_LOG(Repo, Error, << "Received manifest contains validation error: " << error.GetErrorMessage());
-                    errors++;
-                }
-            }
+        return manifests;
+    }
 
-            THROW_HR_IF(APPINSTALLER_CLI_ERROR_RESTSOURCE_INVALID_DATA, errors > 0);
+    std::optional<std::string> Interface::GetManifestsResponse(const std::string& packageId, const std::map<std::string_view, std::string>& params) const
+    {
+        auto validatedParams = GetValidatedQueryParams(params);
+        std::optional<std::string> response = m_httpClientHelper.HandleGetUtf8(GetManifestByVersionEndpoint(m_restApiUri, packageId, validatedParams), m_requiredRestApiHeaders);
 
-            results.emplace_back(manifestItem);
+        if (!response)
+        {
+            AICLI_LOG(Repo, Verbose, << "No results were returned by the rest source for package id: " << packageId);
         }
 
-        return results;
+        return response;
+    }
+
+    std::optional<IRestClient::Package> Interface::GetPackageFromManifests(const std::string& packageId, const std::map<std::string_view, std::string>& params) const
+    {
+        std::optional<std::string> response = GetManifestsResponse(packageId, params);
+
+        if (!response)
+        {
+            return {};
+        }
+
+        // The versions refer into the body, which is kept alive until all of their manifests have been deserialized.
+        auto body = std::make_shared<const std::string>(std::move(response).value());
+        std::vector<JSON::ManifestVersionJson> manifestVersions = JSON::ManifestJSONParser::FindVersions(*body);
+
+        if (manifestVersions.empty())
+        {
+            // A response without results may describe an unsupported request, which the schema specific parsing reports.
+            GetParsedManifests(*body);
+            return {};
+        }
+
+        auto parser = std::make_shared<const JSON::ManifestJSONParser>(GetVersion());
+        const auto& first = manifestVersions.front();
+        PackageInfo packageInfo{ first.PackageIdentifier, first.PackageName, first.Publisher };
+
+        std::vector<VersionInfo> versions;
+        for (auto& manifestVersion : manifestVersions)
+        {
+            Utility::VersionAndChannel versionAndChannel{ Utility::Version{ manifestVersion.Version }, Utility::Channel{ manifestVersion.Channel } };
+
+            auto manifest = std::make_shared<const LazyManifest>(
+                [body, parser, manifestVersion = std::move(manifestVersion)]()
+                {
+                    Manifest::Manifest result = parser->DeserializeVersion(manifestVersion);
+                    ValidateReceivedManifest(result);
+                    return result;
+                });
+
+            versions.emplace_back(std::move(versionAndChannel), std::move(manifest));
+        }
+
+        return Package{ std::move(packageInfo), std::move(versions) };
     }
 
     std::map<std::string_view, std::string> Interface::GetValidatedQueryParams(const std::map<std::string_view, std::string>& params) const
@@ -255,15 +284,15 @@ namespace AppInstaller::Repository::Rest::Schema::V1_0
         return searchRequestComposer.Serialize(searchRequest);
     }
 
-    IRestClient::SearchResult Interface::GetSearchResult(const web::json::value& searchResponseObject) const
+    IRestClient::SearchResponse Interface::GetSearchResponse(std::string_view searchResponse) const
     {
         SearchResponseParser searchResponseParser{ GetVersion() };
-        return searchResponseParser.Deserialize(searchResponseObject);
+        return searchResponseParser.Deserialize(searchResponse);
     }
 
-    std::vector<Manifest::Manifest> Interface::GetParsedManifests(const web::json::value& manifestsResponseObject) const
+    std::vector<Manifest::Manifest> Interface::GetParsedManifests(std::string_view manifestsResponse) const
     {
         JSON::ManifestJSONParser manifestParser{ GetVersion() };
-        return manifestParser.Deserialize(manifestsResponseObject);
+        return manifestParser.Deserialize(manifestsResponse);
     }
 }
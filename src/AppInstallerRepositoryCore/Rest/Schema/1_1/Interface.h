@@ -26,8 +26,8 @@ namespace AppInstaller::Repository::Rest::Schema::V1_1
         // Check search request against source information and get json search body.
         web::json::value GetValidatedSearchBody(const SearchRequest& searchRequest) const override;
 
-        SearchResult GetSearchResult(const web::json::value& searchResponseObject) const override;
-        std::vector<Manifest::Manifest> GetParsedManifests(const web::json::value& manifestsResponseObject) const override;
+        SearchResponse GetSearchResponse(std::string_view searchResponse) const override;
+        std::vector<Manifest::Manifest> GetParsedManifests(std::string_view manifestsResponse) const override;
 
         PackageMatchField ConvertStringToPackageMatchField(std::string_view field) const;
 
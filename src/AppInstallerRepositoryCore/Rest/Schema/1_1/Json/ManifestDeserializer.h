@@ -8,17 +8,20 @@ namespace AppInstaller::Repository::Rest::Schema::V1_1::Json
     // Manifest Deserializer.
     struct ManifestDeserializer : public V1_0::Json::ManifestDeserializer
     {
-        std::vector<Manifest::AppsAndFeaturesEntry> DeserializeAppsAndFeaturesEntries(const web::json::array& entries) const override;
+    protected:
+        std::vector<Manifest::AppsAndFeaturesEntry> DeserializeAppsAndFeaturesEntries(AppInstaller::JSON::StreamingReader& reader) const override;
 
-        std::optional<Manifest::ManifestLocalization> DeserializeLocale(const web::json::value& localeJsonObject) const override;
+        void DeserializeLocaleField(AppInstaller::JSON::StreamingReader& reader, std::string_view name, Manifest::ManifestLocalization& manifestLocale) const override;
 
-    protected:
-        std::optional<Manifest::ManifestInstaller> DeserializeInstaller(const web::json::value& installerJsonObject) const override;
+        bool DeserializeInstallerField(AppInstaller::JSON::StreamingReader& reader, std::string_view name, Manifest::ManifestInstaller& installer) const override;
+
+        void CompleteInstaller(Manifest::ManifestInstaller& installer) const override;
 
         Manifest::InstallerTypeEnum ConvertToInstallerType(std::string_view in) const override;
 
         virtual Manifest::ExpectedReturnCodeEnum ConvertToExpectedReturnCodeEnum(std::string_view in) const;
 
-        virtual Manifest::ManifestInstaller::ExpectedReturnCodeInfo DeserializeExpectedReturnCodeInfo(const web::json::value& expectedReturnCodeJsonObject) const;
+        // Reads a field of an expected return code, other than the InstallerReturnCode, into the info.
+        virtual void DeserializeExpectedReturnCodeField(AppInstaller::JSON::StreamingReader& reader, std::string_view name, Manifest::ManifestInstaller::ExpectedReturnCodeInfo& returnCodeInfo) const;
     };
 }
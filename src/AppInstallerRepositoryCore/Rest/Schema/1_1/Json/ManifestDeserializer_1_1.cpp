@@ -41,19 +41,55 @@ namespace AppInstaller::Repository::Rest::Schema::V1_1::Json
         constexpr std::string_view AgreementUrl = "AgreementUrl"sv;
     }
 
-    std::vector<Manifest::AppsAndFeaturesEntry> ManifestDeserializer::DeserializeAppsAndFeaturesEntries(const web::json::array& entries) const
+    std::vector<Manifest::AppsAndFeaturesEntry> ManifestDeserializer::DeserializeAppsAndFeaturesEntries(JSON::StreamingReader& reader) const
     {
         std::vector<Manifest::AppsAndFeaturesEntry> result;
 
-        for (auto& arpEntryNode : entries)
+        if (!reader.BeginArray())
         {
+            return result;
+        }
+
+        while (reader.NextElement())
+        {
+            if (!reader.BeginObject())
+            {
+                continue;
+            }
+
             AppsAndFeaturesEntry arpEntry;
-            arpEntry.DisplayName = JSON::GetRawStringValueFromJsonNode(arpEntryNode, JSON::GetUtilityString(DisplayName)).value_or("");
-            arpEntry.Publisher = JSON::GetRawStringValueFromJsonNode(arpEntryNode, JSON::GetUtilityString(Publisher)).value_or("");
-            arpEntry.DisplayVersion = JSON::GetRawStringValueFromJsonNode(arpEntryNode, JSON::GetUtilityString(DisplayVersion)).value_or("");
-            arpEntry.ProductCode = JSON::GetRawStringValueFromJsonNode(arpEntryNode, JSON::GetUtilityString(ProductCode)).value_or("");
-            arpEntry.UpgradeCode = JSON::GetRawStringValueFromJsonNode(arpEntryNode, JSON::GetUtilityString(UpgradeCode)).value_or("");
-            arpEntry.InstallerType = Manifest::ConvertToInstallerTypeEnum(JSON::GetRawStringValueFromJsonNode(arpEntryNode, JSON::GetUtilityString(InstallerType)).value_or(""));
+
+            while (auto name = reader.NextMember())
+            {
+                if (*name == DisplayName)
+                {
+                    arpEntry.DisplayName = reader.ReadString().value_or("");
+                }
+                else if (*name == Publisher)
+                {
+                    arpEntry.Publisher = reader.ReadString().value_or("");
+                }
+                else if (*name == DisplayVersion)
+                {
+                    arpEntry.DisplayVersion = reader.ReadString().value_or("");
+                }
+                else if (*name == ProductCode)
+                {
+                    arpEntry.ProductCode = reader.ReadString().value_or("");
+                }
+                else if (*name == UpgradeCode)
+                {
+                    arpEntry.UpgradeCode = reader.ReadString().value_or("");
+                }
+                else if (*name == InstallerType)
+                {
+                    arpEntry.InstallerType = Manifest::ConvertToInstallerTypeEnum(reader.ReadString().value_or(""));
+                }
+                else
+                {
+                    reader.SkipValue();
+                }
+            }
 
             // Only add when at least one field is valid
             if (!arpEntry.DisplayName.empty() || !arpEntry.Publisher.empty() || !arpEntry.DisplayVersion.empty() ||
@@ -147,144 +183,219 @@ namespace AppInstaller::Repository::Rest::Schema::V1_1::Json
         return result;
     }
 
-    Manifest::ManifestInstaller::ExpectedReturnCodeInfo ManifestDeserializer::DeserializeExpectedReturnCodeInfo(const web::json::value& expectedReturnCodeJsonObject) const
+    void ManifestDeserializer::DeserializeExpectedReturnCodeField(JSON::StreamingReader& reader, std::string_view name, Manifest::ManifestInstaller::ExpectedReturnCodeInfo& returnCodeInfo) const
     {
-        ExpectedReturnCodeEnum returnResponse = ConvertToExpectedReturnCodeEnum(JSON::GetRawStringValueFromJsonNode(expectedReturnCodeJsonObject, JSON::GetUtilityString(ReturnResponse)).value_or(""));
-        
-        return { returnResponse, "" };
+        if (name == ReturnResponse)
+        {
+            returnCodeInfo.ReturnResponseEnum = ConvertToExpectedReturnCodeEnum(reader.ReadString().value_or(""));
+        }
+        else
+        {
+            reader.SkipValue();
+        }
     }
 
-    std::optional<Manifest::ManifestInstaller> ManifestDeserializer::DeserializeInstaller(const web::json::value& installerJsonObject) const
+    bool ManifestDeserializer::DeserializeInstallerField(JSON::StreamingReader& reader, std::string_view name, Manifest::ManifestInstaller& installer) const
     {
-        auto result = V1_0::Json::ManifestDeserializer::DeserializeInstaller(installerJsonObject);
-
-        if (result)
+        if (name == MSStoreProductIdentifier)
+        {
+            installer.ProductId = reader.ReadString().value_or("");
+        }
+        else if (name == ReleaseDate)
+        {
+            installer.ReleaseDate = reader.ReadString().value_or("");
+        }
+        else if (name == InstallerAbortsTerminal)
+        {
+            installer.InstallerAbortsTerminal = reader.ReadBool().value_or(false);
+        }
+        else if (name == InstallLocationRequired)
+        {
+            installer.InstallLocationRequired = reader.ReadBool().value_or(false);
+        }
+        else if (name == RequireExplicitUpgrade)
+        {
+            installer.RequireExplicitUpgrade = reader.ReadBool().value_or(false);
+        }
+        else if (name == ElevationRequirement)
+        {
+            installer.ElevationRequirement = Manifest::ConvertToElevationRequirementEnum(reader.ReadString().value_or(""));
+        }
+        else if (name == UnsupportedOSArchitectures)
         {
-            auto& installer = result.value();
-
-            installer.ProductId = JSON::GetRawStringValueFromJsonNode(installerJsonObject, JSON::GetUtilityString(MSStoreProductIdentifier)).value_or("");
-            installer.ReleaseDate = JSON::GetRawStringValueFromJsonNode(installerJsonObject, JSON::GetUtilityString(ReleaseDate)).value_or("");
-            installer.InstallerAbortsTerminal = JSON::GetRawBoolValueFromJsonNode(installerJsonObject, JSON::GetUtilityString(InstallerAbortsTerminal)).value_or(false);
-            installer.InstallLocationRequired = JSON::GetRawBoolValueFromJsonNode(installerJsonObject, JSON::GetUtilityString(InstallLocationRequired)).value_or(false);
-            installer.RequireExplicitUpgrade = JSON::GetRawBoolValueFromJsonNode(installerJsonObject, JSON::GetUtilityString(RequireExplicitUpgrade)).value_or(false);
-            installer.ElevationRequirement = Manifest::ConvertToElevationRequirementEnum(
-                JSON::GetRawStringValueFromJsonNode(installerJsonObject, JSON::GetUtilityString(ElevationRequirement)).value_or(""));
-
             // list of unsupported OS architectures
-            std::optional<std::reference_wrapper<const web::json::array>> unsupportedOSArchitectures = JSON::GetRawJsonArrayFromJsonNode(installerJsonObject, JSON::GetUtilityString(UnsupportedOSArchitectures));
-            if (unsupportedOSArchitectures)
+            for (const auto& arch : reader.ReadStringArray())
             {
-                for (auto& archValue : unsupportedOSArchitectures.value().get())
+                if (arch.empty())
                 {
-                    std::optional<std::string> arch = JSON::GetRawStringValueFromJsonValue(archValue);
-                    if (JSON::IsValidNonEmptyStringValue(arch))
-                    {
-                        auto archEnum = Utility::ConvertToArchitectureEnum(arch.value());
+                    continue;
+                }
 
-                        if (archEnum == Utility::Architecture::Neutral)
-                        {
-                            AICLI_LOG(Repo, Error, << "Unsupported OS architectures cannot contain neutral value.");
-                            return {};
-                        }
+                auto archEnum = Utility::ConvertToArchitectureEnum(arch);
 
-                        if (archEnum != Utility::Architecture::Unknown)
-                        {
-                            installer.UnsupportedOSArchitectures.emplace_back(archEnum);
-                        }
-                    }
+                if (archEnum == Utility::Architecture::Neutral)
+                {
+                    AICLI_LOG(Repo, Error, << "Unsupported OS architectures cannot contain neutral value.");
+                    return false;
                 }
-            }
 
-            // Apps and Features Entries
-            std::optional<std::reference_wrapper<const web::json::array>> arpEntriesNode = JSON::GetRawJsonArrayFromJsonNode(installerJsonObject, JSON::GetUtilityString(AppsAndFeaturesEntries));
-            if (arpEntriesNode)
-            {
-                installer.AppsAndFeaturesEntries = DeserializeAppsAndFeaturesEntries(arpEntriesNode.value());
+                if (archEnum != Utility::Architecture::Unknown)
+                {
+                    installer.UnsupportedOSArchitectures.emplace_back(archEnum);
+                }
             }
-
-            // Markets
-            std::optional<std::reference_wrapper<const web::json::value>> marketsNode = JSON::GetJsonValueFromNode(installerJsonObject, JSON::GetUtilityString(Markets));
-            if (marketsNode && !marketsNode.value().get().is_null())
+        }
+        else if (name == AppsAndFeaturesEntries)
+        {
+            installer.AppsAndFeaturesEntries = DeserializeAppsAndFeaturesEntries(reader);
+        }
+        else if (name == Markets)
+        {
+            if (reader.BeginObject())
             {
-                installer.Markets.ExcludedMarkets = V1_0::Json::ManifestDeserializer::ConvertToManifestStringArray(
-                    JSON::GetRawStringArrayFromJsonNode(marketsNode.value().get(), JSON::GetUtilityString(ExcludedMarkets)));
-                installer.Markets.AllowedMarkets = V1_0::Json::ManifestDeserializer::ConvertToManifestStringArray(
-                    JSON::GetRawStringArrayFromJsonNode(marketsNode.value().get(), JSON::GetUtilityString(AllowedMarkets)));
+                while (auto marketsName = reader.NextMember())
+                {
+                    if (*marketsName == ExcludedMarkets)
+                    {
+                        installer.Markets.ExcludedMarkets = V1_0::Json::ManifestDeserializer::ConvertToManifestStringArray(reader.ReadStringArray());
+                    }
+                    else if (*marketsName == AllowedMarkets)
+                    {
+                        installer.Markets.AllowedMarkets = V1_0::Json::ManifestDeserializer::ConvertToManifestStringArray(reader.ReadStringArray());
+                    }
+                    else
+                    {
+                        reader.SkipValue();
+                    }
+                }
             }
+        }
+        else if (name == ExpectedReturnCodes)
+        {
+            bool isValid = true;
 
-            // Expected return codes
-            std::optional<std::reference_wrapper<const web::json::array>> expectedReturnCodesNode = JSON::GetRawJsonArrayFromJsonNode(installerJsonObject, JSON::GetUtilityString(ExpectedReturnCodes));
-            if (expectedReturnCodesNode)
+            if (reader.BeginArray())
             {
-                for (auto& returnCodeNode : expectedReturnCodesNode.value().get())
+                while (reader.NextElement())
                 {
-                    DWORD installerReturnCode = static_cast<DWORD>(JSON::GetRawIntValueFromJsonNode(returnCodeNode, JSON::GetUtilityString(InstallerReturnCode)).value_or(0));
-                    auto returnCodeInfo = DeserializeExpectedReturnCodeInfo(returnCodeNode);
+                    if (!reader.BeginObject())
+                    {
+                        continue;
+                    }
+
+                    DWORD installerReturnCode = 0;
+                    Manifest::ManifestInstaller::ExpectedReturnCodeInfo returnCodeInfo;
+
+                    while (auto returnCodeName = reader.NextMember())
+                    {
+                        if (*returnCodeName == InstallerReturnCode)
+                        {
+                            installerReturnCode = static_cast<DWORD>(ReadReturnCode(reader).value_or(0));
+                        }
+                        else
+                        {
+                            DeserializeExpectedReturnCodeField(reader, *returnCodeName, returnCodeInfo);
+                        }
+                    }
 
                     // Only add when it is valid
-                    if (installerReturnCode != 0 && returnCodeInfo.ReturnResponseEnum != ExpectedReturnCodeEnum::Unknown)
+                    if (isValid && installerReturnCode != 0 && returnCodeInfo.ReturnResponseEnum != ExpectedReturnCodeEnum::Unknown)
                     {
                         if (!installer.ExpectedReturnCodes.insert({ installerReturnCode, std::move(returnCodeInfo) }).second)
                         {
                             AICLI_LOG(Repo, Error, << "Expected return codes cannot have repeated value.");
-                            return {};
+                            isValid = false;
                         }
                     }
                 }
             }
 
-            // Populate installer default return codes if not present in ExpectedReturnCodes and InstallerSuccessCodes
-            auto defaultReturnCodes = GetDefaultKnownReturnCodes(installer.EffectiveInstallerType());
-            for (auto const& defaultReturnCode : defaultReturnCodes)
-            {
-                if (installer.ExpectedReturnCodes.find(defaultReturnCode.first) == installer.ExpectedReturnCodes.end() &&
-                    std::find(installer.InstallerSuccessCodes.begin(), installer.InstallerSuccessCodes.end(), defaultReturnCode.first) == installer.InstallerSuccessCodes.end())
-                {
-                    installer.ExpectedReturnCodes[defaultReturnCode.first].ReturnResponseEnum = defaultReturnCode.second;
-                }
-            }
+            return isValid;
+        }
+        else
+        {
+            return V1_0::Json::ManifestDeserializer::DeserializeInstallerField(reader, name, installer);
         }
 
-        return result;
+        return true;
     }
 
-    std::optional<Manifest::ManifestLocalization> ManifestDeserializer::DeserializeLocale(const web::json::value& localeJsonObject) const
+    void ManifestDeserializer::CompleteInstaller(Manifest::ManifestInstaller& installer) const
     {
-        auto result = V1_0::Json::ManifestDeserializer::DeserializeLocale(localeJsonObject);
+        V1_0::Json::ManifestDeserializer::CompleteInstaller(installer);
 
-        if (result)
+        // Populate installer default return codes if not present in ExpectedReturnCodes and InstallerSuccessCodes
+        auto defaultReturnCodes = GetDefaultKnownReturnCodes(installer.EffectiveInstallerType());
+        for (auto const& defaultReturnCode : defaultReturnCodes)
         {
-            auto& locale = result.value();
+            if (installer.ExpectedReturnCodes.find(defaultReturnCode.first) == installer.ExpectedReturnCodes.end() &&
+                std::find(installer.InstallerSuccessCodes.begin(), installer.InstallerSuccessCodes.end(), defaultReturnCode.first) == installer.InstallerSuccessCodes.end())
+            {
+                installer.ExpectedReturnCodes[defaultReturnCode.first].ReturnResponseEnum = defaultReturnCode.second;
+            }
+        }
+    }
 
-            TryParseStringLocaleField<Manifest::Localization::ReleaseNotes>(locale, localeJsonObject, ReleaseNotes);
-            TryParseStringLocaleField<Manifest::Localization::ReleaseNotesUrl>(locale, localeJsonObject, ReleaseNotesUrl);
+    void ManifestDeserializer::DeserializeLocaleField(JSON::StreamingReader& reader, std::string_view name, Manifest::ManifestLocalization& locale) const
+    {
+        if (name == ReleaseNotes)
+        {
+            DeserializeStringLocaleField<Manifest::Localization::ReleaseNotes>(locale, reader);
+        }
+        else if (name == ReleaseNotesUrl)
+        {
+            DeserializeStringLocaleField<Manifest::Localization::ReleaseNotesUrl>(locale, reader);
+        }
+        else if (name == Agreements)
+        {
+            std::vector<Manifest::Agreement> agreements;
 
-            // Agreements
-            auto agreementsNode = JSON::GetRawJsonArrayFromJsonNode(localeJsonObject, JSON::GetUtilityString(Agreements));
-            if (agreementsNode)
+            if (reader.BeginArray())
             {
-                std::vector<Manifest::Agreement> agreements;
-                for (auto const& agreementNode : agreementsNode.value().get())
+                while (reader.NextElement())
                 {
+                    if (!reader.BeginObject())
+                    {
+                        continue;
+                    }
+
                     Manifest::Agreement agreementEntry;
 
-                    agreementEntry.Label = JSON::GetRawStringValueFromJsonNode(agreementNode, JSON::GetUtilityString(AgreementLabel)).value_or("");
-                    agreementEntry.AgreementText = JSON::GetRawStringValueFromJsonNode(agreementNode, JSON::GetUtilityString(Agreement)).value_or("");
-                    agreementEntry.AgreementUrl = JSON::GetRawStringValueFromJsonNode(agreementNode, JSON::GetUtilityString(AgreementUrl)).value_or("");
+                    while (auto agreementName = reader.NextMember())
+                    {
+                        if (*agreementName == AgreementLabel)
+                        {
+                            agreementEntry.Label = reader.ReadString().value_or("");
+                        }
+                        else if (*agreementName == Agreement)
+                        {
+                            agreementEntry.AgreementText = reader.ReadString().value_or("");
+                        }
+                        else if (*agreementName == AgreementUrl)
+                        {
+                            agreementEntry.AgreementUrl = reader.ReadString().value_or("");
+                        }
+                        else
+                        {
+                            reader.SkipValue();
+                        }
+                    }
 
                     if (!agreementEntry.Label.empty() || !agreementEntry.AgreementText.empty() || !agreementEntry.AgreementUrl.empty())
                     {
                         agreements.emplace_back(std::move(agreementEntry));
                     }
                 }
+            }
 
-                if (!agreements.empty())
-                {
-                    locale.Add<Manifest::Localization::Agreements>(std::move(agreements));
-                }
+            if (!agreements.empty())
+            {
+                locale.Add<Manifest::Localization::Agreements>(std::move(agreements));
             }
         }
-
-        return result;
+        else
+        {
+            V1_0::Json::ManifestDeserializer::DeserializeLocaleField(reader, name, locale);
+        }
     }
 }
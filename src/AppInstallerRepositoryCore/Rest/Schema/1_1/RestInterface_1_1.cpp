@@ -5,6 +5,7 @@
 #include "Rest/Schema/IRestClient.h"
 #include "Rest/Schema/HttpClientHelper.h"
 #include <winget/JsonUtil.h>
+#include <winget/JsonStreamingReader.h>
 #include "Rest/Schema/RestHelper.h"
 #include "Rest/Schema/CommonRestConstants.h"
 
@@ -18,8 +19,6 @@ namespace AppInstaller::Repository::Rest::Schema::V1_1
         constexpr std::string_view MarketQueryParam = "Market"sv;
 
         // Response constants
-        constexpr std::string_view UnsupportedPackageMatchFields = "UnsupportedPackageMatchFields"sv;
-        constexpr std::string_view RequiredPackageMatchFields = "RequiredPackageMatchFields"sv;
         constexpr std::string_view UnsupportedQueryParameters = "UnsupportedQueryParameters"sv;
         constexpr std::string_view RequiredQueryParameters = "RequiredQueryParameters"sv;
     }
@@ -130,33 +129,51 @@ namespace AppInstaller::Repository::Rest::Schema::V1_1
         return V1_0::Interface::GetValidatedSearchBody(resultSearchRequest);
     }
 
-    IRestClient::SearchResult Interface::GetSearchResult(const web::json::value& searchResponseObject) const
+    IRestClient::SearchResponse Interface::GetSearchResponse(std::string_view searchResponse) const
     {
-        IRestClient::SearchResult result = V1_0::Interface::GetSearchResult(searchResponseObject);
+        IRestClient::SearchResponse result = V1_0::Interface::GetSearchResponse(searchResponse);
 
-        if (result.Matches.size() == 0)
+        if (result.Result.Matches.size() == 0)
         {
-            auto requiredPackageMatchFields = JSON::GetRawStringArrayFromJsonNode(searchResponseObject, JSON::GetUtilityString(RequiredPackageMatchFields));
-            auto unsupportedPackageMatchFields = JSON::GetRawStringArrayFromJsonNode(searchResponseObject, JSON::GetUtilityString(UnsupportedPackageMatchFields));
-
-            if (requiredPackageMatchFields.size() != 0 || unsupportedPackageMatchFields.size() != 0)
+            if (result.RequiredPackageMatchFields.size() != 0 || result.UnsupportedPackageMatchFields.size() != 0)
             {
                 AICLI_LOG(Repo, Error, << "Search request is not supported by the rest source");
-                throw UnsupportedRequestException(std::move(unsupportedPackageMatchFields), std::move(requiredPackageMatchFields), {}, {});
+                throw UnsupportedRequestException(std::move(result.UnsupportedPackageMatchFields), std::move(result.RequiredPackageMatchFields), {}, {});
             }
         }
 
         return result;
     }
 
-    std::vector<Manifest::Manifest> Interface::GetParsedManifests(const web::json::value& manifestsResponseObject) const
+    std::vector<Manifest::Manifest> Interface::GetParsedManifests(std::string_view manifestsResponse) const
     {
-        auto result = V1_0::Interface::GetParsedManifests(manifestsResponseObject);
+        auto result = V1_0::Interface::GetParsedManifests(manifestsResponse);
 
         if (result.size() == 0)
         {
-            auto requiredQueryParameters = JSON::GetRawStringArrayFromJsonNode(manifestsResponseObject, JSON::GetUtilityString(RequiredQueryParameters));
-            auto unsupportedQueryParameters = JSON::GetRawStringArrayFromJsonNode(manifestsResponseObject, JSON::GetUtilityString(UnsupportedQueryParameters));
+            // The body has no manifests and is small, so it is read again for the unsupported request details.
+            std::vector<std::string> requiredQueryParameters;
+            std::vector<std::string> unsupportedQueryParameters;
+
+            AppInstaller::JSON::StreamingReader reader{ manifestsResponse };
+            if (reader.BeginObject())
+            {
+                while (auto name = reader.NextMember())
+                {
+                    if (*name == RequiredQueryParameters)
+                    {
+                        requiredQueryParameters = reader.ReadStringArray();
+                    }
+                    else if (*name == UnsupportedQueryParameters)
+                    {
+                        unsupportedQueryParameters = reader.ReadStringArray();
+                    }
+                    else
+                    {
+                        reader.SkipValue();
+                    }
+                }
+            }
 
             if (requiredQueryParameters.size() != 0 || unsupportedQueryParameters.size() != 0)
             {
@@ -8,17 +8,17 @@ namespace AppInstaller::Repository::Rest::Schema::V1_4::Json
     // Manifest Deserializer.
     struct ManifestDeserializer : public V1_1::Json::ManifestDeserializer
     {
-        std::optional<Manifest::ManifestLocalization> DeserializeLocale(const web::json::value& localeJsonObject) const override;
+    protected:
+        std::optional<Manifest::InstallationMetadataInfo> DeserializeInstallationMetadata(AppInstaller::JSON::StreamingReader& reader) const override;
 
-        std::optional<Manifest::InstallationMetadataInfo> DeserializeInstallationMetadata(const web::json::value& installationMetadataJsonObject) const override;
+        void DeserializeLocaleField(AppInstaller::JSON::StreamingReader& reader, std::string_view name, Manifest::ManifestLocalization& manifestLocale) const override;
 
-    protected:
-        std::optional<Manifest::ManifestInstaller> DeserializeInstaller(const web::json::value& installerJsonObject) const override;
+        bool DeserializeInstallerField(AppInstaller::JSON::StreamingReader& reader, std::string_view name, Manifest::ManifestInstaller& installer) const override;
 
         Manifest::InstallerTypeEnum ConvertToInstallerType(std::string_view in) const override;
 
         Manifest::ExpectedReturnCodeEnum ConvertToExpectedReturnCodeEnum(std::string_view in) const override;
 
-        Manifest::ManifestInstaller::ExpectedReturnCodeInfo DeserializeExpectedReturnCodeInfo(const web::json::value& expectedReturnCodeJsonObject) const override;
+        void DeserializeExpectedReturnCodeField(AppInstaller::JSON::StreamingReader& reader, std::string_view name, Manifest::ManifestInstaller::ExpectedReturnCodeInfo& returnCodeInfo) const override;
     };
 }
@@ -71,78 +71,125 @@ namespace AppInstaller::Repository::Rest::Schema::V1_4::Json
         return V1_1::Json::ManifestDeserializer::ConvertToExpectedReturnCodeEnum(inStrLower);
     }
 
-    Manifest::ManifestInstaller::ExpectedReturnCodeInfo ManifestDeserializer::DeserializeExpectedReturnCodeInfo(const web::json::value& expectedReturnCodeJsonObject) const
+    void ManifestDeserializer::DeserializeExpectedReturnCodeField(JSON::StreamingReader& reader, std::string_view name, Manifest::ManifestInstaller::ExpectedReturnCodeInfo& returnCodeInfo) const
     {
-        auto result = V1_1::Json::ManifestDeserializer::DeserializeExpectedReturnCodeInfo(expectedReturnCodeJsonObject);
-        result.ReturnResponseUrl = JSON::GetRawStringValueFromJsonNode(expectedReturnCodeJsonObject, JSON::GetUtilityString(ReturnResponseUrl)).value_or("");
-        return result;
+        if (name == ReturnResponseUrl)
+        {
+            returnCodeInfo.ReturnResponseUrl = reader.ReadString().value_or("");
+        }
+        else
+        {
+            V1_1::Json::ManifestDeserializer::DeserializeExpectedReturnCodeField(reader, name, returnCodeInfo);
+        }
     }
 
-    std::optional<Manifest::InstallationMetadataInfo> ManifestDeserializer::DeserializeInstallationMetadata(const web::json::value& installationMetadataJsonObject) const
+    std::optional<Manifest::InstallationMetadataInfo> ManifestDeserializer::DeserializeInstallationMetadata(JSON::StreamingReader& reader) const
     {
-        if (installationMetadataJsonObject.is_null() || !installationMetadataJsonObject.is_object())
+        if (!reader.BeginObject())
         {
             return {};
         }
 
         Manifest::InstallationMetadataInfo installationMetadata;
-        installationMetadata.DefaultInstallLocation = JSON::GetRawStringValueFromJsonNode(installationMetadataJsonObject, JSON::GetUtilityString(DefaultInstallLocation)).value_or("");
+        bool isValid = true;
 
-        auto filesNode = JSON::GetRawJsonArrayFromJsonNode(installationMetadataJsonObject, JSON::GetUtilityString(InstallationMetadataFiles));
-        if (filesNode)
+        while (auto name = reader.NextMember())
         {
-            for (auto const& fileNode : filesNode->get())
+            if (*name == DefaultInstallLocation)
             {
-                std::optional<std::string> relativeFilePath = JSON::GetRawStringValueFromJsonNode(fileNode, JSON::GetUtilityString(InstallationMetadataRelativeFilePath));
-                if (!JSON::IsValidNonEmptyStringValue(relativeFilePath))
+                installationMetadata.DefaultInstallLocation = reader.ReadString().value_or("");
+            }
+            else if (*name == InstallationMetadataFiles && reader.BeginArray())
+            {
+                while (reader.NextElement())
                 {
-                    AICLI_LOG(Repo, Error, << "Missing RelativeFilePath in InstallationMetadata Files.");
-                    return {};
-                }
+                    if (!reader.BeginObject())
+                    {
+                        continue;
+                    }
 
-                Manifest::InstalledFile installedFile;
-                installedFile.RelativeFilePath = std::move(*relativeFilePath);
-                installedFile.InvocationParameter = JSON::GetRawStringValueFromJsonNode(fileNode, JSON::GetUtilityString(InvocationParameter)).value_or("");
-                installedFile.DisplayName = JSON::GetRawStringValueFromJsonNode(fileNode, JSON::GetUtilityString(DisplayName)).value_or("");
+                    Manifest::InstalledFile installedFile;
 
-                std::optional<std::string> sha256 = JSON::GetRawStringValueFromJsonNode(fileNode, JSON::GetUtilityString(FileSha256));
-                if (JSON::IsValidNonEmptyStringValue(sha256))
-                {
-                    installedFile.FileSha256 = Utility::SHA256::ConvertToBytes(*sha256);
-                }
+                    while (auto fileName = reader.NextMember())
+                    {
+                        if (*fileName == InstallationMetadataRelativeFilePath)
+                        {
+                            installedFile.RelativeFilePath = reader.ReadString().value_or("");
+                        }
+                        else if (*fileName == InvocationParameter)
+                        {
+                            installedFile.InvocationParameter = reader.ReadString().value_or("");
+                        }
+                        else if (*fileName == DisplayName)
+                        {
+                            installedFile.DisplayName = reader.ReadString().value_or("");
+                        }
+                        else if (*fileName == FileSha256)
+                        {
+                            std::optional<std::string> sha256 = reader.ReadString();
+                            if (JSON::IsValidNonEmptyStringValue(sha256))
+                            {
+                                installedFile.FileSha256 = Utility::SHA256::ConvertToBytes(*sha256);
+                            }
+                        }
+                        else if (*fileName == FileType)
+                        {
+                            std::optional<std::string> fileType = reader.ReadString();
+                            if (JSON::IsValidNonEmptyStringValue(fileType))
+                            {
+                                installedFile.FileType = Manifest::ConvertToInstalledFileTypeEnum(*fileType);
+                            }
+                        }
+                        else
+                        {
+                            reader.SkipValue();
+                        }
+                    }
 
-                std::optional<std::string> fileType = JSON::GetRawStringValueFromJsonNode(fileNode, JSON::GetUtilityString(FileType));
-                if (JSON::IsValidNonEmptyStringValue(fileType))
-                {
-                    installedFile.FileType = Manifest::ConvertToInstalledFileTypeEnum(*fileType);
-                }
+                    if (installedFile.RelativeFilePath.empty())
+                    {
+                        if (isValid)
+                        {
+                            AICLI_LOG(Repo, Error, << "Missing RelativeFilePath in InstallationMetadata Files.");
+                        }
 
-                installationMetadata.Files.emplace_back(std::move(installedFile));
+                        isValid = false;
+                    }
+
+                    installationMetadata.Files.emplace_back(std::move(installedFile));
+                }
+            }
+            else if (*name != InstallationMetadataFiles)
+            {
+                reader.SkipValue();
             }
         }
 
+        if (!isValid)
+        {
+            return {};
+        }
+
         return installationMetadata;
     }
 
-    std::optional<Manifest::ManifestInstaller> ManifestDeserializer::DeserializeInstaller(const web::json::value& installerJsonObject) const
+    bool ManifestDeserializer::DeserializeInstallerField(JSON::StreamingReader& reader, std::string_view name, Manifest::ManifestInstaller& installer) const
     {
-        auto result = V1_1::Json::ManifestDeserializer::DeserializeInstaller(installerJsonObject);
-
-        if (result)
+        if (name == NestedInstallerType)
         {
-            auto& installer = result.value();
-
-            std::optional<std::string> nestedInstallerType = JSON::GetRawStringValueFromJsonNode(installerJsonObject, JSON::GetUtilityString(NestedInstallerType));
+            std::optional<std::string> nestedInstallerType = reader.ReadString();
             if (nestedInstallerType)
             {
                 installer.NestedInstallerType = ConvertToInstallerType(*nestedInstallerType);
             }
-            
-            installer.DisplayInstallWarnings = JSON::GetRawBoolValueFromJsonNode(installerJsonObject, JSON::GetUtilityString(DisplayInstallWarnings)).value_or(false);
-
-            // UnsupportedArguments
-            auto unsupportedArguments = JSON::GetRawStringArrayFromJsonNode(installerJsonObject, JSON::GetUtilityString(UnsupportedArguments));
-            for (auto const& unsupportedArgument : unsupportedArguments)
+        }
+        else if (name == DisplayInstallWarnings)
+        {
+            installer.DisplayInstallWarnings = reader.ReadBool().value_or(false);
+        }
+        else if (name == UnsupportedArguments)
+        {
+            for (auto const& unsupportedArgument : reader.ReadStringArray())
             {
                 auto unsupportedArgumentEnum = Manifest::ConvertToUnsupportedArgumentEnum(unsupportedArgument);
                 if (unsupportedArgumentEnum != Manifest::UnsupportedArgumentEnum::Unknown)
@@ -150,79 +197,126 @@ namespace AppInstaller::Repository::Rest::Schema::V1_4::Json
                     installer.UnsupportedArguments.emplace_back(unsupportedArgumentEnum);
                 }
             }
+        }
+        else if (name == NestedInstallerFiles)
+        {
+            bool isValid = true;
 
-            // NestedInstallerFiles
-            auto nestedInstallerFilesNode = JSON::GetRawJsonArrayFromJsonNode(installerJsonObject, JSON::GetUtilityString(NestedInstallerFiles));
-            if (nestedInstallerFilesNode)
+            if (reader.BeginArray())
             {
-                for (auto const& nestedInstallerFileNode : nestedInstallerFilesNode->get())
+                while (reader.NextElement())
                 {
-                    std::optional<std::string> relativeFilePath = JSON::GetRawStringValueFromJsonNode(nestedInstallerFileNode, JSON::GetUtilityString(NestedInstallerFileRelativeFilePath));
-                    if (!JSON::IsValidNonEmptyStringValue(relativeFilePath))
+                    if (!reader.BeginObject())
                     {
-                        AICLI_LOG(Repo, Error, << "Missing RelativeFilePath in NestedInstallerFiles.");
-                        return {};
+                        continue;
                     }
 
                     Manifest::NestedInstallerFile nestedInstallerFile;
-                    nestedInstallerFile.RelativeFilePath = std::move(*relativeFilePath);
-                    nestedInstallerFile.PortableCommandAlias = JSON::GetRawStringValueFromJsonNode(nestedInstallerFileNode, JSON::GetUtilityString(PortableCommandAlias)).value_or("");
+
+                    while (auto fileName = reader.NextMember())
+                    {
+                        if (*fileName == NestedInstallerFileRelativeFilePath)
+                        {
+                            nestedInstallerFile.RelativeFilePath = reader.ReadString().value_or("");
+                        }
+                        else if (*fileName == PortableCommandAlias)
+                        {
+                            nestedInstallerFile.PortableCommandAlias = reader.ReadString().value_or("");
+                        }
+                        else
+                        {
+                            reader.SkipValue();
+                        }
+                    }
+
+                    if (nestedInstallerFile.RelativeFilePath.empty())
+                    {
+                        if (isValid)
+                        {
+                            AICLI_LOG(Repo, Error, << "Missing RelativeFilePath in NestedInstallerFiles.");
+                        }
+
+                        isValid = false;
+                    }
 
                     installer.NestedInstallerFiles.emplace_back(std::move(nestedInstallerFile));
                 }
             }
 
-            // InstallationMetadata
-            auto installationMetadataNode = JSON::GetJsonValueFromNode(installerJsonObject, JSON::GetUtilityString(InstallationMetadata));
-            if (installationMetadataNode)
+            return isValid;
+        }
+        else if (name == InstallationMetadata)
+        {
+            auto installationMetadata = DeserializeInstallationMetadata(reader);
+            if (installationMetadata)
             {
-                auto installationMetadata = DeserializeInstallationMetadata(installationMetadataNode->get());
-                if (installationMetadata)
-                {
-                    installer.InstallationMetadata = std::move(*installationMetadata);
-                }
+                installer.InstallationMetadata = std::move(*installationMetadata);
             }
         }
+        else
+        {
+            return V1_1::Json::ManifestDeserializer::DeserializeInstallerField(reader, name, installer);
+        }
 
-        return result;
+        return true;
     }
 
-    std::optional<Manifest::ManifestLocalization> ManifestDeserializer::DeserializeLocale(const web::json::value& localeJsonObject) const
+    void ManifestDeserializer::DeserializeLocaleField(JSON::StreamingReader& reader, std::string_view name, Manifest::ManifestLocalization& locale) const
     {
-        auto result = V1_1::Json::ManifestDeserializer::DeserializeLocale(localeJsonObject);
-
-        if (result)
+        if (name == InstallationNotes)
         {
-            auto& locale = result.value();
-
-            TryParseStringLocaleField<Manifest::Localization::InstallationNotes>(locale, localeJsonObject, InstallationNotes);
-            TryParseStringLocaleField<Manifest::Localization::PurchaseUrl>(locale, localeJsonObject, PurchaseUrl);
+            DeserializeStringLocaleField<Manifest::Localization::InstallationNotes>(locale, reader);
+        }
+        else if (name == PurchaseUrl)
+        {
+            DeserializeStringLocaleField<Manifest::Localization::PurchaseUrl>(locale, reader);
+        }
+        else if (name == Documentations)
+        {
+            std::vector<Manifest::Documentation> documentations;
 
-            // Documentations
-            auto documentationsNode = JSON::GetRawJsonArrayFromJsonNode(localeJsonObject, JSON::GetUtilityString(Documentations));
-            if (documentationsNode)
+            if (reader.BeginArray())
             {
-                std::vector<Manifest::Documentation> documentations;
-                for (auto const& documentationNode : documentationsNode->get())
+                while (reader.NextElement())
                 {
+                    if (!reader.BeginObject())
+                    {
+                        continue;
+                    }
+
                     Manifest::Documentation documentationEntry;
 
-                    documentationEntry.DocumentLabel = JSON::GetRawStringValueFromJsonNode(documentationNode, JSON::GetUtilityString(DocumentLabel)).value_or("");
-                    documentationEntry.DocumentUrl = JSON::GetRawStringValueFromJsonNode(documentationNode, JSON::GetUtilityString(DocumentUrl)).value_or("");
+                    while (auto documentationName = reader.NextMember())
+                    {
+                        if (*documentationName == DocumentLabel)
+                        {
+                            documentationEntry.DocumentLabel = reader.ReadString().value_or("");
+                        }
+                        else if (*documentationName == DocumentUrl)
+                        {
+                            documentationEntry.DocumentUrl = reader.ReadString().value_or("");
+                        }
+                        else
+                        {
+                            reader.SkipValue();
+                        }
+                    }
 
                     if (!documentationEntry.DocumentLabel.empty() || !documentationEntry.DocumentUrl.empty())
                     {
                         documentations.emplace_back(std::move(documentationEntry));
                     }
                 }
+            }
 
-                if (!documentations.empty())
-                {
-                    locale.Add<Manifest::Localization::Documentations>(std::move(documentations));
-                }
+            if (!documentations.empty())
+            {
+                locale.Add<Manifest::Localization::Documentations>(std::move(documentations));
             }
         }
-
-        return result;
+        else
+        {
+            V1_1::Json::ManifestDeserializer::DeserializeLocaleField(reader, name, locale);
+        }
     }
 }
@@ -3,7 +3,6 @@
 #include "pch.h"
 #include "SearchResponseDeserializer.h"
 #include "Rest/Schema/RestHelper.h"
-#include <winget/JsonUtil.h>
 
 namespace AppInstaller::Repository::Rest::Schema::V1_4::Json
 {
@@ -14,21 +13,26 @@ namespace AppInstaller::Repository::Rest::Schema::V1_4::Json
         constexpr std::string_view AppsAndFeaturesEntryVersions = "AppsAndFeaturesEntryVersions"sv;
     }
 
-    std::optional<IRestClient::VersionInfo> SearchResponseDeserializer::DeserializeVersionInfo(const web::json::value& versionInfoJsonObject) const
+    void SearchResponseDeserializer::DeserializeVersionInfoField(JSON::StreamingReader& reader, std::string_view name, IRestClient::VersionInfo& versionInfo) const
     {
-        auto result = V1_0::Json::SearchResponseDeserializer::DeserializeVersionInfo(versionInfoJsonObject);
-        if (result.has_value())
+        if (name == UpgradeCodes)
         {
-            result->UpgradeCodes = RestHelper::GetUniqueItems(JSON::GetRawStringArrayFromJsonNode(versionInfoJsonObject, JSON::GetUtilityString(UpgradeCodes)));
-            auto arpVersions = RestHelper::GetUniqueItems(JSON::GetRawStringArrayFromJsonNode(versionInfoJsonObject, JSON::GetUtilityString(AppsAndFeaturesEntryVersions)));
+            versionInfo.UpgradeCodes = RestHelper::GetUniqueItems(reader.ReadStringArray());
+        }
+        else if (name == AppsAndFeaturesEntryVersions)
+        {
+            auto arpVersions = RestHelper::GetUniqueItems(reader.ReadStringArray());
+            versionInfo.ArpVersions.clear();
             for (auto const& version : arpVersions)
             {
-                result->ArpVersions.emplace_back(Utility::Version{ version });
+                versionInfo.ArpVersions.emplace_back(Utility::Version{ version });
             }
             // Sort the arp versions for later querying
-            std::sort(result->ArpVersions.begin(), result->ArpVersions.end());
+            std::sort(versionInfo.ArpVersions.begin(), versionInfo.ArpVersions.end());
+        }
+        else
+        {
+            V1_0::Json::SearchResponseDeserializer::DeserializeVersionInfoField(reader, name, versionInfo);
         }
-
-        return result;
     }
 }
@@ -8,6 +8,7 @@ namespace AppInstaller::Repository::Rest::Schema::V1_5::Json
     // Manifest Deserializer.
     struct ManifestDeserializer : public V1_4::Json::ManifestDeserializer
     {
-        std::optional<Manifest::ManifestLocalization> DeserializeLocale(const web::json::value& localeJsonObject) const override;
+    protected:
+        void DeserializeLocaleField(AppInstaller::JSON::StreamingReader& reader, std::string_view name, Manifest::ManifestLocalization& manifestLocale) const override;
     };
 }
@@ -19,55 +19,76 @@ namespace AppInstaller::Repository::Rest::Schema::V1_5::Json
         constexpr std::string_view IconSha256 = "IconSha256"sv;
     }
 
-    std::optional<Manifest::ManifestLocalization> ManifestDeserializer::DeserializeLocale(const web::json::value& localeJsonObject) const
+    void ManifestDeserializer::DeserializeLocaleField(JSON::StreamingReader& reader, std::string_view name, Manifest::ManifestLocalization& locale) const
     {
-        auto result = V1_4::Json::ManifestDeserializer::DeserializeLocale(localeJsonObject);
-
-        if (result)
+        if (name != Icons)
         {
-            auto& locale = result.value();
+            V1_4::Json::ManifestDeserializer::DeserializeLocaleField(reader, name, locale);
+            return;
+        }
+
+        std::vector<Manifest::Icon> icons;
 
-            // Icons
-            auto iconsNode = JSON::GetRawJsonArrayFromJsonNode(localeJsonObject, JSON::GetUtilityString(Icons));
-            if (iconsNode)
+        if (reader.BeginArray())
+        {
+            while (reader.NextElement())
             {
-                std::vector<Manifest::Icon> icons;
-                for (auto const& iconNode : iconsNode->get())
+                if (!reader.BeginObject())
                 {
-                    Manifest::Icon iconEntry;
+                    continue;
+                }
+
+                Manifest::Icon iconEntry;
+                std::string fileType;
+                std::optional<std::string> sha256;
 
-                    iconEntry.Url = JSON::GetRawStringValueFromJsonNode(iconNode, JSON::GetUtilityString(IconUrl)).value_or("");
-                    if (iconEntry.Url.empty())
+                while (auto iconName = reader.NextMember())
+                {
+                    if (*iconName == IconUrl)
                     {
-                        continue;
+                        iconEntry.Url = reader.ReadString().value_or("");
                     }
-
-                    auto fileType = JSON::GetRawStringValueFromJsonNode(iconNode, JSON::GetUtilityString(IconFileType)).value_or("");
-                    if (fileType.empty())
+                    else if (*iconName == IconFileType)
                     {
-                        continue;
+                        fileType = reader.ReadString().value_or("");
                     }
-
-                    iconEntry.FileType = Manifest::ConvertToIconFileTypeEnum(fileType);
-                    iconEntry.Resolution = Manifest::ConvertToIconResolutionEnum(JSON::GetRawStringValueFromJsonNode(iconNode, JSON::GetUtilityString(IconResolution)).value_or(""));
-                    iconEntry.Theme = Manifest::ConvertToIconThemeEnum(JSON::GetRawStringValueFromJsonNode(iconNode, JSON::GetUtilityString(IconTheme)).value_or(""));
-
-                    std::optional<std::string> sha256 = JSON::GetRawStringValueFromJsonNode(iconNode, JSON::GetUtilityString(IconSha256));
-                    if (JSON::IsValidNonEmptyStringValue(sha256))
+                    else if (*iconName == IconResolution)
+                    {
+                        iconEntry.Resolution = Manifest::ConvertToIconResolutionEnum(reader.ReadString().value_or(""));
+                    }
+                    else if (*iconName == IconTheme)
+                    {
+                        iconEntry.Theme = Manifest::ConvertToIconThemeEnum(reader.ReadString().value_or(""));
+                    }
+                    else if (*iconName == IconSha256)
                     {
-                        iconEntry.Sha256 = Utility::SHA256::ConvertToBytes(*sha256);
+                        sha256 = reader.ReadString();
                     }
+                    else
+                    {
+                        reader.SkipValue();
+                    }
+                }
 
-                    icons.emplace_back(std::move(iconEntry));
+                if (iconEntry.Url.empty() || fileType.empty())
+                {
+                    continue;
                 }
 
-                if (!icons.empty())
+                iconEntry.FileType = Manifest::ConvertToIconFileTypeEnum(fileType);
+
+                if (JSON::IsValidNonEmptyStringValue(sha256))
                 {
-                    locale.Add<Manifest::Localization::Icons>(std::move(icons));
+                    iconEntry.Sha256 = Utility::SHA256::ConvertToBytes(*sha256);
                 }
+
+                icons.emplace_back(std::move(iconEntry));
             }
         }
 
-        return result;
+        if (!icons.empty())
+        {
+            locale.Add<Manifest::Localization::Icons>(std::move(icons));
+        }
     }
 }
@@ -66,6 +66,18 @@ namespace AppInstaller::Repository::Rest::Schema
         return ValidateAndExtractResponse(httpResponse);
     }
 
+    std::optional<std::string> HttpClientHelper::HandlePostUtf8(
+        const utility::string_t& uri, const web::json::value& body, const std::unordered_map<utility::string_t, utility::string_t>& headers) const
+    {
+        web::http::http_response httpResponse;
+        HttpClientHelper::Post(uri, body, headers).then([&httpResponse](const web::http::http_response& response)
+            {
+                httpResponse = response;
+            }).wait();
+
+        return ValidateAndExtractUtf8Response(httpResponse);
+    }
+
     pplx::task<web::http::http_response> HttpClientHelper::Get(
         const utility::string_t& uri, const std::unordered_map<utility::string_t, utility::string_t>& headers) const
     {
@@ -98,6 +110,18 @@ namespace AppInstaller::Repository::Rest::Schema
         return ValidateAndExtractResponse(httpResponse);
     }
 
+    std::optional<std::string> HttpClientHelper::HandleGetUtf8(
+        const utility::string_t& uri, const std::unordered_map<utility::string_t, utility::string_t>& headers) const
+    {
+        web::http::http_response httpResponse;
+        Get(uri, headers).then([&httpResponse](const web::http::http_response& response)
+            {
+                httpResponse = response;
+            }).wait();
+
+        return ValidateAndExtractUtf8Response(httpResponse);
+    }
+
     void HttpClientHelper::SetPinningConfiguration(const Certificates::PinningConfiguration& configuration)
     {
         m_clientConfig.set_nativehandle_servercertificate_validation([pinConfig = configuration](web::http::client::native_handle handle)
@@ -120,37 +144,49 @@ namespace AppInstaller::Repository::Rest::Schema
     }
 
     std::optional<web::json::value> HttpClientHelper::ValidateAndExtractResponse(const web::http::http_response& response) const
+    {
+        if (!ValidateResponse(response))
+        {
+            return {};
+        }
+
+        return ExtractJsonResponse(response);
+    }
+
+    std::optional<std::string> HttpClientHelper::ValidateAndExtractUtf8Response(const web::http::http_response& response) const
+    {
+        if (!ValidateResponse(response))
+        {
+            return {};
+        }
+
+        return ExtractUtf8Response(response);
+    }
+
+    bool HttpClientHelper::ValidateResponse(const web::http::http_response& response) const
     {
         AICLI_LOG(Repo, Info, << "Response status: " << response.status_code());
         // Ensure that we wait for the content to be ready before we log it; otherwise it will be truncated.
         AICLI_LOG_LARGE_STRING(Repo, Verbose, << "Response details:",
             response.content_ready().then([&](const web::http::http_response&) { return utility::conversions::to_utf8string(response.to_string()); }).get());
 
-        std::optional<web::json::value> result;
         switch (response.status_code())
         {
         case web::http::status_codes::OK:
-            result = ExtractJsonResponse(response);
-            break;
+            return true;
 
         case web::http::status_codes::NotFound:
             THROW_HR(APPINSTALLER_CLI_ERROR_RESTSOURCE_ENDPOINT_NOT_FOUND);
-            break;
 
         case web::http::status_codes::NoContent:
-            result = {};
-            break;
+            return false;
 
         case web::http::status_codes::BadRequest:
             THROW_HR(APPINSTALLER_CLI_ERROR_RESTSOURCE_INTERNAL_ERROR);
-            break;
 
         default:
             THROW_HR(MAKE_HRESULT(SEVERITY_ERROR, FACILITY_HTTP, response.status_code()));
-            break;
         }
-
-        return result;
     }
 
     std::optional<web::json::value> HttpClientHelper::ExtractJsonResponse(const web::http::http_response& response) const
@@ -162,4 +198,15 @@ namespace AppInstaller::Repository::Rest::Schema
 
         return response.extract_json().get();
     }
+
+    std::string HttpClientHelper::ExtractUtf8Response(const web::http::http_response& response) const
+    {
+        utility::string_t contentType = response.headers().content_type();
+
+        THROW_HR_IF(APPINSTALLER_CLI_ERROR_RESTSOURCE_UNSUPPORTED_MIME_TYPE,
+            !contentType._Starts_with(web::http::details::mime_types::application_json));
+
+        // Converts from the declared charset if it is not already UTF-8.
+        return response.extract_utf8string().get();
+    }
 }
@@ -19,16 +19,29 @@ namespace AppInstaller::Repository::Rest::Schema
 
         std::optional<web::json::value> HandlePost(const utility::string_t& uri, const web::json::value& body, const std::unordered_map<utility::string_t, utility::string_t>& headers = {}) const;
 
+        // Same as HandlePost, but returns the UTF-8 response body without parsing it.
+        std::optional<std::string> HandlePostUtf8(const utility::string_t& uri, const web::json::value& body, const std::unordered_map<utility::string_t, utility::string_t>& headers = {}) const;
+
         pplx::task<web::http::http_response> Get(const utility::string_t& uri, const std::unordered_map<utility::string_t, utility::string_t>& headers = {}) const;
 
         std::optional<web::json::value> HandleGet(const utility::string_t& uri, const std::unordered_map<utility::string_t, utility::string_t>& headers = {}) const;
 
+        // Same as HandleGet, but returns the UTF-8 response body without parsing it.
+        std::optional<std::string> HandleGetUtf8(const utility::string_t& uri, const std::unordered_map<utility::string_t, utility::string_t>& headers = {}) const;
+
         void SetPinningConfiguration(const Certificates::PinningConfiguration& configuration);
     protected:
         std::optional<web::json::value> ValidateAndExtractResponse(const web::http::http_response& response) const;
 
+        std::optional<std::string> ValidateAndExtractUtf8Response(const web::http::http_response& response) const;
+
         std::optional<web::json::value> ExtractJsonResponse(const web::http::http_response& response) const;
 
+        std::string ExtractUtf8Response(const web::http::http_response& response) const;
+
+        // Returns true if the response has content to extract; throws for error status codes.
+        bool ValidateResponse(const web::http::http_response& response) const;
+
     private:
         web::http::client::http_client GetClient(const utility::string_t& uri) const;
 
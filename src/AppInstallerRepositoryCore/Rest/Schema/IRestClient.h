@@ -5,6 +5,8 @@
 #include <winget/Manifest.h>
 #include <winget/RepositorySearch.h>
 #include <AppInstallerVersions.h>
+#include <functional>
+#include <mutex>
 #include <vector>
 
 namespace AppInstaller::Repository::Rest::Schema
@@ -24,18 +26,52 @@ namespace AppInstaller::Repository::Rest::Schema
         : PackageIdentifier(std::move(packageIdentifier)), PackageName(std::move(packageName)), Publisher(std::move(publisher)) {}
     };
 
+    // A manifest that is only deserialized when it is first used.
+    // Shared between the copies of a VersionInfo so that the work is done at most once.
+    struct LazyManifest
+    {
+        LazyManifest(Manifest::Manifest manifest) : m_manifest(std::move(manifest)) {}
+        LazyManifest(std::function<Manifest::Manifest()> deserialize) : m_deserialize(std::move(deserialize)) {}
+
+        LazyManifest(const LazyManifest&) = delete;
+        LazyManifest& operator=(const LazyManifest&) = delete;
+
+        // Gets the manifest, deserializing it on the first call.
+        const Manifest::SharedManifest& GetShared() const
+        {
+            std::lock_guard<std::mutex> lock{ m_lock };
+
+            if (!m_manifest)
+            {
+                m_manifest = m_deserialize();
+                // Release anything held for the deserialization, such as the response body.
+                m_deserialize = nullptr;
+            }
+
+            return m_manifest.value();
+        }
+
+        const Manifest::Manifest& Get() const { return GetShared().Get(); }
+
+    private:
+        mutable std::mutex m_lock;
+        mutable std::function<Manifest::Manifest()> m_deserialize;
+        mutable std::optional<Manifest::SharedManifest> m_manifest;
+    };
+
     // NOTE: When changes are made to VersionInfo struct, remember to update the OptimizedSearch path in RestInterface1_0
-    // where VersionInfo struct was directly created from manifest.
+    // where VersionInfo struct was directly created from the manifest response.
+    // When the system reference lists are empty and a manifest is present, the values are taken from the manifest.
     struct VersionInfo
     {
         AppInstaller::Utility::VersionAndChannel VersionAndChannel;
-        std::optional<Manifest::Manifest> Manifest;
+        std::shared_ptr<const LazyManifest> Manifest;
         std::vector<std::string> PackageFamilyNames;
         std::vector<std::string> ProductCodes;
         std::vector<AppInstaller::Utility::Version> ArpVersions;
         std::vector<std::string> UpgradeCodes;
 
-        VersionInfo(AppInstaller::Utility::VersionAndChannel versionAndChannel, std::optional<Manifest::Manifest> manifest, std::vector<std::string> packageFamilyNames = {}, std::vector<std::string> productCodes = {}, std::vector<AppInstaller::Utility::Version> arpVersions = {}, std::vector<std::string> upgradeCodes = {})
+        VersionInfo(AppInstaller::Utility::VersionAndChannel versionAndChannel, std::shared_ptr<const LazyManifest> manifest, std::vector<std::string> packageFamilyNames = {}, std::vector<std::string> productCodes = {}, std::vector<AppInstaller::Utility::Version> arpVersions = {}, std::vector<std::string> upgradeCodes = {})
             : VersionAndChannel(std::move(versionAndChannel)), Manifest(std::move(manifest)), PackageFamilyNames(std::move(packageFamilyNames)), ProductCodes(std::move(productCodes)), ArpVersions(std::move(arpVersions)), UpgradeCodes(std::move(upgradeCodes)) {}
     };
 
@@ -55,6 +91,15 @@ namespace AppInstaller::Repository::Rest::Schema
         bool Truncated = false;
     };
 
+    // A single page of a search endpoint response.
+    struct SearchResponse
+    {
+        SearchResult Result;
+        std::string ContinuationToken;
+        std::vector<std::string> UnsupportedPackageMatchFields;
+        std::vector<std::string> RequiredPackageMatchFields;
+    };
+
     struct SourceAgreementEntry
     {
         std::string Label;
@@ -42,8 +42,8 @@ namespace AppInstaller::Repository::Rest::Schema
         }
     }
 
-    IRestClient::SearchResult SearchResponseParser::Deserialize(const web::json::value& searchResultJsonObject) const
+    IRestClient::SearchResponse SearchResponseParser::Deserialize(std::string_view searchResponse) const
     {
-        return m_pImpl->m_deserializer->Deserialize(searchResultJsonObject);
+        return m_pImpl->m_deserializer->Deserialize(searchResponse);
     }
 }
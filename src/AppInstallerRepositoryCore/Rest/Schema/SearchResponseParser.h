@@ -2,7 +2,6 @@
 // Licensed under the MIT License.
 #pragma once
 #include <AppInstallerVersions.h>
-#include <winget/JsonUtil.h>
 #include "Rest/Schema/IRestClient.h"
 
 #include <memory>
@@ -10,7 +9,7 @@
 
 namespace AppInstaller::Repository::Rest::Schema
 {
-    // Exposes functions for parsing JSON REST responses to IRestClient SearchResult.
+    // Exposes functions for parsing JSON REST responses to IRestClient SearchResponse.
     struct SearchResponseParser
     {
         SearchResponseParser(const Utility::Version& schemaVersion);
@@ -23,8 +22,8 @@ namespace AppInstaller::Repository::Rest::Schema
 
         ~SearchResponseParser();
 
-        // Gets the search result for response object
-        IRestClient::SearchResult Deserialize(const web::json::value& searchResultJsonObject) const;
+        // Gets the search response from the UTF-8 JSON response body.
+        IRestClient::SearchResponse Deserialize(std::string_view searchResponse) const;
 
     private:
         struct impl;
@@ -649,6 +649,12 @@ namespace AppInstaller::Repository::SQLite::Builder
         return *this;
     }
 
+    StatementBuilder& StatementBuilder::WithoutRowID()
+    {
+        m_stream << " WITHOUT ROWID";
+        return *this;
+    }
+
     StatementBuilder& StatementBuilder::AlterTable(std::string_view table)
     {
         OutputOperationAndTable(m_stream, "ALTER TABLE", table);
@@ -345,6 +345,10 @@ namespace AppInstaller::Repository::SQLite::Builder
         StatementBuilder& CreateTable(QualifiedTable table);
         StatementBuilder& CreateTable(std::initializer_list<std::string_view> table);
 
+        // Stores the table being created in its primary key index rather than by rowid.
+        // Must follow the columns of a table creation statement that includes a primary key.
+        StatementBuilder& WithoutRowID();
+
         // Begin an alter table statement.
         // The initializer_list form enables the table name to be constructed from multiple parts.
         StatementBuilder& AlterTable(std::string_view table);
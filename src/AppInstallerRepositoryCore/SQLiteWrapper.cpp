@@ -188,7 +188,7 @@ namespace AppInstaller::Repository::SQLite
     {
         m_connectionId = connection.GetID();
         m_id = GetNextStatementId();
-        AICLI_LOG(SQL, Verbose, << "Preparing statement #" << m_connectionId << '-' << m_id << ": " << sql);
+        AICLI_LOG_FORMAT(SQL, Verbose, "Preparing statement #{}-{}: {}", m_connectionId, m_id, sql);
         // SQL string size should include the null terminator (https://www.sqlite.org/c3ref/prepare.html)
         assert(sql.data()[sql.size()] == '\0');
         THROW_IF_SQLITE_FAILED(sqlite3_prepare_v2(connection, sql.data(), static_cast<int>(sql.size() + 1), &m_stmt, nullptr), connection);
@@ -254,18 +254,18 @@ namespace AppInstaller::Repository::SQLite
 
     bool Statement::Step(bool failFastOnError)
     {
-        AICLI_LOG(SQL, Verbose, << "Stepping statement #" << m_connectionId << '-' << m_id);
+        AICLI_LOG_FORMAT(SQL, Verbose, "Stepping statement #{}-{}", m_connectionId, m_id);
         int result = sqlite3_step(m_stmt.get());
 
         if (result == SQLITE_ROW)
         {
-            AICLI_LOG(SQL, Verbose, << "Statement #" << m_connectionId << '-' << m_id << " has data");
+            AICLI_LOG_FORMAT(SQL, Verbose, "Statement #{}-{} has data", m_connectionId, m_id);
             m_state = State::HasRow;
             return true;
         }
         else if (result == SQLITE_DONE)
         {
-            AICLI_LOG(SQL, Verbose, << "Statement #" << m_connectionId << '-' << m_id << " has completed");
+            AICLI_LOG_FORMAT(SQL, Verbose, "Statement #{}-{} has completed", m_connectionId, m_id);
             m_state = State::Completed;
             return false;
         }
@@ -296,7 +296,7 @@ namespace AppInstaller::Repository::SQLite
 
     void Statement::Reset()
     {
-        AICLI_LOG(SQL, Verbose, << "Reset statement #" << m_connectionId << '-' << m_id);
+        AICLI_LOG_FORMAT(SQL, Verbose, "Reset statement #{}-{}", m_connectionId, m_id);
         // Ignore return value from reset, as if it is an error, it was the error from the last call to step.
         sqlite3_reset(m_stmt.get());
         m_state = State::Prepared;
@@ -311,7 +311,7 @@ namespace AppInstaller::Repository::SQLite
         m_rollbackTo = Statement::Create(connection, "ROLLBACK TO ["s + m_name + "]");
         m_release = Statement::Create(connection, "RELEASE ["s + m_name + "]");
 
-        AICLI_LOG(SQL, Verbose, << "Begin savepoint: " << m_name);
+        AICLI_LOG_FORMAT(SQL, Verbose, "Begin savepoint: {}", m_name);
         begin.Step();
     }
 
@@ -329,7 +329,7 @@ namespace AppInstaller::Repository::SQLite
     {
         if (m_inProgress)
         {
-            AICLI_LOG(SQL, Verbose, << "Roll back savepoint: " << m_name);
+            AICLI_LOG_FORMAT(SQL, Verbose, "Roll back savepoint: {}", m_name);
             m_rollbackTo.Step(true);
             // 'ROLLBACK TO' *DOES NOT* remove the savepoint from the transaction stack.
             // In order to remove it, we must RELEASE. Since we just invoked a ROLLBACK TO
@@ -343,7 +343,7 @@ namespace AppInstaller::Repository::SQLite
     {
         if (m_inProgress)
         {
-            AICLI_LOG(SQL, Verbose, << "Commit savepoint: " << m_name);
+            AICLI_LOG_FORMAT(SQL, Verbose, "Commit savepoint: {}", m_name);
             m_release.Step(true);
             m_inProgress = false;
         }
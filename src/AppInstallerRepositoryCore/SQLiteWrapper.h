@@ -227,7 +227,7 @@ namespace AppInstaller::Repository::SQLite
         template <typename Value>
         void Bind(int index, Value&& v)
         {
-            AICLI_LOG(SQL, Verbose, << "Binding statement #" << m_connectionId << '-' << m_id << ": " << index << " => " << details::ParameterSpecifics<Value>::ToLog(std::forward<Value>(v)));
+            AICLI_LOG_FORMAT(SQL, Verbose, "Binding statement #{}-{}: {} => {}", m_connectionId, m_id, index, details::ParameterSpecifics<Value>::ToLog(std::forward<Value>(v)));
             details::ParameterSpecifics<Value>::Bind(m_stmt.get(), index, std::forward<Value>(v));
         }
 
@@ -30,6 +30,8 @@ namespace AppInstaller::Repository
         constexpr std::string_view s_MetadataYaml_Source_LastUpdate = "LastUpdate"sv;
         constexpr std::string_view s_MetadataYaml_Source_AcceptedAgreementsIdentifier = "AcceptedAgreementsIdentifier"sv;
         constexpr std::string_view s_MetadataYaml_Source_AcceptedAgreementFields = "AcceptedAgreementFields"sv;
+        constexpr std::string_view s_MetadataYaml_Source_InformationCache = "InformationCache"sv;
+        constexpr std::string_view s_MetadataYaml_Source_InformationCacheTime = "InformationCacheTime"sv;
 
         constexpr std::string_view s_Source_WingetCommunityDefault_Name = "winget"sv;
         constexpr std::string_view s_Source_WingetCommunityDefault_Arg = "https://cdn.winget.microsoft.com/cache"sv;
@@ -208,6 +210,13 @@ namespace AppInstaller::Repository
         target.LastUpdateTime = LastUpdateTime;
         target.AcceptedAgreementFields = AcceptedAgreementFields;
         target.AcceptedAgreementsIdentifier = AcceptedAgreementsIdentifier;
+
+        // The information cache is written independently of the other metadata, so keep whichever is newer.
+        if (InformationCacheTime >= target.InformationCacheTime)
+        {
+            target.InformationCache = InformationCache;
+            target.InformationCacheTime = InformationCacheTime;
+        }
     }
 
     std::string_view GetWellKnownSourceName(WellKnownSource source)
@@ -715,6 +724,12 @@ namespace AppInstaller::Repository
                 details.LastUpdateTime = Utility::ConvertUnixEpochToSystemClock(lastUpdateInEpoch);
                 TryReadScalar(name, settingValue, source, s_MetadataYaml_Source_AcceptedAgreementsIdentifier, details.AcceptedAgreementsIdentifier, false);
                 TryReadScalar(name, settingValue, source, s_MetadataYaml_Source_AcceptedAgreementFields, details.AcceptedAgreementFields, false);
+                if (TryReadScalar(name, settingValue, source, s_MetadataYaml_Source_InformationCache, details.InformationCache, false))
+                {
+                    int64_t informationCacheTimeInEpoch{};
+                    TryReadScalar(name, settingValue, source, s_MetadataYaml_Source_InformationCacheTime, informationCacheTimeInEpoch, false);
+                    details.InformationCacheTime = Utility::ConvertUnixEpochToSystemClock(informationCacheTimeInEpoch);
+                }
                 return true;
             });
     }
@@ -733,6 +748,11 @@ namespace AppInstaller::Repository
             out << YAML::Key << s_MetadataYaml_Source_LastUpdate << YAML::Value << Utility::ConvertSystemClockToUnixEpoch(details.LastUpdateTime);
             out << YAML::Key << s_MetadataYaml_Source_AcceptedAgreementsIdentifier << YAML::Value << details.AcceptedAgreementsIdentifier;
             out << YAML::Key << s_MetadataYaml_Source_AcceptedAgreementFields << YAML::Value << details.AcceptedAgreementFields;
+            if (!details.InformationCache.empty())
+            {
+                out << YAML::Key << s_MetadataYaml_Source_InformationCache << YAML::Value << details.InformationCache;
+                out << YAML::Key << s_MetadataYaml_Source_InformationCacheTime << YAML::Value << Utility::ConvertSystemClockToUnixEpoch(details.InformationCacheTime);
+            }
             out << YAML::EndMap;
         }
 
@@ -13,6 +13,13 @@ namespace AppInstaller::Repository
     std::string_view GetWellKnownSourceIdentifier(WellKnownSource source);
     std::optional<WellKnownSource> CheckForWellKnownSourceMatch(std::string_view name, std::string_view arg, std::string_view type);
 
+    // Determines whether (and logs why) a source should be updated before it is opened.
+    bool ShouldUpdateBeforeOpen(const SourceDetails& details);
+
+    // Updates the source in the background mode of its factory, setting the update time in details if successful.
+    // The caller is responsible for saving the update time to the source metadata.
+    bool BackgroundUpdateSourceFromDetails(SourceDetails& details, IProgressCallback& progress);
+
     // SourceDetails with additional data used internally.
     struct SourceDetailsInternal : public SourceDetails
     {
@@ -0,0 +1,294 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+#include "pch.h"
+#include "winget/SourceUpdateScheduler.h"
+#include "winget/OpenedSourceCache.h"
+#include "SourceList.h"
+
+#include <random>
+
+using namespace AppInstaller::Settings;
+using namespace std::chrono_literals;
+using namespace std::string_literals;
+
+namespace AppInstaller::Repository
+{
+    namespace
+    {
+        // The interval is extended by up to 1/s_JitterDivisor of itself.
+        constexpr int64_t s_JitterDivisor = 4;
+
+        // Used to coalesce updates of the same source across processes; it is separate from any lock
+        // taken by the source itself, which is held only for the duration of the update.
+        std::string GetUpdateLockName(const SourceDetails& details)
+        {
+            std::string result = "WinGetSourceUpdate_"s + (details.Identifier.empty() ? details.Name : details.Identifier);
+            std::replace(result.begin(), result.end(), '\\', '_');
+            return result;
+        }
+    }
+
+    SourceUpdateScheduler::SourceUpdateScheduler() = default;
+
+    SourceUpdateScheduler::~SourceUpdateScheduler() = default;
+
+    SourceUpdateScheduler& SourceUpdateScheduler::Instance()
+    {
+        static SourceUpdateScheduler s_instance;
+        return s_instance;
+    }
+
+    void SourceUpdateScheduler::EnableDeferredUpdates()
+    {
+        m_deferUpdates = User().Get<Setting::AutoUpdateInBackground>();
+    }
+
+    void SourceUpdateScheduler::DisableDeferredUpdates()
+    {
+        m_deferUpdates = false;
+    }
+
+    bool SourceUpdateScheduler::ShouldDeferUpdate(const SourceDetails& details) const
+    {
+        return m_deferUpdates && details.LastUpdateTime > Utility::ConvertUnixEpochToSystemClock(0);
+    }
+
+    void SourceUpdateScheduler::Schedule(const SourceDetails& details)
+    {
+        {
+            std::lock_guard<std::mutex> lock{ m_lock };
+
+            if (m_stopping)
+            {
+                return;
+            }
+
+            if (std::any_of(m_pending.begin(), m_pending.end(), [&](const SourceDetails& pending) { return pending.Name == details.Name; }))
+            {
+                return;
+            }
+
+            AICLI_LOG(Repo, Info, << "Scheduling update of source: " << details.Name);
+            m_pending.emplace_back(details);
+        }
+
+        if (m_runOnThreadPool)
+        {
+            SubmitThreadpoolWork(m_work.get());
+        }
+    }
+
+    void SourceUpdateScheduler::RunPending()
+    {
+        std::lock_guard<std::mutex> runLock{ m_runLock };
+
+        for (;;)
+        {
+            SourceDetails details;
+
+            {
+                std::lock_guard<std::mutex> lock{ m_lock };
+
+                if (m_stopping || m_pending.empty())
+                {
+                    return;
+                }
+
+                details = std::move(m_pending.front());
+                m_pending.pop_front();
+            }
+
+            RunUpdate(details);
+        }
+    }
+
+    std::vector<SourceDetails> SourceUpdateScheduler::TakePending()
+    {
+        std::lock_guard<std::mutex> lock{ m_lock };
+
+        std::vector<SourceDetails> result{ std::make_move_iterator(m_pending.begin()), std::make_move_iterator(m_pending.end()) };
+        m_pending.clear();
+
+        return result;
+    }
+
+    void SourceUpdateScheduler::EnablePeriodicUpdates()
+    {
+        EnableDeferredUpdates();
+
+        if (!m_deferUpdates)
+        {
+            return;
+        }
+
+        std::lock_guard<std::mutex> lock{ m_lock };
+
+        if (m_stopping || m_work)
+        {
+            return;
+        }
+
+        m_work.reset(CreateThreadpoolWork(RunPendingCallback, this, nullptr));
+        if (!m_work)
+        {
+            // Sources are still updated before they are opened.
+            LOG_LAST_ERROR();
+            m_deferUpdates = false;
+            return;
+        }
+
+        m_runOnThreadPool = true;
+
+        m_timer.reset(CreateThreadpoolTimer(TimerCallback, this, nullptr));
+        if (!m_timer)
+        {
+            // Sources are still updated when found to be out of date by an operation.
+            LOG_LAST_ERROR();
+            return;
+        }
+
+        SetTimer();
+    }
+
+    void SourceUpdateScheduler::Shutdown()
+    {
+        {
+            std::lock_guard<std::mutex> lock{ m_lock };
+            m_stopping = true;
+
+            if (m_runningProgress)
+            {
+                m_runningProgress->Cancel();
+            }
+        }
+
+        m_runOnThreadPool = false;
+
+        // Neither is recreated once stopping, so they can be used without the lock.
+        if (m_timer)
+        {
+            SetThreadpoolTimer(m_timer.get(), nullptr, 0, 0);
+            WaitForThreadpoolTimerCallbacks(m_timer.get(), TRUE);
+        }
+
+        if (m_work)
+        {
+            WaitForThreadpoolWorkCallbacks(m_work.get(), TRUE);
+        }
+    }
+
+    std::chrono::milliseconds SourceUpdateScheduler::AddJitter(std::chrono::milliseconds interval)
+    {
+        static thread_local std::mt19937_64 s_random{ std::random_device{}() };
+
+        std::uniform_int_distribution<int64_t> distribution{ 0, interval.count() / s_JitterDivisor };
+        return interval + std::chrono::milliseconds{ distribution(s_random) };
+    }
+
+    void CALLBACK SourceUpdateScheduler::RunPendingCallback(PTP_CALLBACK_INSTANCE, PVOID context, PTP_WORK)
+    {
+        static_cast<SourceUpdateScheduler*>(context)->RunPending();
+    }
+
+    void CALLBACK SourceUpdateScheduler::TimerCallback(PTP_CALLBACK_INSTANCE, PVOID context, PTP_TIMER)
+    {
+        auto scheduler = static_cast<SourceUpdateScheduler*>(context);
+
+        scheduler->ScheduleOutOfDateSources();
+
+        std::lock_guard<std::mutex> lock{ scheduler->m_lock };
+        if (!scheduler->m_stopping)
+        {
+            scheduler->SetTimer();
+        }
+    }
+
+    void SourceUpdateScheduler::RunUpdate(const SourceDetails& scheduled) try
+    {
+        // If another process is updating the source, leave the update to it.
+        auto updateLock = Synchronization::CrossProcessReaderWriteLock::LockExclusive(GetUpdateLockName(scheduled), 0ms);
+        if (!updateLock)
+        {
+            AICLI_LOG(Repo, Info, << "Source is being updated by another process: " << scheduled.Name);
+            return;
+        }
+
+        // Read the current state, as another process may have updated (or removed) the source since this was scheduled.
+        SourceList sourceList;
+        auto details = sourceList.GetCurrentSource(scheduled.Name);
+        if (!details || details->Identifier != scheduled.Identifier || !ShouldUpdateBeforeOpen(*details))
+        {
+            AICLI_LOG(Repo, Info, << "Source no longer needs to be updated: " << scheduled.Name);
+            return;
+        }
+
+        ProgressCallback progress;
+        {
+            std::lock_guard<std::mutex> lock{ m_lock };
+            if (m_stopping)
+            {
+                return;
+            }
+
+            m_runningProgress = &progress;
+        }
+
+        auto clearRunningProgress = wil::scope_exit([&]()
+            {
+                std::lock_guard<std::mutex> lock{ m_lock };
+                m_runningProgress = nullptr;
+            });
+
+        SourceDetails updateDetails = *details;
+
+        if (BackgroundUpdateSourceFromDetails(updateDetails, progress))
+        {
+            details->LastUpdateTime = updateDetails.LastUpdateTime;
+            sourceList.SaveMetadata(*details);
+            OpenedSourceCache::Instance().Invalidate(details->Identifier);
+        }
+        else
+        {
+            AICLI_LOG(Repo, Warning, << "Failed to update source: " << scheduled.Name);
+        }
+    }
+    CATCH_LOG();
+
+    void SourceUpdateScheduler::ScheduleOutOfDateSources() try
+    {
+        SourceList sourceList;
+
+        for (const auto& details : sourceList.GetCurrentSourceRefs())
+        {
+            if (ShouldUpdateBeforeOpen(details.get()))
+            {
+                Schedule(details.get());
+            }
+        }
+    }
+    CATCH_LOG();
+
+    // *Must be called while holding m_lock*
+    void SourceUpdateScheduler::SetTimer()
+    {
+        auto interval = User().Get<Setting::AutoUpdateTimeInMinutes>();
+
+        // Automatic updates are disabled.
+        if (interval == 0min)
+        {
+            return;
+        }
+
+        auto dueIn = AddJitter(std::chrono::duration_cast<std::chrono::milliseconds>(interval));
+
+        // A negative due time is relative, in 100 nanosecond units.
+        ULARGE_INTEGER dueTimeValue;
+        dueTimeValue.QuadPart = static_cast<ULONGLONG>(-std::chrono::duration_cast<std::chrono::duration<int64_t, std::ratio<1, 10'000'000>>>(dueIn).count());
+
+        FILETIME dueTime;
+        dueTime.dwLowDateTime = dueTimeValue.LowPart;
+        dueTime.dwHighDateTime = dueTimeValue.HighPart;
+
+        SetThreadpoolTimer(m_timer.get(), &dueTime, 0, 0);
+    }
+}
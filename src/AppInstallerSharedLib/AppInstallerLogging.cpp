@@ -75,6 +75,7 @@ namespace AppInstaller::Logging
             {
                 result = std::move(*i);
                 m_loggers.erase(i);
+                result->Shutdown();
                 break;
             }
         }
@@ -84,9 +85,26 @@ namespace AppInstaller::Logging
 
     void DiagnosticLogger::RemoveAllLoggers()
     {
+        Shutdown();
         m_loggers.clear();
     }
 
+    void DiagnosticLogger::Flush()
+    {
+        for (auto& logger : m_loggers)
+        {
+            logger->Flush();
+        }
+    }
+
+    void DiagnosticLogger::Shutdown()
+    {
+        for (auto& logger : m_loggers)
+        {
+            logger->Shutdown();
+        }
+    }
+
     void DiagnosticLogger::EnableChannel(Channel channel)
     {
         m_enabledChannels |= ConvertChannelToBitmask(channel);
@@ -140,6 +158,169 @@ namespace AppInstaller::Logging
         }
     }
 
+    void DiagnosticLogger::WriteFormatted(Channel channel, Level level, const LogFormatRecord& record)
+    {
+        THROW_HR_IF_MSG(E_INVALIDARG, channel == Channel::All, "Cannot write to all channels");
+
+        if (IsEnabled(channel, level))
+        {
+            for (auto& logger : m_loggers)
+            {
+                logger->WriteFormatted(channel, level, record);
+            }
+        }
+    }
+
+    void LogFormatRecord::AddArgument(std::string_view value)
+    {
+        Argument* argument = NextArgument();
+        if (!argument)
+        {
+            return;
+        }
+
+        argument->Type = ArgumentType::String;
+        argument->String.Length = static_cast<uint32_t>(value.length());
+
+        if (value.length() <= StringBufferSize - m_stringBufferUsed)
+        {
+            argument->String.Offset = static_cast<uint32_t>(m_stringBufferUsed);
+            argument->String.InOverflow = false;
+            std::copy(value.begin(), value.end(), m_stringBuffer.begin() + m_stringBufferUsed);
+            m_stringBufferUsed += value.length();
+        }
+        else
+        {
+            argument->String.Offset = static_cast<uint32_t>(m_stringOverflow.length());
+            argument->String.InOverflow = true;
+            m_stringOverflow.append(value);
+        }
+    }
+
+    void LogFormatRecord::AddArgument(bool value)
+    {
+        if (Argument* argument = NextArgument())
+        {
+            argument->Type = ArgumentType::Bool;
+            argument->Bool = value;
+        }
+    }
+
+    void LogFormatRecord::AddArgument(double value)
+    {
+        if (Argument* argument = NextArgument())
+        {
+            argument->Type = ArgumentType::Double;
+            argument->Double = value;
+        }
+    }
+
+    void LogFormatRecord::AddSigned(int64_t value)
+    {
+        if (Argument* argument = NextArgument())
+        {
+            argument->Type = ArgumentType::Signed;
+            argument->Signed = value;
+        }
+    }
+
+    void LogFormatRecord::AddUnsigned(uint64_t value)
+    {
+        if (Argument* argument = NextArgument())
+        {
+            argument->Type = ArgumentType::Unsigned;
+            argument->Unsigned = value;
+        }
+    }
+
+    LogFormatRecord::Argument* LogFormatRecord::NextArgument()
+    {
+        // Arguments beyond the maximum are dropped, the same as arguments without a placeholder.
+        if (m_argumentCount >= MaxArguments)
+        {
+            return nullptr;
+        }
+
+        return &m_arguments[m_argumentCount++];
+    }
+
+    std::string LogFormatRecord::ToString() const
+    {
+        std::string result;
+        result.reserve(m_format.length() + m_stringBufferUsed + m_stringOverflow.length() + 16 * m_argumentCount);
+        AppendTo(result);
+        return result;
+    }
+
+    void LogFormatRecord::AppendTo(std::string& out) const
+    {
+        size_t nextArgument = 0;
+        size_t pos = 0;
+
+        while (pos < m_format.length())
+        {
+            size_t special = m_format.find_first_of("{}", pos);
+            if (special == std::string_view::npos)
+            {
+                out.append(m_format.substr(pos));
+                break;
+            }
+
+            out.append(m_format.substr(pos, special - pos));
+
+            char current = m_format[special];
+            char next = (special + 1 < m_format.length() ? m_format[special + 1] : '\0');
+
+            if (current == '{' && next == '}' && nextArgument < m_argumentCount)
+            {
+                AppendArgument(out, m_arguments[nextArgument++]);
+                pos = special + 2;
+            }
+            else if (current == next)
+            {
+                // Escaped {{ or }}
+                out.push_back(current);
+                pos = special + 2;
+            }
+            else
+            {
+                out.push_back(current);
+                pos = special + 1;
+            }
+        }
+    }
+
+    void LogFormatRecord::AppendArgument(std::string& out, const Argument& argument) const
+    {
+        char buffer[32];
+
+        switch (argument.Type)
+        {
+        case ArgumentType::Signed:
+            out.append(buffer, std::to_chars(std::begin(buffer), std::end(buffer), argument.Signed).ptr);
+            break;
+        case ArgumentType::Unsigned:
+            out.append(buffer, std::to_chars(std::begin(buffer), std::end(buffer), argument.Unsigned).ptr);
+            break;
+        case ArgumentType::Double:
+            out.append(buffer, std::to_chars(std::begin(buffer), std::end(buffer), argument.Double).ptr);
+            break;
+        case ArgumentType::Bool:
+            out.push_back(argument.Bool ? '1' : '0');
+            break;
+        case ArgumentType::String:
+            if (argument.String.InOverflow)
+            {
+                out.append(m_stringOverflow, argument.String.Offset, argument.String.Length);
+            }
+            else
+            {
+                out.append(m_stringBuffer.data() + argument.String.Offset, argument.String.Length);
+            }
+            break;
+        }
+    }
+
     DiagnosticLogger& Log()
     {
         ThreadLocalStorage::ThreadGlobals* pThreadGlobals = ThreadLocalStorage::ThreadGlobals::GetForCurrentThread();
@@ -2,7 +2,10 @@
 // Licensed under the MIT License.
 #pragma once
 
+#include <array>
+#include <charconv>
 #include <chrono>
+#include <cstdint>
 #include <filesystem>
 #include <memory>
 #include <sstream>
@@ -40,6 +43,23 @@
         } \
     } while (0, 0)
 
+// Logs using a format string, where each {} is replaced by the next argument.
+// The arguments are captured into a fixed size record without any stream or string construction,
+// and formatting is deferred to the logger (which may do it on a background thread).
+// The format string must be a string literal; arguments may be strings, integers, floating point or bool.
+#define AICLI_LOG_FORMAT(_channel_,_level_,_format_,...) \
+    do { \
+        auto _aicli_log_channel = AppInstaller::Logging::Channel:: _channel_; \
+        auto _aicli_log_level = AppInstaller::Logging::Level:: _level_; \
+        auto& _aicli_log_log = AppInstaller::Logging::Log(); \
+        if (_aicli_log_log.IsEnabled(_aicli_log_channel, _aicli_log_level)) \
+        { \
+            AppInstaller::Logging::LogFormatRecord _aicli_log_record{ _format_ }; \
+            _aicli_log_record.AddArguments(__VA_ARGS__); \
+            _aicli_log_log.WriteFormatted(_aicli_log_channel, _aicli_log_level, _aicli_log_record); \
+        } \
+    } while (0, 0)
+
 namespace AppInstaller::Logging
 {
     // The channel that the log is from.
@@ -73,6 +93,109 @@ namespace AppInstaller::Logging
         Crit,
     };
 
+    // A format string and its arguments, captured without allocation for deferred formatting.
+    // String arguments are copied into an inline buffer; only those that do not fit require an allocation.
+    struct LogFormatRecord
+    {
+        static constexpr size_t MaxArguments = 8;
+        static constexpr size_t StringBufferSize = 96;
+
+        LogFormatRecord() = default;
+
+        template <size_t N>
+        LogFormatRecord(const char(&format)[N]) : m_format(format, N - 1) {}
+
+        // Captures the arguments, in order.
+        template <typename... Args>
+        void AddArguments(Args&&... args)
+        {
+            (AddArgument(std::forward<Args>(args)), ...);
+        }
+
+        void AddArgument(std::string_view value);
+        void AddArgument(const char* value) { AddArgument(std::string_view{ value ? value : "(null)" }); }
+        void AddArgument(const std::string& value) { AddArgument(std::string_view{ value }); }
+        void AddArgument(bool value);
+        void AddArgument(double value);
+        void AddArgument(float value) { AddArgument(static_cast<double>(value)); }
+        void AddArgument(std::nullptr_t) { AddArgument(std::string_view{ "null" }); }
+        void AddArgument(const std::filesystem::path& value) { AddArgument(std::string_view{ value.u8string() }); }
+
+        template <typename T>
+        std::enable_if_t<std::is_integral_v<std::decay_t<T>> && !std::is_same_v<std::decay_t<T>, bool> && std::is_signed_v<std::decay_t<T>>> AddArgument(T value)
+        {
+            AddSigned(static_cast<int64_t>(value));
+        }
+
+        template <typename T>
+        std::enable_if_t<std::is_integral_v<std::decay_t<T>> && !std::is_same_v<std::decay_t<T>, bool> && std::is_unsigned_v<std::decay_t<T>>> AddArgument(T value)
+        {
+            AddUnsigned(static_cast<uint64_t>(value));
+        }
+
+        template <typename E>
+        std::enable_if_t<std::is_enum_v<std::decay_t<E>>> AddArgument(E value)
+        {
+            AddArgument(static_cast<std::underlying_type_t<std::decay_t<E>>>(value));
+        }
+
+        // Gets the format string.
+        std::string_view Format() const { return m_format; }
+
+        // Gets the number of captured arguments.
+        size_t ArgumentCount() const { return m_argumentCount; }
+
+        // Produces the formatted string; {{ and }} are output as { and }.
+        // Placeholders without an argument are output unchanged, and extra arguments are ignored.
+        std::string ToString() const;
+
+        // Appends the formatted string to the given output.
+        void AppendTo(std::string& out) const;
+
+    private:
+        enum class ArgumentType : uint8_t
+        {
+            Signed,
+            Unsigned,
+            Double,
+            Bool,
+            String,
+        };
+
+        // The location of a string argument in the inline buffer.
+        struct StringRange
+        {
+            uint32_t Offset;
+            uint32_t Length;
+            bool InOverflow;
+        };
+
+        struct Argument
+        {
+            ArgumentType Type = ArgumentType::Signed;
+            union
+            {
+                int64_t Signed;
+                uint64_t Unsigned;
+                double Double;
+                bool Bool;
+                StringRange String;
+            };
+        };
+
+        Argument* NextArgument();
+        void AddSigned(int64_t value);
+        void AddUnsigned(uint64_t value);
+        void AppendArgument(std::string& out, const Argument& argument) const;
+
+        std::string_view m_format;
+        size_t m_argumentCount = 0;
+        size_t m_stringBufferUsed = 0;
+        std::array<Argument, MaxArguments> m_arguments{};
+        std::array<char, StringBufferSize> m_stringBuffer;
+        std::string m_stringOverflow;
+    };
+
     // The interface that a log target must implement.
     struct ILogger
     {
@@ -86,6 +209,25 @@ namespace AppInstaller::Logging
 
         // Informs the logger of the given log with the intention that no buffering occurs (in winget code).
         virtual void WriteDirect(Channel channel, Level level, std::string_view message) noexcept = 0;
+
+        // Informs the logger of the given formatted log.
+        // Loggers that can defer the formatting should override this; by default it is formatted immediately.
+        virtual void WriteFormatted(Channel channel, Level level, const LogFormatRecord& record) noexcept
+        {
+            try
+            {
+                Write(channel, level, record.ToString());
+            }
+            catch (...) {}
+        }
+
+        // Writes out anything that the logger has buffered, on the calling thread.
+        // This is also called when the process is failing, so it must not wait on other threads that may never finish.
+        virtual void Flush() noexcept {}
+
+        // Writes out anything that the logger has buffered and stops any background work; later logs are still accepted.
+        // This may wait on other threads, so it must not be called while the loader lock is held.
+        virtual void Shutdown() noexcept { Flush(); }
     };
 
     // This type contains the set of loggers that diagnostic logging will be sent to.
@@ -118,12 +260,18 @@ namespace AppInstaller::Logging
         // Determines if a logger with the given name is present.
         bool ContainsLogger(const std::string& name);
 
-        // Removes a logger from the active set, returning it.
+        // Removes a logger from the active set, returning it after shutting it down.
         std::unique_ptr<ILogger> RemoveLogger(const std::string& name);
 
-        // Removes all loggers.
+        // Shuts down and removes all loggers.
         void RemoveAllLoggers();
 
+        // Writes out anything buffered by the loggers; see ILogger::Flush.
+        void Flush();
+
+        // Writes out anything buffered by the loggers and stops their background work; see ILogger::Shutdown.
+        void Shutdown();
+
         // Enables the given channel.
         void EnableChannel(Channel channel);
 
@@ -148,6 +296,9 @@ namespace AppInstaller::Logging
         // Use to make large logs more efficient by writing directly to the output streams.
         void WriteDirect(Channel channel, Level level, std::string_view message);
 
+        // Writes a log line from a format record, if the given channel and level are enabled.
+        void WriteFormatted(Channel channel, Level level, const LogFormatRecord& record);
+
     private:
 
         std::vector<std::unique_ptr<ILogger>> m_loggers;
@@ -160,14 +311,33 @@ namespace AppInstaller::Logging
     // Calls the various stream format functions to produce an 8 character hexadecimal output.
     std::ostream& SetHRFormat(std::ostream& out);
 
+    namespace details
+    {
+        // Types that LoggingStream appends directly, without needing a std::stringstream.
+        template <typename T>
+        constexpr bool IsLoggingStreamString =
+            std::is_same_v<T, std::string> || std::is_same_v<T, std::string_view> ||
+            std::is_same_v<T, const char*> || std::is_same_v<T, char*>;
+
+        template <typename T>
+        constexpr bool IsLoggingStreamInteger =
+            std::is_integral_v<T> && !std::is_same_v<T, bool> && !std::is_same_v<T, char> &&
+            !std::is_same_v<T, signed char> && !std::is_same_v<T, unsigned char> && !std::is_same_v<T, wchar_t> &&
+            !std::is_same_v<T, char16_t> && !std::is_same_v<T, char32_t>;
+    }
+
     // This type allows us to override the default behavior of output operators for logging.
+    // Strings, characters and integers are appended to a string directly; a std::stringstream is only
+    // created when some other type (including a stream manipulator) is output, and is used from then on.
     struct LoggingStream
     {
+        LoggingStream() { m_buffer.reserve(128); }
+
         // Force use of the UTF-8 string from a file path.
         // This should not be necessary when we move to C++20 and convert to using u8string.
         friend AppInstaller::Logging::LoggingStream& operator<<(AppInstaller::Logging::LoggingStream& out, const std::filesystem::path& path)
         {
-            out.m_out << path.u8string();
+            out.Append(path.u8string());
             return out;
         }
 
@@ -176,14 +346,52 @@ namespace AppInstaller::Logging
         friend std::enable_if_t<!std::is_same_v<std::decay_t<T>, std::filesystem::path>, AppInstaller::Logging::LoggingStream&>
             operator<<(AppInstaller::Logging::LoggingStream& out, T&& t)
         {
-            out.m_out << std::forward<T>(t);
+            using value_t = std::decay_t<T>;
+
+            if (out.m_stream)
+            {
+                *out.m_stream << std::forward<T>(t);
+            }
+            else if constexpr (details::IsLoggingStreamString<value_t>)
+            {
+                out.Append(t);
+            }
+            else if constexpr (std::is_same_v<value_t, char>)
+            {
+                out.m_buffer.push_back(t);
+            }
+            else if constexpr (details::IsLoggingStreamInteger<value_t>)
+            {
+                char buffer[24];
+                auto result = std::to_chars(std::begin(buffer), std::end(buffer), t);
+                out.m_buffer.append(buffer, result.ptr);
+            }
+            else
+            {
+                out.GetStream() << std::forward<T>(t);
+            }
+
             return out;
         }
 
-        std::string str() const { return m_out.str(); }
+        std::string str() const { return m_stream ? m_buffer + m_stream->str() : m_buffer; }
 
     private:
-        std::stringstream m_out;
+        void Append(std::string_view value) { m_buffer.append(value); }
+        void Append(const char* value) { m_buffer.append(value ? value : "(null)"); }
+
+        std::ostream& GetStream()
+        {
+            if (!m_stream)
+            {
+                m_stream = std::make_unique<std::stringstream>();
+            }
+
+            return *m_stream;
+        }
+
+        std::string m_buffer;
+        std::unique_ptr<std::stringstream> m_stream;
     };
 }
 
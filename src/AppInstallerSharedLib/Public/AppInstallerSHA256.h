@@ -54,8 +54,14 @@ namespace AppInstaller::Utility {
         static HashBuffer ComputeHash(std::istream& in);
 
         // Computes the hash from a given file path.
+        // The file is read in large chunks, with the next chunk being read while the current one is hashed.
         static HashBuffer ComputeHashFromFile(const std::filesystem::path& path);
 
+        // Computes the hashes of the given files, hashing several files at the same time.
+        // The hashes are returned in the same order as the paths. If errors is given, it receives the result of hashing
+        // each file and files that could not be hashed have an empty hash; otherwise the first error is thrown.
+        static std::vector<HashBuffer> ComputeHashesFromFiles(const std::vector<std::filesystem::path>& paths, std::vector<HRESULT>* errors = nullptr);
+
         static std::string ConvertToString(const HashBuffer& hashBuffer);
 
         static std::wstring ConvertToWideString(const HashBuffer& hashBuffer);
@@ -206,7 +206,7 @@ namespace AppInstaller::Utility
 
         // Determines whether a given version falls within this Gated version.
         // I.e., whether it matches up to the wildcard
-        bool IsValidVersion(Version version) const;
+        bool IsValidVersion(const Version& version) const;
 
         bool operator==(const GatedVersion& other) const { return m_version == other.m_version; }
         const std::string& ToString() const { return m_version.ToString(); }
@@ -0,0 +1,109 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <stdexcept>
+#include <utility>
+
+namespace AppInstaller::Utility
+{
+    // A bounded, lock-free queue that supports any number of producers and a single consumer.
+    // Each slot carries a sequence number that tells producers and the consumer whether it is
+    // free or filled for the current lap around the buffer, so no locks are needed on either side.
+    // The capacity must be a power of 2.
+    template <typename T>
+    struct MPSCRingBuffer
+    {
+        explicit MPSCRingBuffer(size_t capacity) :
+            m_capacity(capacity), m_mask(capacity - 1), m_slots(std::make_unique<Slot[]>(capacity))
+        {
+            if (capacity < 2 || (capacity & m_mask) != 0)
+            {
+                throw std::invalid_argument("capacity must be a power of 2");
+            }
+
+            for (size_t i = 0; i < capacity; ++i)
+            {
+                m_slots[i].Sequence.store(i, std::memory_order_relaxed);
+            }
+        }
+
+        MPSCRingBuffer(const MPSCRingBuffer&) = delete;
+        MPSCRingBuffer& operator=(const MPSCRingBuffer&) = delete;
+
+        MPSCRingBuffer(MPSCRingBuffer&&) = delete;
+        MPSCRingBuffer& operator=(MPSCRingBuffer&&) = delete;
+
+        // Attempts to add a value to the queue; safe to call from any thread.
+        // Returns false if the queue is full, in which case the value is left unmodified.
+        bool TryPush(T& value)
+        {
+            size_t position = m_enqueuePosition.load(std::memory_order_relaxed);
+
+            for (;;)
+            {
+                Slot& slot = m_slots[position & m_mask];
+                size_t sequence = slot.Sequence.load(std::memory_order_acquire);
+                auto difference = static_cast<std::ptrdiff_t>(sequence) - static_cast<std::ptrdiff_t>(position);
+
+                if (difference == 0)
+                {
+                    if (m_enqueuePosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+                    {
+                        slot.Value = std::move(value);
+                        slot.Sequence.store(position + 1, std::memory_order_release);
+                        return true;
+                    }
+                }
+                else if (difference < 0)
+                {
+                    // The consumer has not yet released this slot from the previous lap.
+                    return false;
+                }
+                else
+                {
+                    position = m_enqueuePosition.load(std::memory_order_relaxed);
+                }
+            }
+        }
+
+        // Removes the oldest value from the queue; must only be called from the single consumer.
+        // Returns an empty value if the queue is empty.
+        std::optional<T> TryPop()
+        {
+            Slot& slot = m_slots[m_dequeuePosition & m_mask];
+            size_t sequence = slot.Sequence.load(std::memory_order_acquire);
+
+            if (sequence != m_dequeuePosition + 1)
+            {
+                return std::nullopt;
+            }
+
+            std::optional<T> result{ std::move(slot.Value) };
+            slot.Value = T{};
+            slot.Sequence.store(m_dequeuePosition + m_capacity, std::memory_order_release);
+            ++m_dequeuePosition;
+
+            return result;
+        }
+
+        // Gets the maximum number of values that the queue can hold.
+        size_t Capacity() const { return m_capacity; }
+
+    private:
+        struct Slot
+        {
+            std::atomic<size_t> Sequence{ 0 };
+            T Value{};
+        };
+
+        size_t m_capacity;
+        size_t m_mask;
+        std::unique_ptr<Slot[]> m_slots;
+        alignas(64) std::atomic<size_t> m_enqueuePosition{ 0 };
+        alignas(64) size_t m_dequeuePosition = 0;
+    };
+}
@@ -0,0 +1,115 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+#pragma once
+#include <AppInstallerLogging.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <variant>
+#include <vector>
+
+// Records a span covering the remainder of the enclosing scope.
+#define AICLI_TRACE_SPAN(_channel_,_name_) \
+    AppInstaller::Logging::TraceSpan _aicli_trace_span{ AppInstaller::Logging::Channel:: _channel_, _name_ }
+
+namespace AppInstaller::Logging
+{
+    namespace details
+    {
+        inline std::atomic<bool> s_TracingEnabled = false;
+    }
+
+    // A completed span, with the thread that it was recorded on.
+    struct TraceEvent
+    {
+        using ArgumentValue = std::variant<int64_t, std::string>;
+
+        Channel Category = Channel::All;
+        std::string Name;
+        std::chrono::steady_clock::time_point Start;
+        std::chrono::steady_clock::duration Duration{};
+        uint32_t ThreadId = 0;
+        std::vector<std::pair<std::string, ArgumentValue>> Arguments;
+    };
+
+    // Starts recording spans; timestamps in the trace are relative to the first call.
+    void EnableTracing();
+
+    // Stops recording spans; those already recorded are kept until they are written.
+    void DisableTracing();
+
+    // Determines whether spans are being recorded.
+    inline bool IsTracingEnabled()
+    {
+        return details::s_TracingEnabled.load(std::memory_order_relaxed);
+    }
+
+    // Removes and returns the spans recorded by all threads, in no particular order.
+    std::vector<TraceEvent> TakeTraceEvents();
+
+    // Writes the recorded spans to a file in the Chrome trace event format, which can be opened
+    // with chrome://tracing or Perfetto, and removes them.
+    void WriteChromeTrace(const std::filesystem::path& path);
+
+    // Records the time between its construction and destruction as a span on the current thread.
+    // When tracing is disabled this does nothing beyond checking that it is, so spans can be placed
+    // on hot paths; the names of spans and their arguments are only copied when they are recorded.
+    // Each thread records to its own buffer, so threads do not contend when recording.
+    struct TraceSpan
+    {
+        TraceSpan(Channel category, std::string_view name)
+        {
+            if (IsTracingEnabled())
+            {
+                Begin(category, name);
+            }
+        }
+
+        ~TraceSpan()
+        {
+            if (m_event)
+            {
+                End();
+            }
+        }
+
+        TraceSpan(const TraceSpan&) = delete;
+        TraceSpan& operator=(const TraceSpan&) = delete;
+
+        TraceSpan(TraceSpan&&) = delete;
+        TraceSpan& operator=(TraceSpan&&) = delete;
+
+        // Determines whether the span is being recorded; use to avoid computing expensive arguments.
+        explicit operator bool() const { return m_event.has_value(); }
+
+        // Adds an argument to the span, shown with it in the trace.
+        template <typename T>
+        void AddArgument(std::string_view name, T&& value)
+        {
+            if (m_event)
+            {
+                if constexpr (std::is_integral_v<std::decay_t<T>> || std::is_enum_v<std::decay_t<T>>)
+                {
+                    m_event->Arguments.emplace_back(std::string{ name }, static_cast<int64_t>(value));
+                }
+                else
+                {
+                    m_event->Arguments.emplace_back(std::string{ name }, std::string{ std::forward<T>(value) });
+                }
+            }
+        }
+
+    private:
+        void Begin(Channel category, std::string_view name);
+        void End();
+
+        std::optional<TraceEvent> m_event;
+    };
+}
@@ -7,48 +7,140 @@
 #include "Public/AppInstallerErrors.h"
 #include "Public/AppInstallerStrings.h"
 
+#include <array>
+#include <atomic>
+#include <future>
+
 namespace AppInstaller::Utility {
 
+    namespace
+    {
+        // The size of each read when hashing a file.
+        constexpr DWORD s_FileReadSize = 4 * 1024 * 1024;
+
+        // The maximum number of files hashed at the same time.
+        constexpr size_t s_MaxConcurrentFileHashes = 8;
+
+        // The SHA256 algorithm provider, shared by all hash objects.
+        struct SHA256Algorithm
+        {
+            BCRYPT_ALG_HANDLE Handle = nullptr;
+            DWORD HashLength = 0;
+        };
+
+        SHA256Algorithm OpenSHA256Algorithm()
+        {
+            SHA256Algorithm result;
+            DWORD resultLength = 0;
+
+            // Open an algorithm handle
+            THROW_IF_NTSTATUS_FAILED_MSG(BCryptOpenAlgorithmProvider(
+                &result.Handle,             // Alg Handle pointer
+                BCRYPT_SHA256_ALGORITHM,    // Cryptographic Algorithm name (null terminated unicode string)
+                nullptr,                    // Provider name; if null, the default provider is loaded
+                0),                         // Flags
+                "failed opening SHA256 algorithm provider");
+            wil::unique_bcrypt_algorithm algHandle{ result.Handle };
+
+            // Obtain the length of the hash
+            THROW_IF_NTSTATUS_FAILED_MSG(BCryptGetProperty(
+                result.Handle,                  // Handle to a CNG object
+                BCRYPT_HASH_LENGTH,             // Property name (null terminated unicode string)
+                (PBYTE) & (result.HashLength),  // Address of the output buffer which receives the property value
+                sizeof(result.HashLength),      // Size of the buffer in bytes
+                &resultLength,                  // Number of bytes that were copied into the buffer
+                0),                             // Flags
+                "failed getting SHA256 hash length");
+
+            if (resultLength != sizeof(result.HashLength))
+            {
+                THROW_HR_MSG(E_UNEXPECTED, "failed getting SHA256 hash length");
+            }
+
+            algHandle.release();
+            return result;
+        }
+
+        // Opening the provider is far more expensive than hashing small inputs, so it is opened once.
+        // The handle is intentionally never closed, as it may be used until the process exits.
+        const SHA256Algorithm& GetSHA256Algorithm()
+        {
+            static SHA256Algorithm s_algorithm = OpenSHA256Algorithm();
+            return s_algorithm;
+        }
+
+        // An overlapped read of one chunk of a file.
+        struct FileRead
+        {
+            FileRead() : Buffer(std::make_unique<uint8_t[]>(s_FileReadSize))
+            {
+                Event.create(wil::EventOptions::ManualReset);
+                Overlapped.hEvent = Event.get();
+            }
+
+            std::unique_ptr<uint8_t[]> Buffer;
+            wil::unique_event Event;
+            OVERLAPPED Overlapped{};
+        };
+
+        // Starts reading the chunk at the given offset.
+        // Returns false if the read completed immediately at the end of the file.
+        bool StartFileRead(HANDLE file, FileRead& read, uint64_t offset)
+        {
+            read.Event.ResetEvent();
+            read.Overlapped.Offset = static_cast<DWORD>(offset);
+            read.Overlapped.OffsetHigh = static_cast<DWORD>(offset >> 32);
+
+            if (!ReadFile(file, read.Buffer.get(), s_FileReadSize, nullptr, &read.Overlapped))
+            {
+                DWORD error = GetLastError();
+                if (error == ERROR_HANDLE_EOF)
+                {
+                    return false;
+                }
+
+                THROW_WIN32_IF(error, error != ERROR_IO_PENDING);
+            }
+
+            return true;
+        }
+
+        // Waits for a read to complete, returning the number of bytes read.
+        DWORD FinishFileRead(HANDLE file, FileRead& read)
+        {
+            DWORD bytesRead = 0;
+
+            if (!GetOverlappedResult(file, &read.Overlapped, &bytesRead, TRUE))
+            {
+                DWORD error = GetLastError();
+                if (error == ERROR_HANDLE_EOF)
+                {
+                    return 0;
+                }
+
+                THROW_WIN32(error);
+            }
+
+            return bytesRead;
+        }
+    }
+
     struct SHA256Context
     {
-        wil::unique_bcrypt_algorithm algHandle;
         wil::unique_bcrypt_hash hashHandle;
         DWORD hashLength = 0;
     };
 
     SHA256::SHA256() : context(new SHA256Context{})
     {
-        BCRYPT_ALG_HANDLE algHandleT{};
+        const SHA256Algorithm& algorithm = GetSHA256Algorithm();
         BCRYPT_HASH_HANDLE hashHandleT;
-        DWORD resultLength = 0;
 
-        // Open an algorithm handle
-        THROW_IF_NTSTATUS_FAILED_MSG(BCryptOpenAlgorithmProvider(
-            &algHandleT,                // Alg Handle pointer
-            BCRYPT_SHA256_ALGORITHM,    // Cryptographic Algorithm name (null terminated unicode string)
-            nullptr,                    // Provider name; if null, the default provider is loaded
-            0),                         // Flags
-            "failed opening SHA256 algorithm provider");
-        context->algHandle.reset(algHandleT);
-
-        // Obtain the length of the hash
-        THROW_IF_NTSTATUS_FAILED_MSG(BCryptGetProperty(
-            context->algHandle.get(),       // Handle to a CNG object
-            BCRYPT_HASH_LENGTH,             // Property name (null terminated unicode string)
-            (PBYTE) & (context->hashLength),  // Address of the output buffer which receives the property value
-            sizeof(context->hashLength),    // Size of the buffer in bytes
-            &resultLength,                  // Number of bytes that were copied into the buffer
-            0),                             // Flags
-            "failed getting SHA256 hash length");
-        
-        if (resultLength != sizeof(context->hashLength))
-        {
-            THROW_HR_MSG(E_UNEXPECTED, "failed getting SHA256 hash length");
-        }
+        context->hashLength = algorithm.HashLength;
 
         // Create a hash handle
         THROW_IF_NTSTATUS_FAILED_MSG(BCryptCreateHash(
-            context->algHandle.get(),   // Handle to an algorithm provider
+            algorithm.Handle,           // Handle to an algorithm provider
             &hashHandleT,               // A pointer to a hash handle - can be a hash or hmac object
             nullptr,                    // Pointer to the buffer that receives the hash/hmac object
             0,                          // Size of the buffer in bytes
@@ -148,10 +240,128 @@ namespace AppInstaller::Utility {
 
     SHA256::HashBuffer SHA256::ComputeHashFromFile(const std::filesystem::path& path)
     {
-        std::ifstream inStream{ path, std::ifstream::binary };
-        const Utility::SHA256::HashBuffer& targetFileHash = Utility::SHA256::ComputeHash(inStream);
-        inStream.close();
-        return targetFileHash;
+        wil::unique_hfile file{ CreateFileW(
+            path.c_str(),
+            GENERIC_READ,
+            FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE,
+            nullptr,
+            OPEN_EXISTING,
+            FILE_FLAG_SEQUENTIAL_SCAN | FILE_FLAG_OVERLAPPED,
+            nullptr) };
+        THROW_LAST_ERROR_IF(!file);
+
+        // Two reads alternate, so that the next chunk is read from disk while the current one is hashed.
+        std::array<FileRead, 2> reads;
+        FileRead* pendingRead = nullptr;
+
+        // Never release a buffer that the system is still reading into.
+        auto waitForPendingRead = wil::scope_exit([&]()
+        {
+            if (pendingRead)
+            {
+                DWORD bytesRead = 0;
+                CancelIoEx(file.get(), &pendingRead->Overlapped);
+                GetOverlappedResult(file.get(), &pendingRead->Overlapped, &bytesRead, TRUE);
+            }
+        });
+
+        SHA256 hasher;
+        uint64_t offset = 0;
+        size_t current = 0;
+
+        if (StartFileRead(file.get(), reads[current], offset))
+        {
+            pendingRead = &reads[current];
+        }
+
+        while (pendingRead)
+        {
+            DWORD bytesRead = FinishFileRead(file.get(), reads[current]);
+            pendingRead = nullptr;
+
+            if (bytesRead == 0)
+            {
+                break;
+            }
+
+            offset += bytesRead;
+
+            size_t next = 1 - current;
+            if (StartFileRead(file.get(), reads[next], offset))
+            {
+                pendingRead = &reads[next];
+            }
+
+            hasher.Add(reads[current].Buffer.get(), bytesRead);
+            current = next;
+        }
+
+        return hasher.Get();
+    }
+
+    std::vector<SHA256::HashBuffer> SHA256::ComputeHashesFromFiles(const std::vector<std::filesystem::path>& paths, std::vector<HRESULT>* errors)
+    {
+        std::vector<HashBuffer> result(paths.size());
+        std::vector<std::exception_ptr> exceptions(paths.size());
+        std::atomic<size_t> nextPath = 0;
+
+        auto hashFiles = [&]()
+        {
+            for (size_t i = nextPath++; i < paths.size(); i = nextPath++)
+            {
+                try
+                {
+                    result[i] = ComputeHashFromFile(paths[i]);
+                }
+                catch (...)
+                {
+                    exceptions[i] = std::current_exception();
+                }
+            }
+        };
+
+        // The current thread is one of the workers.
+        std::vector<std::future<void>> workers;
+        for (size_t i = 1; i < std::min(paths.size(), s_MaxConcurrentFileHashes); ++i)
+        {
+            workers.emplace_back(std::async(std::launch::async, hashFiles));
+        }
+
+        hashFiles();
+
+        for (auto& worker : workers)
+        {
+            worker.get();
+        }
+
+        if (errors)
+        {
+            errors->assign(paths.size(), S_OK);
+        }
+
+        for (size_t i = 0; i < exceptions.size(); ++i)
+        {
+            if (!exceptions[i])
+            {
+                continue;
+            }
+
+            if (!errors)
+            {
+                std::rethrow_exception(exceptions[i]);
+            }
+
+            try
+            {
+                std::rethrow_exception(exceptions[i]);
+            }
+            catch (...)
+            {
+                (*errors)[i] = LOG_CAUGHT_EXCEPTION();
+            }
+        }
+
+        return result;
     }
 
     void SHA256::SHA256ContextDeleter::operator()(SHA256Context* context)
@@ -0,0 +1,196 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+#include "pch.h"
+#include "Public/winget/Tracing.h"
+
+namespace AppInstaller::Logging
+{
+    namespace
+    {
+        // Bounds the memory used by a thread that records spans in a tight loop; further spans are counted but dropped.
+        constexpr size_t s_MaxEventsPerThread = 1 << 20;
+
+        struct ThreadTraceBuffer
+        {
+            std::mutex Lock;
+            std::vector<TraceEvent> Events;
+            size_t DroppedCount = 0;
+            uint32_t ThreadId = 0;
+        };
+
+        // The buffers of every thread that has recorded a span; they are kept after the thread exits
+        // so that its spans are still written.
+        struct TraceState
+        {
+            std::mutex Lock;
+            std::vector<std::shared_ptr<ThreadTraceBuffer>> Buffers;
+            std::optional<std::chrono::steady_clock::time_point> Epoch;
+        };
+
+        TraceState& GetTraceState()
+        {
+            static TraceState s_state;
+            return s_state;
+        }
+
+        ThreadTraceBuffer& GetThreadTraceBuffer()
+        {
+            thread_local std::shared_ptr<ThreadTraceBuffer> t_buffer;
+
+            if (!t_buffer)
+            {
+                auto buffer = std::make_shared<ThreadTraceBuffer>();
+                buffer->ThreadId = GetCurrentThreadId();
+
+                TraceState& state = GetTraceState();
+                std::lock_guard<std::mutex> lock{ state.Lock };
+                state.Buffers.emplace_back(buffer);
+                t_buffer = std::move(buffer);
+            }
+
+            return *t_buffer;
+        }
+
+        // Trace event timestamps are in microseconds.
+        double ToMicroseconds(std::chrono::steady_clock::duration duration)
+        {
+            return std::chrono::duration<double, std::micro>(duration).count();
+        }
+    }
+
+    void EnableTracing()
+    {
+        TraceState& state = GetTraceState();
+
+        {
+            std::lock_guard<std::mutex> lock{ state.Lock };
+            if (!state.Epoch)
+            {
+                state.Epoch = std::chrono::steady_clock::now();
+            }
+        }
+
+        details::s_TracingEnabled = true;
+    }
+
+    void DisableTracing()
+    {
+        details::s_TracingEnabled = false;
+    }
+
+    std::vector<TraceEvent> TakeTraceEvents()
+    {
+        std::vector<TraceEvent> result;
+
+        TraceState& state = GetTraceState();
+        std::lock_guard<std::mutex> lock{ state.Lock };
+
+        for (const auto& buffer : state.Buffers)
+        {
+            std::lock_guard<std::mutex> bufferLock{ buffer->Lock };
+
+            if (buffer->DroppedCount)
+            {
+                AICLI_LOG(Core, Warning, << "Trace spans were dropped on thread " << buffer->ThreadId << ": " << buffer->DroppedCount);
+                buffer->DroppedCount = 0;
+            }
+
+            std::move(buffer->Events.begin(), buffer->Events.end(), std::back_inserter(result));
+            buffer->Events.clear();
+        }
+
+        return result;
+    }
+
+    void WriteChromeTrace(const std::filesystem::path& path)
+    {
+        std::chrono::steady_clock::time_point epoch;
+
+        {
+            TraceState& state = GetTraceState();
+            std::lock_guard<std::mutex> lock{ state.Lock };
+            epoch = state.Epoch.value_or(std::chrono::steady_clock::now());
+        }
+
+        std::vector<TraceEvent> events = TakeTraceEvents();
+
+        Json::Value traceEvents{ Json::arrayValue };
+        Json::UInt processId = GetCurrentProcessId();
+
+        for (const auto& event : events)
+        {
+            Json::Value value{ Json::objectValue };
+            value["name"] = event.Name;
+            value["cat"] = GetChannelName(event.Category);
+            value["ph"] = "X";
+            value["ts"] = ToMicroseconds(event.Start - epoch);
+            value["dur"] = ToMicroseconds(event.Duration);
+            value["pid"] = processId;
+            value["tid"] = static_cast<Json::UInt>(event.ThreadId);
+
+            if (!event.Arguments.empty())
+            {
+                Json::Value arguments{ Json::objectValue };
+                for (const auto& argument : event.Arguments)
+                {
+                    if (std::holds_alternative<int64_t>(argument.second))
+                    {
+                        arguments[argument.first] = static_cast<Json::Int64>(std::get<int64_t>(argument.second));
+                    }
+                    else
+                    {
+                        arguments[argument.first] = std::get<std::string>(argument.second);
+                    }
+                }
+                value["args"] = std::move(arguments);
+            }
+
+            traceEvents.append(std::move(value));
+        }
+
+        Json::Value root{ Json::objectValue };
+        root["traceEvents"] = std::move(traceEvents);
+        root["displayTimeUnit"] = "ms";
+
+        Json::StreamWriterBuilder writerBuilder;
+        writerBuilder["indentation"] = "";
+
+        std::ofstream stream{ path, std::ios::out | std::ios::trunc | std::ios::binary };
+        THROW_HR_IF_MSG(HRESULT_FROM_WIN32(ERROR_OPEN_FAILED), !stream, "Failed to open the trace file");
+        stream << Json::writeString(writerBuilder, root);
+
+        AICLI_LOG(Core, Info, << "Wrote " << events.size() << " trace spans to: " << path);
+    }
+
+    void TraceSpan::Begin(Channel category, std::string_view name)
+    {
+        TraceEvent& event = m_event.emplace();
+        event.Category = category;
+        event.Name = name;
+        event.Start = std::chrono::steady_clock::now();
+    }
+
+    void TraceSpan::End()
+    {
+        m_event->Duration = std::chrono::steady_clock::now() - m_event->Start;
+
+        try
+        {
+            ThreadTraceBuffer& buffer = GetThreadTraceBuffer();
+            m_event->ThreadId = buffer.ThreadId;
+
+            std::lock_guard<std::mutex> lock{ buffer.Lock };
+            if (buffer.Events.size() < s_MaxEventsPerThread)
+            {
+                buffer.Events.emplace_back(std::move(m_event).value());
+            }
+            else
+            {
+                ++buffer.DroppedCount;
+            }
+        }
+        catch (...) {}
+
+        m_event.reset();
+    }
+}
@@ -571,21 +571,23 @@ namespace AppInstaller::Utility
         return m_maxVersion;
     }
 
-    bool GatedVersion::IsValidVersion(Version version) const
+    bool GatedVersion::IsValidVersion(const Version& version) const
     {
-        auto gateParts = m_version.GetParts();
+        // This is checked for every available version of every pinned package, so avoid copying either version.
+        const auto& gateParts = m_version.GetParts();
         if (gateParts.empty())
         {
             return false;
         }
 
-        if (gateParts.back() != Version::Part("*"))
+        static const Version::Part s_wildcard{ "*" };
+        if (gateParts.back() != s_wildcard)
         {
             // Without wildcards, revert to direct comparison
             return m_version == version;
         }
 
-        auto versionParts = version.GetParts();
+        const auto& versionParts = version.GetParts();
         for (size_t i = 0; i < gateParts.size() - 1; ++i)
         {
             if (versionParts.size() > i)
@@ -418,7 +418,7 @@ namespace AppInstaller::YAML
         return Load(static_cast<std::string_view>(input));
     }
 
-    Node Load(std::istream& input, Utility::SHA256::HashBuffer* hashOut)
+    Node Load(const std::filesystem::path& input, Utility::SHA256::HashBuffer* hashOut)
     {
         Wrapper::Parser parser(input, hashOut);
         Wrapper::Document document = parser.Load();
@@ -433,13 +433,6 @@ namespace AppInstaller::YAML
         }
     }
 
-    Node Load(const std::filesystem::path& input, Utility::SHA256::HashBuffer* hashOut)
-    {
-        std::ifstream stream(input, std::ios_base::in | std::ios_base::binary);
-        THROW_LAST_ERROR_IF(stream.fail());
-        return Load(stream, hashOut);
-    }
-
     Node Load(const std::filesystem::path& input)
     {
         return Load(input, nullptr);
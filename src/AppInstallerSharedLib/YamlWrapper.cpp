@@ -245,23 +245,62 @@ namespace AppInstaller::YAML::Wrapper
     {
         THROW_HR_IF(APPINSTALLER_CLI_ERROR_YAML_INIT_FAILED, !yaml_parser_initialize(&m_parser));
 
-        PrepareInput();
-        yaml_parser_set_input_string(&m_parser, reinterpret_cast<const unsigned char*>(m_input.c_str()), m_input.size());
+        if (PrepareInput(m_input))
+        {
+            yaml_parser_set_input_string(&m_parser, reinterpret_cast<const unsigned char*>(m_input.c_str()), m_input.size());
+        }
+        else
+        {
+            SetConvertedInput(std::string{ m_input });
+        }
     }
 
-    Parser::Parser(std::istream& input, Utility::SHA256::HashBuffer* hashOut) : m_token(true)
+    Parser::Parser(const std::filesystem::path& input, Utility::SHA256::HashBuffer* hashOut) : m_token(true), m_hashOut(hashOut)
     {
         THROW_HR_IF(APPINSTALLER_CLI_ERROR_YAML_INIT_FAILED, !yaml_parser_initialize(&m_parser));
 
-        m_input = Utility::ReadEntireStream(input);
+        m_file.reset(CreateFileW(input.c_str(), GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_DELETE, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr));
+        THROW_LAST_ERROR_IF(!m_file);
+
+        LARGE_INTEGER fileSize{};
+        THROW_IF_WIN32_BOOL_FALSE(GetFileSizeEx(m_file.get(), &fileSize));
 
-        if (hashOut)
+        if (m_hashOut)
         {
-            *hashOut = Utility::SHA256::ComputeHash(reinterpret_cast<const uint8_t*>(m_input.data()), static_cast<uint32_t>(m_input.size()));
+            m_hash = std::make_unique<Utility::SHA256>();
         }
 
-        PrepareInput();
-        yaml_parser_set_input_string(&m_parser, reinterpret_cast<const unsigned char*>(m_input.c_str()), m_input.size());
+        // An empty file cannot be mapped; it parses as an empty string.
+        if (fileSize.QuadPart == 0)
+        {
+            m_file.reset();
+            yaml_parser_set_input_string(&m_parser, reinterpret_cast<const unsigned char*>(m_input.c_str()), m_input.size());
+            return;
+        }
+
+        m_mapping.reset(CreateFileMappingW(m_file.get(), nullptr, PAGE_READONLY, 0, 0, nullptr));
+        THROW_LAST_ERROR_IF_NULL(m_mapping);
+
+        m_view.reset(reinterpret_cast<char*>(MapViewOfFile(m_mapping.get(), FILE_MAP_READ, 0, 0, 0)));
+        THROW_LAST_ERROR_IF_NULL(m_view);
+
+        m_mappedInput = { m_view.get(), wil::safe_cast<size_t>(fileSize.QuadPart) };
+
+        if (PrepareInput(m_mappedInput))
+        {
+            yaml_parser_set_input(&m_parser, MappedInputReadHandler, this);
+        }
+        else
+        {
+            // The converted input no longer matches the file, so hash all of the original bytes now.
+            CompleteHash();
+            SetConvertedInput(m_mappedInput);
+
+            m_mappedInput = {};
+            m_view.reset();
+            m_mapping.reset();
+            m_file.reset();
+        }
     }
 
     Parser::~Parser()
@@ -295,57 +334,59 @@ namespace AppInstaller::YAML::Wrapper
             }
         }
 
+        CompleteHash();
+
         return result;
     }
 
-    void Parser::PrepareInput()
+    bool Parser::PrepareInput(std::string_view input)
     {
         constexpr char c_utf16BOM[2] = { static_cast<char>(0xFF), static_cast<char>(0xFE) };
         constexpr char c_utf8BOM[3] = { static_cast<char>(0xEF), static_cast<char>(0xBB), static_cast<char>(0xBF) };
 
         // If input has a BOM, we want to pass it on through.
         // Check for UTF-16 BOMs
-        if (m_input.size() >= 2 &&
-            ((m_input[0] == c_utf16BOM[0] && m_input[1] == c_utf16BOM[1]) || (m_input[0] == c_utf16BOM[1] && m_input[1] == c_utf16BOM[0])))
+        if (input.size() >= 2 &&
+            ((input[0] == c_utf16BOM[0] && input[1] == c_utf16BOM[1]) || (input[0] == c_utf16BOM[1] && input[1] == c_utf16BOM[0])))
         {
             AICLI_LOG(YAML, Verbose, << "Found UTF-16 BOM");
-            return;
+            return true;
         }
 
         // Check for UTF-8 BOM
-        if (m_input.size() >= 3 &&
-            (m_input[0] == c_utf8BOM[0] && m_input[1] == c_utf8BOM[1] && m_input[2] == c_utf8BOM[2]))
+        if (input.size() >= 3 &&
+            (input[0] == c_utf8BOM[0] && input[1] == c_utf8BOM[1] && input[2] == c_utf8BOM[2]))
         {
             AICLI_LOG(YAML, Verbose, << "Found UTF-8 BOM");
-            return;
+            return true;
         }
 
         // Check for BOM-less UTF-16 LE
         INT expectedTests = IS_TEXT_UNICODE_ASCII16 | IS_TEXT_UNICODE_STATISTICS | IS_TEXT_UNICODE_CONTROLS;
         INT testResults = expectedTests;
-        if (IsTextUnicode(m_input.data(), wil::safe_cast<int>(m_input.size()), &testResults) || testResults == expectedTests)
+        if (IsTextUnicode(input.data(), wil::safe_cast<int>(input.size()), &testResults) || testResults == expectedTests)
         {
             AICLI_LOG(YAML, Verbose, << "Detected UTF-16 LE");
             yaml_parser_set_encoding(&m_parser, YAML_UTF16LE_ENCODING);
-            return;
+            return true;
         }
 
         // Check for BOM-less UTF-16 BE
         expectedTests = IS_TEXT_UNICODE_REVERSE_ASCII16 | IS_TEXT_UNICODE_REVERSE_STATISTICS | IS_TEXT_UNICODE_REVERSE_CONTROLS;
         testResults = expectedTests;
-        if (IsTextUnicode(m_input.data(), wil::safe_cast<int>(m_input.size()), &testResults) || testResults == expectedTests)
+        if (IsTextUnicode(input.data(), wil::safe_cast<int>(input.size()), &testResults) || testResults == expectedTests)
         {
             AICLI_LOG(YAML, Verbose, << "Detected UTF-16 BE");
             yaml_parser_set_encoding(&m_parser, YAML_UTF16BE_ENCODING);
-            return;
+            return true;
         }
 
         // Check for BOM-less UTF-8
         UINT nChars = MultiByteToWideChar(
             CP_UTF8,
             MB_ERR_INVALID_CHARS,
-            m_input.data(),
-            wil::safe_cast<int>(m_input.size()),
+            input.data(),
+            wil::safe_cast<int>(input.size()),
             NULL,
             0);
 
@@ -353,14 +394,60 @@ namespace AppInstaller::YAML::Wrapper
         {
             AICLI_LOG(YAML, Verbose, << "Detected UTF-8");
             yaml_parser_set_encoding(&m_parser, YAML_UTF8_ENCODING);
-            return;
+            return true;
         }
 
-        // Must be ANSI (Windows-1252 assumed), convert to UTF-8
+        // Must be ANSI (Windows-1252 assumed)
         AICLI_LOG(YAML, Verbose, << "Assuming ANSI Windows-1252");
-        std::wstring utf16 = Utility::ConvertToUTF16(m_input, 1252);
+        return false;
+    }
+
+    void Parser::SetConvertedInput(std::string_view input)
+    {
+        std::wstring utf16 = Utility::ConvertToUTF16(input, 1252);
         m_input = Utility::ConvertToUTF8(utf16);
         yaml_parser_set_encoding(&m_parser, YAML_UTF8_ENCODING);
+        yaml_parser_set_input_string(&m_parser, reinterpret_cast<const unsigned char*>(m_input.c_str()), m_input.size());
+    }
+
+    int Parser::MappedInputReadHandler(void* data, unsigned char* buffer, size_t size, size_t* sizeRead)
+    {
+        Parser* parser = reinterpret_cast<Parser*>(data);
+        size_t remaining = parser->m_mappedInput.size() - parser->m_mappedInputRead;
+        size_t toRead = std::min(size, remaining);
+
+        if (toRead)
+        {
+            const char* source = parser->m_mappedInput.data() + parser->m_mappedInputRead;
+            memcpy(buffer, source, toRead);
+
+            // Hash the chunk while it is still hot in the cache, rather than in a separate pass over the file.
+            if (parser->m_hash)
+            {
+                parser->m_hash->Add(reinterpret_cast<const uint8_t*>(source), toRead);
+            }
+
+            parser->m_mappedInputRead += toRead;
+        }
+
+        *sizeRead = toRead;
+        return 1;
+    }
+
+    void Parser::CompleteHash()
+    {
+        if (!m_hash)
+        {
+            return;
+        }
+
+        if (m_mappedInputRead < m_mappedInput.size())
+        {
+            m_hash->Add(reinterpret_cast<const uint8_t*>(m_mappedInput.data() + m_mappedInputRead), m_mappedInput.size() - m_mappedInputRead);
+        }
+
+        m_hash->Get(*m_hashOut);
+        m_hash.reset();
     }
 
     Event::~Event()
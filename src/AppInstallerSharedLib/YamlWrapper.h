@@ -6,7 +6,11 @@
 #include "AppInstallerLanguageUtilities.h"
 #include "AppInstallerSHA256.h"
 
+#include <wil/resource.h>
+
+#include <filesystem>
 #include <iostream>
+#include <memory>
 #include <string_view>
 #include <vector>
 
@@ -68,7 +72,11 @@ namespace AppInstaller::YAML::Wrapper
     struct Parser
     {
         Parser(std::string_view input);
-        Parser(std::istream& input, Utility::SHA256::HashBuffer* hashOut = nullptr);
+
+        // Memory maps the file and feeds it directly to the parser.
+        // If requested, the hash of the file is computed as the parser reads it and is
+        // available once the first document has been loaded.
+        Parser(const std::filesystem::path& input, Utility::SHA256::HashBuffer* hashOut = nullptr);
 
         Parser(const Parser&) = delete;
         Parser& operator=(const Parser&) = delete;
@@ -84,12 +92,31 @@ namespace AppInstaller::YAML::Wrapper
         Document Load();
 
     private:
-        // Determines the type of encoding in use, transforming the input as necessary.
-        void PrepareInput();
+        // Determines the type of encoding in use, setting it on the parser.
+        // Returns false if the input is ANSI and must be converted to UTF-8 before parsing.
+        bool PrepareInput(std::string_view input);
+
+        // Converts ANSI (Windows-1252) input to UTF-8 and sets it as the parser input.
+        void SetConvertedInput(std::string_view input);
+
+        // The libyaml read handler for mapped input.
+        static int MappedInputReadHandler(void* data, unsigned char* buffer, size_t size, size_t* sizeRead);
+
+        // Hashes any input that the parser has not read and writes out the final hash.
+        void CompleteHash();
 
         DestructionToken m_token;
         yaml_parser_t m_parser;
         std::string m_input;
+
+        // Mapped file input
+        wil::unique_hfile m_file;
+        wil::unique_handle m_mapping;
+        wil::unique_mapview_ptr<char> m_view;
+        std::string_view m_mappedInput;
+        size_t m_mappedInputRead = 0;
+        std::unique_ptr<Utility::SHA256> m_hash;
+        Utility::SHA256::HashBuffer* m_hashOut = nullptr;
     };
 
     // A libyaml yaml_event_t.
@@ -13,6 +13,7 @@
 #include "Microsoft/PredefinedInstalledSourceFactory.h"
 #include <wil\cppwinrt_wrl.h>
 #include <winget/GroupPolicy.h>
+#include <winget/OpenedSourceCache.h>
 #include <AppInstallerErrors.h>
 #include <AppInstallerStrings.h>
 #include <Helpers.h>
@@ -104,10 +105,7 @@ namespace winrt::Microsoft::Management::Deployment::implementation
                 {
                     auto catalog = m_compositePackageCatalogOptions.Catalogs().GetAt(i);
                     winrt::Microsoft::Management::Deployment::implementation::PackageCatalogReference* catalogImpl = get_self<winrt::Microsoft::Management::Deployment::implementation::PackageCatalogReference>(catalog);
-                    auto copy = catalogImpl->m_sourceReference;
-                    copy.SetCaller(GetCallerName());
-                    copy.Open(progress);
-                    remoteSources.emplace_back(std::move(copy));
+                    remoteSources.emplace_back(::AppInstaller::Repository::OpenedSourceCache::Instance().Open(catalogImpl->m_sourceReference, GetCallerName(), progress));
                 }
 
                 // Create the aggregated source.
@@ -134,15 +132,13 @@ namespace winrt::Microsoft::Management::Deployment::implementation
                         installedSource = ::AppInstaller::Repository::Source{ ::AppInstaller::Repository::PredefinedSource::Installed };
                     }
 
-                    installedSource.Open(progress);
+                    installedSource = ::AppInstaller::Repository::OpenedSourceCache::Instance().Open(installedSource, GetCallerName(), progress);
                     source = ::AppInstaller::Repository::Source{ installedSource, source, searchBehavior };
                 }
             }
             else
             {
-                source = m_sourceReference;
-                source.SetCaller(GetCallerName());
-                source.Open(progress);
+                source = ::AppInstaller::Repository::OpenedSourceCache::Instance().Open(m_sourceReference, GetCallerName(), progress);
             }
 
             if (!source)
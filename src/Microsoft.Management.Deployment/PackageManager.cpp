@@ -9,6 +9,7 @@
 #include "Workflows/WorkflowBase.h"
 #include <winget/UserSettings.h>
 #include <winget/Manifest.h>
+#include <winget/OpenedSourceCache.h>
 #include "Commands/COMCommand.h"
 #include <AppInstallerTelemetry.h>
 #include <AppInstallerErrors.h>
@@ -123,7 +124,7 @@ namespace winrt::Microsoft::Management::Deployment::implementation
     {
         winrt::Microsoft::Management::Deployment::implementation::PackageVersionInfo* packageVersionInfoImpl = get_self<winrt::Microsoft::Management::Deployment::implementation::PackageVersionInfo>(packageVersionInfo);
         std::shared_ptr<::AppInstaller::Repository::IPackageVersion> internalPackageVersion = packageVersionInfoImpl->GetRepositoryPackageVersion();
-        ::AppInstaller::Manifest::Manifest manifest = internalPackageVersion->GetManifest();
+        ::AppInstaller::Manifest::SharedManifest manifest = internalPackageVersion->GetManifest();
 
         std::string targetLocale;
         if (context->Args.Contains(::AppInstaller::CLI::Execution::Args::Type::Locale))
@@ -132,7 +133,7 @@ namespace winrt::Microsoft::Management::Deployment::implementation
         }
         manifest.ApplyLocale(targetLocale);
 
-        context->GetThreadGlobals().GetTelemetryLogger().LogManifestFields(manifest.Id, manifest.DefaultLocalization.Get<::AppInstaller::Manifest::Localization::PackageName>(), manifest.Version);
+        context->GetThreadGlobals().GetTelemetryLogger().LogManifestFields(manifest->Id, manifest->DefaultLocalization.Get<::AppInstaller::Manifest::Localization::PackageName>(), manifest->Version);
 
         context->Add<::AppInstaller::CLI::Execution::Data::Manifest>(std::move(manifest));
         context->Add<::AppInstaller::CLI::Execution::Data::PackageVersion>(std::move(internalPackageVersion));
@@ -703,6 +704,9 @@ namespace winrt::Microsoft::Management::Deployment::implementation
 
             if (completionEventFired)
             {
+                // Cached installed sources may no longer reflect the packages on the system.
+                ::AppInstaller::Repository::OpenedSourceCache::Instance().InvalidateInstalled();
+
                 // The install command has finished, check for success/failure and how far it got.
                 terminationHR = queueItem->GetContext().GetTerminationHR();
                 executionStage = queueItem->GetContext().GetExecutionStage();
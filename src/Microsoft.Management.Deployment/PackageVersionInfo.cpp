@@ -137,7 +137,7 @@ namespace winrt::Microsoft::Management::Deployment::implementation
         PopulateContextFromInstallOptions(&context, options);
         AppInstaller::Repository::IPackageVersion::Metadata installationMetadata;
         AppInstaller::CLI::Workflow::ManifestComparator manifestComparator{ context, installationMetadata };
-        AppInstaller::Manifest::Manifest manifest = m_packageVersion->GetManifest();
+        AppInstaller::Manifest::SharedManifest manifest = m_packageVersion->GetManifest();
         auto result = manifestComparator.GetPreferredInstaller(manifest);
         return result.installer.has_value();
     }
@@ -147,7 +147,7 @@ namespace winrt::Microsoft::Management::Deployment::implementation
         PopulateContextFromInstallOptions(&context, options);
         AppInstaller::Repository::IPackageVersion::Metadata installationMetadata;
         AppInstaller::CLI::Workflow::ManifestComparator manifestComparator{ context, installationMetadata };
-        AppInstaller::Manifest::Manifest manifest = m_packageVersion->GetManifest();
+        AppInstaller::Manifest::SharedManifest manifest = m_packageVersion->GetManifest();
         auto result = manifestComparator.GetPreferredInstaller(manifest);
 
         if (result.installer.has_value())
@@ -168,7 +168,7 @@ namespace winrt::Microsoft::Management::Deployment::implementation
         {
             auto manifest = m_packageVersion->GetManifest();
             manifest.ApplyLocale();
-            catalogPackageMetadata->Initialize(manifest.CurrentLocalization);
+            catalogPackageMetadata->Initialize(manifest->CurrentLocalization);
         }
 
         return *catalogPackageMetadata;
@@ -186,7 +186,7 @@ namespace winrt::Microsoft::Management::Deployment::implementation
         {
             auto manifest = m_packageVersion->GetManifest();
             manifest.ApplyLocale(localeString);
-            catalogPackageMetadata->Initialize(manifest.CurrentLocalization);
+            catalogPackageMetadata->Initialize(manifest->CurrentLocalization);
         }
 
         return *catalogPackageMetadata;
@@ -163,6 +163,8 @@ int __stdcall wWinMain(_In_ HINSTANCE, _In_opt_ HINSTANCE, _In_ LPWSTR cmdLine,
 
         manualResetEvent.reset();
         RETURN_IF_FAILED(WindowsPackageManagerServerModuleUnregister());
+
+        LOG_IF_FAILED(WindowsPackageManagerServerShutdown());
     }
     CATCH_RETURN()
 
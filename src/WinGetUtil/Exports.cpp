@@ -179,6 +179,25 @@ extern "C"
     }
     CATCH_RETURN()
 
+    WINGET_UTIL_API WinGetSQLiteIndexPrepareForPackagingV2(
+        WINGET_SQLITE_INDEX_HANDLE index,
+        WINGET_STRING completionIndexPath) try
+    {
+        THROW_HR_IF(E_INVALIDARG, !index);
+
+        if (completionIndexPath)
+        {
+            reinterpret_cast<SQLiteIndex*>(index)->PrepareForPackaging(completionIndexPath);
+        }
+        else
+        {
+            reinterpret_cast<SQLiteIndex*>(index)->PrepareForPackaging();
+        }
+
+        return S_OK;
+    }
+    CATCH_RETURN()
+
     WINGET_UTIL_API WinGetSQLiteIndexCheckConsistency(
         WINGET_SQLITE_INDEX_HANDLE index,
         BOOL* succeeded) try
@@ -465,6 +484,45 @@ extern "C"
     }
     CATCH_RETURN()
 
+    WINGET_UTIL_API WinGetValidateManifestsDependencies(
+        const WINGET_STRING* inputPaths,
+        UINT32 inputPathCount,
+        BOOL* succeeded,
+        WINGET_STRING_OUT* message,
+        WINGET_SQLITE_INDEX_HANDLE index) try
+    {
+        THROW_HR_IF(E_INVALIDARG, !inputPaths && inputPathCount != 0);
+        THROW_HR_IF(E_INVALIDARG, !succeeded);
+        THROW_HR_IF(E_INVALIDARG, !index);
+
+        try
+        {
+            std::vector<Manifest> manifests;
+            manifests.reserve(inputPathCount);
+
+            for (UINT32 i = 0; i < inputPathCount; ++i)
+            {
+                THROW_HR_IF(E_INVALIDARG, !inputPaths[i]);
+                manifests.emplace_back(YamlParser::CreateFromPath(inputPaths[i]));
+            }
+
+            PackageDependenciesValidation::ValidateManifestsDependencies(reinterpret_cast<SQLiteIndex*>(index), manifests);
+
+            *succeeded = TRUE;
+        }
+        catch (const ManifestException& e)
+        {
+            *succeeded = e.IsWarningOnly();
+            if (message)
+            {
+                *message = ::SysAllocString(ConvertToUTF16(e.GetManifestErrorMessage()).c_str());
+            }
+        }
+
+        return S_OK;
+    }
+    CATCH_RETURN()
+
     WINGET_UTIL_API WinGetDownload(
         WINGET_STRING url,
         WINGET_STRING filePath,
@@ -149,6 +149,12 @@ extern "C"
     WINGET_UTIL_API WinGetSQLiteIndexPrepareForPackaging(
         WINGET_SQLITE_INDEX_HANDLE index);
 
+    // Removes data that is no longer needed for an index that is to be published.
+    // If completionIndexPath is not null, also writes the completion index for the packaged data to it.
+    WINGET_UTIL_API WinGetSQLiteIndexPrepareForPackagingV2(
+        WINGET_SQLITE_INDEX_HANDLE index,
+        WINGET_STRING completionIndexPath);
+
     // Checks the index for consistency, ensuring that at a minimum all referenced rows actually exist.
     WINGET_UTIL_API WinGetSQLiteIndexCheckConsistency(
         WINGET_SQLITE_INDEX_HANDLE index,
@@ -211,6 +217,16 @@ extern "C"
         WINGET_SQLITE_INDEX_HANDLE index,
         WinGetValidateManifestDependenciesOption dependenciesValidationOption);
 
+    // Validates the dependencies of a batch of manifests, as if all of them were added to the index.
+    // The dependency data of the index is read once, so this is preferred over validating the manifests one at a time.
+    // Returns a bool for validation result and a string representing validation errors if validation failed.
+    WINGET_UTIL_API WinGetValidateManifestsDependencies(
+        const WINGET_STRING* inputPaths,
+        UINT32 inputPathCount,
+        BOOL* succeeded,
+        WINGET_STRING_OUT* message,
+        WINGET_SQLITE_INDEX_HANDLE index);
+
     // Downloads a file to the given path, returning the SHA 256 hash of the file.
     WINGET_UTIL_API WinGetDownload(
         WINGET_STRING url,
@@ -19,6 +19,10 @@ extern "C"
     // Initializes the Windows Package Manager COM server.
     WINDOWS_PACKAGE_MANAGER_API WindowsPackageManagerServerInitialize();
 
+    // Shuts down the Windows Package Manager COM server, waiting for its background work to stop.
+    // Call before the process exits, as this cannot be done safely while the module is unloaded.
+    WINDOWS_PACKAGE_MANAGER_API WindowsPackageManagerServerShutdown();
+
     // Creates the server module with the given termination callback.
     WINDOWS_PACKAGE_MANAGER_API WindowsPackageManagerServerModuleCreate(WindowsPackageManagerServerModuleTerminationCallback callback);
 
@@ -42,6 +42,13 @@ extern "C"
     }
     CATCH_RETURN();
 
+    WINDOWS_PACKAGE_MANAGER_API WindowsPackageManagerServerShutdown() try
+    {
+        AppInstaller::CLI::ServerShutdown();
+        return S_OK;
+    }
+    CATCH_RETURN();
+
     WINDOWS_PACKAGE_MANAGER_API WindowsPackageManagerServerModuleCreate(WindowsPackageManagerServerModuleTerminationCallback callback) try
     {
         ::Microsoft::WRL::Module<::Microsoft::WRL::ModuleType::OutOfProc>::Create(callback);